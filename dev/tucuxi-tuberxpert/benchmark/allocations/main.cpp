@@ -0,0 +1,51 @@
+#include <iostream>
+#include <string>
+
+#include "benchmarks/bench_allocations.h"
+
+using namespace std;
+
+/// \brief Allocations benchmarking program.
+///
+///        allocations [repetitions] [-d drugs] [-l languages] [-o output]
+///
+///        repetitions  Number of repetitions of each measure (10 by default).
+///        -d           Folder of the drug models (../../tucuxi-drugs/drugfiles by default).
+///        -l           Folder of the translations files (../language by default).
+///        -o           Folder of the exported reports (benchmark_output by default).
+/// \date 19/10/2026
+/// \author Herzig Melvyn
+int main(int argc, char** argv)
+{
+
+    unsigned nbRepetitions = 10;
+    string drugPath = "../../tucuxi-drugs/drugfiles";
+    string languagePath = "../language";
+    string outputPath = "benchmark_output";
+
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+
+        if (arg.size() == 2 && arg[0] == '-' && i + 1 < argc) {
+            string value = argv[++i];
+            switch (arg[1]) {
+            case 'd': drugPath = value; break;
+            case 'l': languagePath = value; break;
+            case 'o': outputPath = value; break;
+            default:
+                cerr << "Unknown option " << arg << endl;
+                return 1;
+            }
+        } else if (i == 1 && arg.find_first_not_of("0123456789") == string::npos) {
+            nbRepetitions = unsigned(stoul(arg));
+        } else {
+            cerr << "Invalid argument " << arg << endl;
+            return 1;
+        }
+    }
+
+    BenchAllocations benchAllocations(drugPath, languagePath, outputPath);
+    benchAllocations.run(nbRepetitions);
+
+    return 0;
+}
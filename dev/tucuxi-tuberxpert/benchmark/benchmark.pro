@@ -0,0 +1,53 @@
+TEMPLATE = app
+CONFIG += console c++17
+CONFIG -= app_bundle
+CONFIG -= qt
+
+unix {
+    LIBS += -lpthread
+}
+
+win32 {
+    include(../../tucuxi-core/make/qtcreator/tinyjs.pri)
+}
+
+include(../../tucuxi-core/make/qtcreator/general.pri)
+include(../../tucuxi-core/make/qtcreator/tucucommon.pri)
+include(../../tucuxi-core/make/qtcreator/tucucore.pri)
+include(../../tucuxi-core/make/qtcreator/tucuquery.pri)
+include(../src/tuberxpert/tuberxpert.pri)
+
+# The benchmarks reuse the drug models and helpers of the tests.
+INCLUDEPATH += $$PWD/../test
+
+# The synthetic queries are built by the query generator.
+INCLUDEPATH += $$PWD/../generator
+
+SOURCES += \
+        main.cpp \
+        benchmarks/bench_flow.cpp \
+        benchmarks/bench_pointdensity.cpp \
+        benchmarkresults.cpp \
+        benchmarkutils.cpp \
+        ../generator/querygenerator.cpp \
+        ../test/testutils.cpp
+
+!win32 {
+    # Because of Eigen:
+    QMAKE_CXXFLAGS += -Wno-int-in-bool-context
+
+    # Because of macros and clang:
+    QMAKE_CXXFLAGS += -Wno-extra-semi-stmt
+}
+
+DEFINES+= \
+    bench_pointdensity \
+    bench_flow \
+
+HEADERS += \
+    benchmarks/bench_flow.h \
+    benchmarks/bench_pointdensity.h \
+    benchmarkresults.h \
+    benchmarkutils.h \
+    ../generator/querygenerator.h \
+    ../test/testutils.h
@@ -0,0 +1,176 @@
+#include "benchmarkresults.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <numeric>
+
+#include "nlohmann/json.hpp"
+
+using namespace std;
+
+void BenchmarkResults::add(const string& _query, const string& _measure, double _milliseconds)
+{
+    getMeasure(_query, _measure).m_milliseconds.push_back(_milliseconds);
+}
+
+void BenchmarkResults::addFailure(const string& _query, const string& _measure)
+{
+    ++getMeasure(_query, _measure).m_nbFailures;
+}
+
+void BenchmarkResults::print(ostream& _output) const
+{
+    _output << left << setw(32) << "query"
+            << setw(28) << "measure"
+            << right << setw(8) << "count"
+            << setw(10) << "failures"
+            << setw(12) << "min [ms]"
+            << setw(12) << "median"
+            << setw(12) << "p90"
+            << setw(12) << "p99"
+            << setw(12) << "mean" << endl;
+
+    for (const Measure& measure : m_measures) {
+        Statistics statistics = computeStatistics(measure.m_milliseconds);
+
+        _output << left << setw(32) << measure.m_query
+                << setw(28) << measure.m_name
+                << right << setw(8) << measure.m_milliseconds.size()
+                << setw(10) << measure.m_nbFailures
+                << fixed << setprecision(3)
+                << setw(12) << statistics.m_min
+                << setw(12) << statistics.m_median
+                << setw(12) << statistics.m_p90
+                << setw(12) << statistics.m_p99
+                << setw(12) << statistics.m_mean << endl;
+    }
+}
+
+bool BenchmarkResults::exportToJson(const string& _fileName, unsigned _nbRepetitions) const
+{
+    nlohmann::json results = nlohmann::json::array();
+
+    for (const Measure& measure : m_measures) {
+        Statistics statistics = computeStatistics(measure.m_milliseconds);
+
+        results.push_back({
+            {"query", measure.m_query},
+            {"measure", measure.m_name},
+            {"count", measure.m_milliseconds.size()},
+            {"failures", measure.m_nbFailures},
+            {"min_ms", statistics.m_min},
+            {"median_ms", statistics.m_median},
+            {"p90_ms", statistics.m_p90},
+            {"p99_ms", statistics.m_p99},
+            {"mean_ms", statistics.m_mean}
+        });
+    }
+
+    nlohmann::json document = {
+        {"repetitions", _nbRepetitions},
+        {"results", results}
+    };
+
+    ofstream file(_fileName);
+    if (!file) {
+        return false;
+    }
+
+    file << document.dump(4) << endl;
+    return bool(file);
+}
+
+bool BenchmarkResults::compareTo(const string& _baselineFileName, double _regressionThreshold, ostream& _output) const
+{
+    ifstream file(_baselineFileName);
+    if (!file) {
+        return false;
+    }
+
+    // Medians of the previous run, by query and measure.
+    map<pair<string, string>, double> baselineMedians;
+    try {
+        nlohmann::json document = nlohmann::json::parse(file);
+        for (const nlohmann::json& result : document.at("results")) {
+            baselineMedians[{result.at("query").get<string>(), result.at("measure").get<string>()}] =
+                    result.at("median_ms").get<double>();
+        }
+    } catch (const nlohmann::json::exception&) {
+        return false;
+    }
+
+    _output << left << setw(32) << "query"
+            << setw(28) << "measure"
+            << right << setw(14) << "baseline [ms]"
+            << setw(14) << "current [ms]"
+            << setw(12) << "change" << endl;
+
+    unsigned nbRegressions = 0;
+    for (const Measure& measure : m_measures) {
+        auto baselineMedian = baselineMedians.find({measure.m_query, measure.m_name});
+        if (baselineMedian == baselineMedians.end() || measure.m_milliseconds.empty()) {
+            continue;
+        }
+
+        double median = computeStatistics(measure.m_milliseconds).m_median;
+        double change = baselineMedian->second == 0 ? 0 : (median - baselineMedian->second) / baselineMedian->second * 100;
+
+        _output << left << setw(32) << measure.m_query
+                << setw(28) << measure.m_name
+                << right << fixed << setprecision(3)
+                << setw(14) << baselineMedian->second
+                << setw(14) << median
+                << setprecision(1) << setw(11) << showpos << change << noshowpos << "%";
+
+        if (change > _regressionThreshold) {
+            _output << "  slower";
+            ++nbRegressions;
+        }
+        _output << endl;
+    }
+
+    _output << nbRegressions << " measure(s) slower by more than " << _regressionThreshold << "%" << endl;
+    return true;
+}
+
+BenchmarkResults::Measure& BenchmarkResults::getMeasure(const string& _query, const string& _measure)
+{
+    auto it = find_if(m_measures.begin(), m_measures.end(), [&](const Measure& _m) {
+        return _m.m_query == _query && _m.m_name == _measure;
+    });
+
+    if (it != m_measures.end()) {
+        return *it;
+    }
+
+    m_measures.push_back({_query, _measure, {}, 0});
+    return m_measures.back();
+}
+
+BenchmarkResults::Statistics BenchmarkResults::computeStatistics(vector<double> _milliseconds)
+{
+    if (_milliseconds.empty()) {
+        return {0, 0, 0, 0, 0};
+    }
+
+    sort(_milliseconds.begin(), _milliseconds.end());
+
+    return {
+        _milliseconds.front(),
+        percentile(_milliseconds, 50),
+        percentile(_milliseconds, 90),
+        percentile(_milliseconds, 99),
+        accumulate(_milliseconds.begin(), _milliseconds.end(), 0.0) / _milliseconds.size()
+    };
+}
+
+double BenchmarkResults::percentile(const vector<double>& _sortedValues, double _percentile)
+{
+    double rank = _percentile / 100 * (_sortedValues.size() - 1);
+    size_t lower = size_t(rank);
+    size_t upper = min(lower + 1, _sortedValues.size() - 1);
+
+    return _sortedValues[lower] + (rank - lower) * (_sortedValues[upper] - _sortedValues[lower]);
+}
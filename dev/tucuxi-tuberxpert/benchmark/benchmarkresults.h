@@ -0,0 +1,92 @@
+#ifndef BENCHMARKRESULTS_H
+#define BENCHMARKRESULTS_H
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+/// \brief Class that collects the durations measured by a benchmark, per query and per measure
+///        (import, flow step, exporter...), and reports their statistics.
+///
+///        The results can be exported in JSON and compared with the JSON results of a previous
+///        run, for example of another commit, to detect the regressions.
+/// \date 19/10/2026
+/// \author Herzig Melvyn
+class BenchmarkResults
+{
+public:
+
+    /// \brief Add a duration to a measure of a query.
+    /// \param _query Name of the query measured.
+    /// \param _measure Name of the measure.
+    /// \param _milliseconds Duration measured in milliseconds.
+    void add(const std::string& _query, const std::string& _measure, double _milliseconds);
+
+    /// \brief Count a failed execution of a measure of a query. No duration is added.
+    /// \param _query Name of the query measured.
+    /// \param _measure Name of the measure.
+    void addFailure(const std::string& _query, const std::string& _measure);
+
+    /// \brief Print the statistics of each measure as a table.
+    /// \param _output Stream where to print.
+    void print(std::ostream& _output) const;
+
+    /// \brief Export the statistics of each measure in a JSON file.
+    /// \param _fileName Name of the file to write.
+    /// \param _nbRepetitions Number of repetitions of the benchmark, written with the results.
+    /// \return True if the file could be written, otherwise false.
+    bool exportToJson(const std::string& _fileName, unsigned _nbRepetitions) const;
+
+    /// \brief Print the change of the median of each measure with respect to the results of a JSON
+    ///        file exported by a previous run. The measures missing from the file are skipped.
+    /// \param _baselineFileName Name of the JSON file of the previous run.
+    /// \param _regressionThreshold Change in percent above which a measure is reported as slower.
+    /// \param _output Stream where to print.
+    /// \return True if the file could be read, otherwise false.
+    bool compareTo(const std::string& _baselineFileName, double _regressionThreshold, std::ostream& _output) const;
+
+protected:
+
+    /// \brief Durations of a measure of a query.
+    struct Measure
+    {
+        std::string m_query;
+        std::string m_name;
+        std::vector<double> m_milliseconds;
+        unsigned m_nbFailures;
+    };
+
+    /// \brief Statistics of the durations of a measure, in milliseconds.
+    struct Statistics
+    {
+        double m_min;
+        double m_median;
+        double m_p90;
+        double m_p99;
+        double m_mean;
+    };
+
+    /// \brief Get a measure, create it if it does not exist yet.
+    /// \param _query Name of the query measured.
+    /// \param _measure Name of the measure.
+    /// \return The measure.
+    Measure& getMeasure(const std::string& _query, const std::string& _measure);
+
+    /// \brief Compute the statistics of durations.
+    /// \param _milliseconds Durations in milliseconds.
+    /// \return The statistics, all 0 if there is no duration.
+    static Statistics computeStatistics(std::vector<double> _milliseconds);
+
+    /// \brief Get a percentile of sorted values, interpolated between the closest ranks.
+    /// \param _sortedValues Values sorted in ascending order, not empty.
+    /// \param _percentile Percentile to get, between 0 and 100.
+    /// \return The percentile.
+    static double percentile(const std::vector<double>& _sortedValues, double _percentile);
+
+protected:
+
+    /// \brief Measures in the order of their first duration.
+    std::vector<Measure> m_measures;
+};
+
+#endif // BENCHMARKRESULTS_H
@@ -0,0 +1,176 @@
+#include "bench_allocations.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "tuberxpert/computer.h"
+#include "tuberxpert/result/xpertqueryresult.h"
+
+#include "benchmarkutils.h"
+#include "querygenerator.h"
+#include "testutils.h"
+
+using namespace std;
+using namespace Tucuxi;
+
+/// \brief Number of allocations made by the global operator new.
+static atomic<size_t> nbAllocations{0};
+
+// The global operator new is replaced to count the allocations of the whole allocations program.
+// The array and nothrow versions call this one by default.
+
+void* operator new(size_t _size)
+{
+    ++nbAllocations;
+
+    if (void* pointer = malloc(_size == 0 ? 1 : _size)) {
+        return pointer;
+    }
+
+    throw bad_alloc();
+}
+
+void operator delete(void* _pointer) noexcept
+{
+    free(_pointer);
+}
+
+void operator delete(void* _pointer, size_t) noexcept
+{
+    free(_pointer);
+}
+
+/// \brief Tell whether a run of the Computer produced reports.
+/// \param _status Status returned by the Computer.
+/// \return True if at least one xpertRequest succeeded, otherwise false.
+static bool isComputed(Xpert::ComputingStatus _status)
+{
+    return _status != Xpert::ComputingStatus::IMPORT_ERROR && _status != Xpert::ComputingStatus::NO_REQUESTS_SUCCEEDED;
+}
+
+BenchAllocations::BenchAllocations(const string& _drugPath,
+                                   const string& _languagePath,
+                                   const string& _outputPath) :
+    m_drugPath(_drugPath),
+    m_languagePath(_languagePath),
+    m_outputPath(_outputPath)
+{}
+
+size_t BenchAllocations::getNbAllocations()
+{
+    return nbAllocations.load();
+}
+
+void BenchAllocations::run(unsigned _nbRepetitions) const
+{
+    error_code error;
+    filesystem::create_directories(m_outputPath, error);
+
+    cout << "Allocations benchmark (" << _nbRepetitions << " repetitions)" << endl;
+
+    vector<pair<string, string>> queries {{"imatinib_aposteriori", BenchmarkUtils::imatinibAposterioriQueryString}};
+
+    // Synthetic imatinib queries whose dosage history, samples and covariates grow.
+    for (unsigned scale : {1u, 3u, 12u}) {
+        QueryGenerator::Parameters parameters;
+        parameters.m_nbDosageTimeRanges = 30 * scale;
+        parameters.m_nbSamples = 5 * scale;
+        parameters.m_nbCovariates = 2 * scale;
+
+        queries.emplace_back(QueryGenerator::makeName(parameters), QueryGenerator::generate(parameters));
+    }
+
+    for (const pair<string, string>& query : queries) {
+        if (!measureFlow(query.first, query.second, _nbRepetitions)) {
+            cout << left << setw(40) << query.first << "failed" << endl;
+        } else if (!measureComputer(query.second, _nbRepetitions)) {
+            cout << left << setw(40) << "  computeFromString" << "failed" << endl;
+        }
+        cout << endl;
+    }
+}
+
+bool BenchAllocations::measureFlow(const string& _name, const string& _query, unsigned _nbRepetitions) const
+{
+    const Xpert::GeneralXpertFlowStepProvider& provider = TestUtils::flowStepProvider;
+
+    const vector<pair<string, const Xpert::AbstractXpertFlowStep*>> steps {
+        {"covariateValidatorAndModelSelector", provider.getCovariateValidatorAndModelSelector().get()},
+        {"doseValidator", provider.getDoseValidator().get()},
+        {"sampleValidator", provider.getSampleValidator().get()},
+        {"targetValidator", provider.getTargetValidator().get()},
+        {"adjustmentTraitCreator", provider.getAdjustmentTraitCreator().get()},
+        {"requestExecutor", provider.getRequestExecutor().get()}
+    };
+
+    map<string, size_t> stepAllocations;
+    unique_ptr<Xpert::XpertQueryResult> xpertQueryResult;
+
+    for (unsigned repetition = 0; repetition < _nbRepetitions; ++repetition) {
+
+        // The environment preparation is not measured.
+        try {
+            TestUtils::setupEnv(_query, TestUtils::originalImatinibModelString, xpertQueryResult);
+        } catch (const runtime_error&) {
+            return false;
+        }
+        Xpert::XpertRequestResult& xpertRequestResult = xpertQueryResult->getXpertRequestResults()[0];
+
+        for (const pair<string, const Xpert::AbstractXpertFlowStep*>& step : steps) {
+            size_t before = getNbAllocations();
+            step.second->perform(xpertRequestResult);
+            stepAllocations[step.first] += getNbAllocations() - before;
+
+            if (!xpertRequestResult.shouldContinueProcessing()) {
+                cout << xpertRequestResult.getErrorMessage() << endl;
+                return false;
+            }
+        }
+    }
+
+    cout << _name << endl;
+    cout << left << setw(40) << "  step" << right << setw(14) << "allocations" << endl;
+    for (const pair<string, const Xpert::AbstractXpertFlowStep*>& step : steps) {
+        cout << left << setw(40) << "  " + step.first
+             << right << setw(14) << (_nbRepetitions == 0 ? 0 : stepAllocations[step.first] / _nbRepetitions) << endl;
+    }
+
+    return true;
+}
+
+bool BenchAllocations::measureComputer(const string& _query, unsigned _nbRepetitions) const
+{
+    // The first run loads the translations and fills the caches of the program, it is not measured.
+    if (!isComputed(Xpert::Computer().computeFromString(m_drugPath, _query, m_outputPath, m_languagePath))) {
+        return false;
+    }
+
+    for (bool isArenaUsed : {true, false}) {
+        Xpert::Computer computer(isArenaUsed);
+        size_t nbAllocations = 0;
+
+        for (unsigned repetition = 0; repetition < _nbRepetitions; ++repetition) {
+            size_t before = getNbAllocations();
+            Xpert::ComputingStatus status = computer.computeFromString(m_drugPath, _query, m_outputPath, m_languagePath);
+            nbAllocations += getNbAllocations() - before;
+
+            if (!isComputed(status)) {
+                return false;
+            }
+        }
+
+        cout << left << setw(40) << (isArenaUsed ? "  computeFromString (arena)" : "  computeFromString (heap)")
+             << right << setw(14) << (_nbRepetitions == 0 ? 0 : nbAllocations / _nbRepetitions) << endl;
+    }
+
+    return true;
+}
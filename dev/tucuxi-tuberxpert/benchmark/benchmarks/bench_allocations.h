@@ -0,0 +1,68 @@
+#ifndef BENCH_ALLOCATIONS_H
+#define BENCH_ALLOCATIONS_H
+
+#include <cstddef>
+#include <string>
+
+/// \brief Benchmark of the heap allocations made while an xpertRequest goes through the flow.
+///
+///        The global operator new of the allocations program is replaced to count the allocations.
+///        This benchmark has its own program (allocations.pro) so that the replacement does not
+///        affect the timings of the other benchmarks.
+///
+///        Each query, an imatinib query and synthetic queries of growing size, is measured in two ways:
+///        - Each flow step is executed and its mean number of allocations is reported.
+///        - The whole Computer::computeFromString is executed with the arena of the XpertRequestResult
+///          and with the flow steps results allocated one by one on the heap. The difference of the
+///          mean numbers of allocations is what the arena saves on a full run.
+/// \date 19/10/2026
+/// \author Herzig Melvyn
+class BenchAllocations
+{
+public:
+
+    /// \brief Constructor.
+    /// \param _drugPath Path to the folder containing the drug models.
+    /// \param _languagePath Path to the folder containing the translations files.
+    /// \param _outputPath Path to the folder where the reports are exported, created if needed.
+    BenchAllocations(const std::string& _drugPath,
+                     const std::string& _languagePath,
+                     const std::string& _outputPath);
+
+    /// \brief Run the benchmark and print the results on the standard output.
+    /// \param _nbRepetitions Number of executions per query.
+    void run(unsigned _nbRepetitions) const;
+
+    /// \brief Get the number of allocations made by the global operator new since the program start.
+    /// \return The number of allocations.
+    static size_t getNbAllocations();
+
+protected:
+
+    /// \brief Execute the flow steps on a query and print their mean number of allocations.
+    /// \param _name Name of the query.
+    /// \param _query Content of the query.
+    /// \param _nbRepetitions Number of executions.
+    /// \return True if all the executions succeeded, otherwise false.
+    bool measureFlow(const std::string& _name, const std::string& _query, unsigned _nbRepetitions) const;
+
+    /// \brief Execute Computer::computeFromString on a query, with and without the arena,
+    ///        and print their mean number of allocations.
+    /// \param _query Content of the query.
+    /// \param _nbRepetitions Number of executions of each.
+    /// \return True if all the executions succeeded, otherwise false.
+    bool measureComputer(const std::string& _query, unsigned _nbRepetitions) const;
+
+protected:
+
+    /// \brief Path to the folder containing the drug models.
+    const std::string m_drugPath;
+
+    /// \brief Path to the folder containing the translations files.
+    const std::string m_languagePath;
+
+    /// \brief Path to the folder where the reports are exported.
+    const std::string m_outputPath;
+};
+
+#endif // BENCH_ALLOCATIONS_H
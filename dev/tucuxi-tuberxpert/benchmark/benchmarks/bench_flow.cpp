@@ -0,0 +1,246 @@
+#include "bench_flow.h"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+
+#include "tucucommon/componentmanager.h"
+
+#include "tuberxpert/computer.h"
+#include "tuberxpert/exporter/xpertrequestresulthtmlexport.h"
+#include "tuberxpert/exporter/xpertrequestresultpdfexport.h"
+#include "tuberxpert/exporter/xpertrequestresultxmlexport.h"
+#include "tuberxpert/flow/xpertflowstepproviderregistry.h"
+#include "tuberxpert/language/languagemanager.h"
+#include "tuberxpert/query/xpertqueryimport.h"
+#include "tuberxpert/result/xpertqueryresult.h"
+#include "tuberxpert/utils/xpertutils.h"
+
+#include "benchmarkutils.h"
+#include "querygenerator.h"
+
+using namespace std;
+using namespace Tucuxi;
+
+BenchFlow::BenchFlow(const string& _drugPath,
+                     const string& _queryPath,
+                     const string& _languagePath,
+                     const string& _outputPath,
+                     bool _isPdfExported) :
+    m_drugPath(_drugPath),
+    m_queryPath(_queryPath),
+    m_languagePath(_languagePath),
+    m_outputPath(_outputPath),
+    m_isPdfExported(_isPdfExported)
+{}
+
+void BenchFlow::run(unsigned _nbRepetitions, BenchmarkResults& _results) const
+{
+    error_code error;
+    filesystem::create_directories(m_outputPath, error);
+
+    vector<pair<string, string>> queries = loadQueries();
+
+    cout << "Flow benchmark (" << _nbRepetitions << " repetitions, " << queries.size() << " queries)" << endl;
+
+    // The drug models of the step measures are loaded once, like in a long running process.
+    auto drugModelRepository =
+            dynamic_cast<Core::DrugModelRepository*>(Core::DrugModelRepository::createComponent());
+    drugModelRepository->addFolderPath(m_drugPath);
+
+    for (const pair<string, string>& query : queries) {
+        cout << "  " << query.first << endl;
+
+        for (unsigned repetition = 0; repetition < _nbRepetitions; ++repetition) {
+            measureComputer(query.first, query.second, _results);
+            measureSteps(query.first, query.second, drugModelRepository, _results);
+        }
+    }
+
+    cout << endl;
+}
+
+vector<pair<string, string>> BenchFlow::loadQueries() const
+{
+    vector<pair<string, string>> queries;
+
+    // The sample queries, in the order of their names.
+    error_code error;
+    vector<filesystem::path> queryFiles;
+    for (const filesystem::directory_entry& entry : filesystem::directory_iterator(m_queryPath, error)) {
+        if (entry.is_regular_file() && entry.path().extension() == ".tqf") {
+            queryFiles.push_back(entry.path());
+        }
+    }
+    sort(queryFiles.begin(), queryFiles.end());
+
+    for (const filesystem::path& queryFile : queryFiles) {
+        ifstream file(queryFile);
+        queries.emplace_back(queryFile.stem().string(),
+                             string((istreambuf_iterator<char>(file)), istreambuf_iterator<char>()));
+    }
+
+    if (queries.empty()) {
+        cout << "No query found in " << m_queryPath << endl;
+    }
+
+    // The synthetic queries, scaled in dosage history, samples, covariates, targets and xpertRequests.
+    for (unsigned scale : {1u, 3u, 12u}) {
+        QueryGenerator::Parameters parameters;
+        parameters.m_nbXpertRequests = scale;
+        parameters.m_nbDrugs = 1;
+        parameters.m_nbDosageTimeRanges = 30 * scale;
+        parameters.m_nbSamples = 5 * scale;
+        parameters.m_nbCovariates = 2 * scale;
+        parameters.m_nbTargets = 1;
+
+        queries.emplace_back(QueryGenerator::makeName(parameters), QueryGenerator::generate(parameters));
+    }
+
+    return queries;
+}
+
+void BenchFlow::measureComputer(const string& _name, const string& _query, BenchmarkResults& _results) const
+{
+    const string MEASURE = "computeFromString";
+
+    Xpert::Computer computer;
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    Xpert::ComputingStatus status = computer.computeFromString(m_drugPath, _query, m_outputPath, m_languagePath);
+    double milliseconds = BenchmarkUtils::elapsedMilliseconds(start);
+
+    if (status == Xpert::ComputingStatus::IMPORT_ERROR || status == Xpert::ComputingStatus::NO_REQUESTS_SUCCEEDED) {
+        _results.addFailure(_name, MEASURE);
+    } else {
+        _results.add(_name, MEASURE, milliseconds);
+    }
+}
+
+void BenchFlow::measureSteps(const string& _name,
+                             const string& _query,
+                             Core::DrugModelRepository* _drugModelRepository,
+                             BenchmarkResults& _results) const
+{
+    // Computer::computeFromString unregisters its own repository, it is registered again for each measure.
+    Common::ComponentManager* pCmpMgr = Common::ComponentManager::getInstance();
+    pCmpMgr->registerComponent("DrugModelRepository", _drugModelRepository);
+
+    // Import.
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+    unique_ptr<Xpert::XpertQueryData> query = nullptr;
+    Xpert::XpertQueryImport importer;
+    Xpert::XpertQueryImport::Status importResult = importer.importFromString(query, _query);
+
+    if (importResult != Xpert::XpertQueryImport::Status::Ok) {
+        _results.addFailure(_name, "import");
+        pCmpMgr->unregisterComponent("DrugModelRepository");
+        return;
+    }
+    _results.add(_name, "import", BenchmarkUtils::elapsedMilliseconds(start));
+
+    // Extraction of the treatments of the xpertRequests.
+    start = chrono::steady_clock::now();
+    Xpert::XpertQueryResult xpertQueryResult(move(query), m_outputPath);
+    _results.add(_name, "extraction", BenchmarkUtils::elapsedMilliseconds(start));
+
+    // Durations of the xpertRequests, summed by measure.
+    map<string, double> milliseconds;
+    map<string, bool> failures;
+
+    for (Xpert::XpertRequestResult& xpertRequestResult : xpertQueryResult.getXpertRequestResults()) {
+
+        xpertQueryResult.incrementRequestIndexBeingProcessed();
+
+        if (!xpertRequestResult.shouldContinueProcessing()) {
+            failures["extraction"] = true;
+            continue;
+        }
+
+        shared_ptr<const Xpert::AbstractXpertFlowStepProvider> provider =
+                Xpert::XpertFlowStepProviderRegistry::getInstance().getProvider(xpertRequestResult.getXpertRequest().getDrugId());
+
+        // Translations, as loaded by the computer for each xpertRequest.
+        start = chrono::steady_clock::now();
+        ifstream translationsFile(m_languagePath + "/" + Xpert::outputLangToString(xpertRequestResult.getXpertRequest().getOutputLang()) + ".xml");
+        if (translationsFile.fail()) {
+            failures["translations"] = true;
+            continue;
+        }
+        try {
+            Xpert::LanguageManager::getInstance().loadTranslations(
+                        string((istreambuf_iterator<char>(translationsFile)), istreambuf_iterator<char>()));
+        } catch (const runtime_error&) {
+            failures["translations"] = true;
+            continue;
+        }
+        milliseconds["translations"] += BenchmarkUtils::elapsedMilliseconds(start);
+
+        // Flow steps, until the report printing.
+        const vector<pair<string, const Xpert::AbstractXpertFlowStep*>> steps {
+            {"covariateValidatorAndModelSelector", provider->getCovariateValidatorAndModelSelector().get()},
+            {"doseValidator", provider->getDoseValidator().get()},
+            {"sampleValidator", provider->getSampleValidator().get()},
+            {"targetValidator", provider->getTargetValidator().get()},
+            {"adjustmentTraitCreator", provider->getAdjustmentTraitCreator().get()},
+            {"requestExecutor", provider->getRequestExecutor().get()}
+        };
+
+        bool isSuccessful = true;
+        for (const pair<string, const Xpert::AbstractXpertFlowStep*>& step : steps) {
+            start = chrono::steady_clock::now();
+            step.second->perform(xpertRequestResult);
+            milliseconds[step.first] += BenchmarkUtils::elapsedMilliseconds(start);
+
+            if (!xpertRequestResult.shouldContinueProcessing()) {
+                failures[step.first] = true;
+                isSuccessful = false;
+                break;
+            }
+        }
+
+        if (!isSuccessful) {
+            continue;
+        }
+
+        // Exporters. Every format is exported, the file extension stays the one of the requested format.
+        vector<pair<string, unique_ptr<Xpert::AbstractXpertRequestResultExport>>> exporters;
+        exporters.emplace_back("xmlExport", make_unique<Xpert::XpertRequestResultXmlExport>());
+        exporters.emplace_back("htmlExport", make_unique<Xpert::XpertRequestResultHtmlExport>());
+        exporters.emplace_back("htmlSvgExport", make_unique<Xpert::XpertRequestResultHtmlExport>(Xpert::GraphBackend::SVG));
+        if (m_isPdfExported) {
+            exporters.emplace_back("pdfExport", make_unique<Xpert::XpertRequestResultPdfExport>(
+                                       make_unique<Xpert::XpertRequestResultHtmlExport>(Xpert::GraphBackend::SVG)));
+        }
+
+        for (pair<string, unique_ptr<Xpert::AbstractXpertRequestResultExport>>& exporter : exporters) {
+            start = chrono::steady_clock::now();
+            exporter.second->exportToFile(xpertRequestResult);
+            milliseconds[exporter.first] += BenchmarkUtils::elapsedMilliseconds(start);
+
+            if (!xpertRequestResult.shouldContinueProcessing()) {
+                failures[exporter.first] = true;
+                break;
+            }
+        }
+    }
+
+    pCmpMgr->unregisterComponent("DrugModelRepository");
+
+    // A failed measure is counted once per query, its duration is not kept.
+    for (const pair<const string, double>& measure : milliseconds) {
+        if (!failures[measure.first]) {
+            _results.add(_name, measure.first, measure.second);
+        }
+    }
+    for (const pair<const string, bool>& failure : failures) {
+        if (failure.second) {
+            _results.addFailure(_name, failure.first);
+        }
+    }
+}
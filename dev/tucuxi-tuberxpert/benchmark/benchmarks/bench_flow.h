@@ -0,0 +1,86 @@
+#ifndef BENCH_FLOW_H
+#define BENCH_FLOW_H
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "tucucore/drugmodelrepository.h"
+
+#include "benchmarkresults.h"
+
+/// \brief End-to-end benchmark of the TuberXpert flow.
+///
+///        Each query is measured in two ways:
+///        - "computeFromString": the whole Computer::computeFromString, as run by the command line,
+///          including the loading of the drug models and the export in the requested format.
+///        - The import, the extraction of the XpertQueryResult, the loading of the translations,
+///          each flow step and each exporter (xml, html with JavaScript or svg graphs, pdf)
+///          separately. The durations of the xpertRequests of a query are summed.
+///
+///        The queries are the .tqf files of the query directory, for example written by the
+///        generator, and a few synthetic queries of growing size.
+/// \date 19/10/2026
+/// \author Herzig Melvyn
+class BenchFlow
+{
+public:
+
+    /// \brief Constructor.
+    /// \param _drugPath Path to the folder containing the drug models.
+    /// \param _queryPath Path to the folder containing the .tqf queries.
+    /// \param _languagePath Path to the folder containing the translations files.
+    /// \param _outputPath Path to the folder where the reports are exported, created if needed.
+    /// \param _isPdfExported True to measure the pdf exporter, it requires wkhtmltopdf.
+    BenchFlow(const std::string& _drugPath,
+              const std::string& _queryPath,
+              const std::string& _languagePath,
+              const std::string& _outputPath,
+              bool _isPdfExported);
+
+    /// \brief Run the benchmark.
+    /// \param _nbRepetitions Number of executions per query.
+    /// \param _results Results where to add the measures.
+    void run(unsigned _nbRepetitions, BenchmarkResults& _results) const;
+
+protected:
+
+    /// \brief Get the queries to measure with their names.
+    /// \return The name and the content of each query.
+    std::vector<std::pair<std::string, std::string>> loadQueries() const;
+
+    /// \brief Measure Computer::computeFromString on a query.
+    /// \param _name Name of the query.
+    /// \param _query Content of the query.
+    /// \param _results Results where to add the measure.
+    void measureComputer(const std::string& _name, const std::string& _query, BenchmarkResults& _results) const;
+
+    /// \brief Measure the import, the extraction, each flow step and each exporter on a query.
+    /// \param _name Name of the query.
+    /// \param _query Content of the query.
+    /// \param _drugModelRepository Repository of the drug models, registered during the measure.
+    /// \param _results Results where to add the measures.
+    void measureSteps(const std::string& _name,
+                      const std::string& _query,
+                      Tucuxi::Core::DrugModelRepository* _drugModelRepository,
+                      BenchmarkResults& _results) const;
+
+protected:
+
+    /// \brief Path to the folder containing the drug models.
+    const std::string m_drugPath;
+
+    /// \brief Path to the folder containing the .tqf queries.
+    const std::string m_queryPath;
+
+    /// \brief Path to the folder containing the translations files.
+    const std::string m_languagePath;
+
+    /// \brief Path to the folder where the reports are exported.
+    const std::string m_outputPath;
+
+    /// \brief True to measure the pdf exporter.
+    const bool m_isPdfExported;
+};
+
+#endif // BENCH_FLOW_H
@@ -0,0 +1,103 @@
+#include "bench_pointdensity.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "benchmarkutils.h"
+#include "testutils.h"
+
+using namespace std;
+using namespace Tucuxi;
+
+void BenchPointDensity::run(unsigned _nbRepetitions) const
+{
+    // Configurations to compare. The first one is the reference.
+    vector<pair<string, Xpert::PointDensity>> configurations {
+        {"fixed 20 pts/h (reference)", Xpert::PointDensity(20)},
+        {"fixed 5 pts/h", Xpert::PointDensity(5)},
+        {"adaptive 60 pts/half-life [2, 20]", Xpert::PointDensity(60, 2, 20)},
+        {"adaptive 120 pts/half-life [4, 20]", Xpert::PointDensity(120, 4, 20)},
+        {"adaptive 60 pts/half-life 240 pts/cycle", Xpert::PointDensity(60, 2, 20, 240)}
+    };
+
+    cout << "Point density benchmark (" << _nbRepetitions << " repetitions)" << endl;
+    cout << left << setw(42) << "configuration"
+         << right << setw(12) << "mean [ms]"
+         << setw(12) << "peak [%]"
+         << setw(14) << "residual [%]"
+         << setw(12) << "auc24 [%]" << endl;
+
+    Core::CycleStats referenceStats;
+
+    for (size_t i = 0; i < configurations.size(); ++i) {
+
+        const Xpert::PointDensity& pointDensity = configurations[i].second;
+        Xpert::GeneralXpertFlowStepProvider provider(pointDensity, pointDensity, pointDensity);
+
+        double meanMilliseconds = 0;
+        Core::CycleStats cycleStats;
+        if (!measure(provider, _nbRepetitions, meanMilliseconds, cycleStats)) {
+            cout << left << setw(42) << configurations[i].first << "failed" << endl;
+
+            // Without the reference, there is nothing to compare the other configurations to.
+            if (i == 0) {
+                cout << endl;
+                return;
+            }
+            continue;
+        }
+
+        if (i == 0) {
+            referenceStats = cycleStats;
+        }
+
+        cout << left << setw(42) << configurations[i].first
+             << right << fixed << setprecision(2) << setw(12) << meanMilliseconds
+             << setw(12) << BenchmarkUtils::relativeErrorInPercent(BenchmarkUtils::getStatistic(cycleStats, Core::CycleStatisticType::Peak),
+                                                                   BenchmarkUtils::getStatistic(referenceStats, Core::CycleStatisticType::Peak))
+             << setw(14) << BenchmarkUtils::relativeErrorInPercent(BenchmarkUtils::getStatistic(cycleStats, Core::CycleStatisticType::Residual),
+                                                                   BenchmarkUtils::getStatistic(referenceStats, Core::CycleStatisticType::Residual))
+             << setw(12) << BenchmarkUtils::relativeErrorInPercent(BenchmarkUtils::getStatistic(cycleStats, Core::CycleStatisticType::AUC24),
+                                                                   BenchmarkUtils::getStatistic(referenceStats, Core::CycleStatisticType::AUC24))
+             << endl;
+    }
+
+    cout << endl;
+}
+
+bool BenchPointDensity::measure(const Xpert::GeneralXpertFlowStepProvider& _provider,
+                                unsigned _nbRepetitions,
+                                double& _meanMilliseconds,
+                                Core::CycleStats& _cycleStats) const
+{
+    double totalMilliseconds = 0;
+
+    for (unsigned repetition = 0; repetition < _nbRepetitions; ++repetition) {
+
+        // The environment preparation is not measured.
+        unique_ptr<Xpert::XpertQueryResult> xpertQueryResult;
+        TestUtils::setupEnv(BenchmarkUtils::imatinibAposterioriQueryString, TestUtils::originalImatinibModelString, xpertQueryResult);
+        Xpert::XpertRequestResult& xpertRequestResult = xpertQueryResult->getXpertRequestResults()[0];
+
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+        _provider.getSampleValidator()->perform(xpertRequestResult);
+        _provider.getAdjustmentTraitCreator()->perform(xpertRequestResult);
+        _provider.getRequestExecutor()->perform(xpertRequestResult);
+
+        totalMilliseconds += BenchmarkUtils::elapsedMilliseconds(start);
+
+        if (!xpertRequestResult.shouldContinueProcessing()) {
+            cout << xpertRequestResult.getErrorMessage() << endl;
+            return false;
+        }
+
+        _cycleStats = xpertRequestResult.getCycleStats();
+    }
+
+    _meanMilliseconds = _nbRepetitions == 0 ? 0 : totalMilliseconds / _nbRepetitions;
+    return true;
+}
@@ -0,0 +1,40 @@
+#ifndef BENCH_POINTDENSITY_H
+#define BENCH_POINTDENSITY_H
+
+#include <string>
+
+#include "tuberxpert/flow/general/generalxpertflowstepprovider.h"
+#include "tuberxpert/utils/pointdensity.h"
+
+/// \brief Benchmark of the point densities used by the computing flow steps
+///        (SampleValidator, AdjustmentTraitCreator and RequestExecutor).
+///
+///        For each configuration, the three steps are executed on an imatinib a posteriori request.
+///        The mean time is reported with the relative error of the steady state statistics (peak,
+///        residual and AUC24) with respect to the fixed 20 points per hour reference. If the
+///        reference fails, the benchmark stops.
+/// \date 19/10/2026
+/// \author Herzig Melvyn
+class BenchPointDensity
+{
+public:
+
+    /// \brief Run the benchmark and print the results on the standard output.
+    /// \param _nbRepetitions Number of executions per configuration.
+    void run(unsigned _nbRepetitions) const;
+
+protected:
+
+    /// \brief Execute the computing steps of a provider and measure them.
+    /// \param _provider Provider whose steps are executed.
+    /// \param _nbRepetitions Number of executions.
+    /// \param _meanMilliseconds Resulting mean time of an execution.
+    /// \param _cycleStats Resulting steady state statistics of the last execution.
+    /// \return True if all the executions succeeded, otherwise false.
+    bool measure(const Tucuxi::Xpert::GeneralXpertFlowStepProvider& _provider,
+                 unsigned _nbRepetitions,
+                 double& _meanMilliseconds,
+                 Tucuxi::Core::CycleStats& _cycleStats) const;
+};
+
+#endif // BENCH_POINTDENSITY_H
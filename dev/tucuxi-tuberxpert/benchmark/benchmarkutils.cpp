@@ -0,0 +1,108 @@
+#include "benchmarkutils.h"
+
+#include <cmath>
+
+using namespace std;
+using namespace Tucuxi;
+
+const string BenchmarkUtils::imatinibAposterioriQueryString = R"(<?xml version="1.0" encoding="UTF-8" standalone="no"?>
+                                    <query version="1.0"
+                                        xmlns:xsi="http://www.w3.org/2001/XMLSchema-instance"
+                                        xsi:noNamespaceSchemaLocation="tuberxpert_computing_query.xsd">
+
+                                        <date>2018-07-07T13:00:00</date> <!-- Date the xml has been sent -->
+
+                                        <drugTreatment>
+                                            <!-- All the information regarding the patient -->
+                                            <patient>
+                                                <covariates>
+                                                </covariates>
+                                            </patient>
+                                            <!-- List of the drugs informations we have concerning the patient -->
+                                            <drugs>
+                                                <!-- All the information regarding the drug -->
+                                                <drug>
+                                                    <drugId>imatinib</drugId>
+                                                    <activePrinciple>something</activePrinciple>
+                                                    <brandName>somebrand</brandName>
+                                                    <atc>something</atc>
+                                                    <!-- All the information regarding the treatment -->
+                                                    <treatment>
+                                                        <dosageHistory>
+                                                            <dosageTimeRange>
+                                                                <start>2018-07-06T08:00:00</start>
+                                                                <end>2018-07-08T08:00:00</end>
+                                                                <dosage>
+                                                                    <dosageLoop>
+                                                                        <lastingDosage>
+                                                                            <interval>12:00:00</interval>
+                                                                            <dose>
+                                                                                <value>400</value>
+                                                                                <unit>mg</unit>
+                                                                                <infusionTimeInMinutes>60</infusionTimeInMinutes>
+                                                                            </dose>
+                                                                            <formulationAndRoute>
+                                                                                <formulation>parenteralSolution</formulation>
+                                                                                <administrationName>foo bar</administrationName>
+                                                                                <administrationRoute>oral</administrationRoute>
+                                                                                <absorptionModel>extravascular</absorptionModel>
+                                                                            </formulationAndRoute>
+                                                                        </lastingDosage>
+                                                                    </dosageLoop>
+                                                                </dosage>
+                                                            </dosageTimeRange>
+                                                        </dosageHistory>
+                                                    </treatment>
+                                                    <!-- Samples history -->
+                                                    <samples>
+                                                        <sample>
+                                                            <sampleId>123456</sampleId>
+                                                            <sampleDate>2018-07-07T06:00:30</sampleDate>
+                                                            <concentrations>
+                                                                <concentration>
+                                                                    <analyteId>imatinib</analyteId>
+                                                                    <value>0.7</value>
+                                                                    <unit>mg/l</unit>
+                                                                </concentration>
+                                                            </concentrations>
+                                                        </sample>
+                                                    </samples>
+                                                    <!-- Personalised targets -->
+                                                    <targets>
+                                                    </targets>
+                                                </drug>
+                                            </drugs>
+                                        </drugTreatment>
+                                        <!-- List of the requests we want the server to take care of -->
+                                        <requests>
+                                            <xpertRequest>
+                                                <drugId>imatinib</drugId>
+                                                <output>
+                                                    <format>xml</format>
+                                                    <language>en</language>
+                                                </output>
+                                            </xpertRequest>
+                                        </requests>
+                                    </query>)";
+
+double BenchmarkUtils::elapsedMilliseconds(const chrono::steady_clock::time_point& _start)
+{
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - _start).count();
+}
+
+double BenchmarkUtils::getStatistic(const Core::CycleStats& _cycleStats, Core::CycleStatisticType _type)
+{
+    double value = -1.0;
+    Common::DateTime date;
+    _cycleStats.getStatistic(0, _type).getValue(date, value);
+    return value;
+}
+
+double BenchmarkUtils::relativeErrorInPercent(double _value, double _reference)
+{
+    if (_reference == 0) {
+        return 0;
+    }
+
+    return fabs(_value - _reference) / fabs(_reference) * 100;
+}
@@ -0,0 +1,38 @@
+#ifndef BENCHMARKUTILS_H
+#define BENCHMARKUTILS_H
+
+#include <chrono>
+#include <string>
+
+#include "tucucore/computingservice/computingresponse.h"
+
+/// \brief Class that regroups common elements used by several benchmarks.
+/// \date 19/10/2026
+/// \author Herzig Melvyn
+class BenchmarkUtils
+{
+public:
+
+    /// \brief Imatinib query with a dosage history and a sample, so that every
+    ///        computing step of the flow is executed (a posteriori).
+    static const std::string imatinibAposterioriQueryString;
+
+    /// \brief Get the elapsed time in milliseconds since a given time point.
+    /// \param _start Time point to measure from.
+    /// \return The elapsed milliseconds.
+    static double elapsedMilliseconds(const std::chrono::steady_clock::time_point& _start);
+
+    /// \brief Get a statistic value of the first analyte in the given cycle statistics.
+    /// \param _cycleStats Cycle statistics to read.
+    /// \param _type Statistic to get.
+    /// \return The statistic value, -1 if it is not found.
+    static double getStatistic(const Tucuxi::Core::CycleStats& _cycleStats, Tucuxi::Core::CycleStatisticType _type);
+
+    /// \brief Get the relative error in percent of a value with respect to a reference.
+    /// \param _value Value to evaluate.
+    /// \param _reference Reference value.
+    /// \return The relative error in percent, 0 if the reference is 0.
+    static double relativeErrorInPercent(double _value, double _reference);
+};
+
+#endif // BENCHMARKUTILS_H
@@ -0,0 +1,107 @@
+#include <iostream>
+#include <string>
+
+#include "benchmarkresults.h"
+
+#if defined(bench_pointdensity)
+#include "benchmarks/bench_pointdensity.h"
+#endif
+
+#if defined(bench_flow)
+#include "benchmarks/bench_flow.h"
+#endif
+
+
+using namespace std;
+
+/// \brief Benchmarking program.
+///
+///        benchmark [repetitions] [-d drugs] [-q queries] [-l languages] [-o output]
+///                  [-j results.json] [-b baseline.json] [--no-pdf]
+///
+///        repetitions  Number of repetitions of each measure (10 by default).
+///        -d           Folder of the drug models (../../tucuxi-drugs/drugfiles by default).
+///        -q           Folder of the .tqf queries of the flow benchmark (../xml/query by default).
+///        -l           Folder of the translations files (../language by default).
+///        -o           Folder of the exported reports (benchmark_output by default).
+///        -j           JSON file where to export the results of the flow benchmark.
+///        -b           JSON file of a previous run to compare the medians with.
+///        --no-pdf     Do not measure the pdf exporter, for example without wkhtmltopdf.
+/// \date 19/10/2026
+/// \author Herzig Melvyn
+int main(int argc, char** argv)
+{
+
+    unsigned nbRepetitions = 10;
+    string drugPath = "../../tucuxi-drugs/drugfiles";
+    string queryPath = "../xml/query";
+    string languagePath = "../language";
+    string outputPath = "benchmark_output";
+    string jsonFileName;
+    string baselineFileName;
+    bool isPdfExported = true;
+
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+
+        if (arg == "--no-pdf") {
+            isPdfExported = false;
+        } else if (arg.size() == 2 && arg[0] == '-' && i + 1 < argc) {
+            string value = argv[++i];
+            switch (arg[1]) {
+            case 'd': drugPath = value; break;
+            case 'q': queryPath = value; break;
+            case 'l': languagePath = value; break;
+            case 'o': outputPath = value; break;
+            case 'j': jsonFileName = value; break;
+            case 'b': baselineFileName = value; break;
+            default:
+                cerr << "Unknown option " << arg << endl;
+                return 1;
+            }
+        } else if (i == 1 && arg.find_first_not_of("0123456789") == string::npos) {
+            nbRepetitions = unsigned(stoul(arg));
+        } else {
+            cerr << "Invalid argument " << arg << endl;
+            return 1;
+        }
+    }
+
+    /***********************************************************
+     *                       PointDensity                      *
+     ***********************************************************/
+
+#if defined(bench_pointdensity)
+    BenchPointDensity benchPointDensity;
+    benchPointDensity.run(nbRepetitions);
+#endif
+
+    /***********************************************************
+     *                           Flow                          *
+     ***********************************************************/
+
+#if defined(bench_flow)
+    BenchmarkResults results;
+
+    BenchFlow benchFlow(drugPath, queryPath, languagePath, outputPath, isPdfExported);
+    benchFlow.run(nbRepetitions, results);
+
+    results.print(cout);
+
+    if (!jsonFileName.empty()) {
+        if (!results.exportToJson(jsonFileName, nbRepetitions)) {
+            cerr << "Could not write " << jsonFileName << endl;
+        }
+    }
+
+    if (!baselineFileName.empty()) {
+        cout << endl;
+        if (!results.compareTo(baselineFileName, 10, cout)) {
+            cerr << "Could not read " << baselineFileName << endl;
+        }
+    }
+#endif
+
+
+    return 0;
+}
@@ -0,0 +1,14 @@
+TEMPLATE = app
+CONFIG += console c++17
+CONFIG -= app_bundle
+CONFIG -= qt
+
+SOURCES += \
+        main.cpp \
+        querygenerator.cpp
+
+HEADERS += \
+    querygenerator.h
+
+OTHER_FILES += \
+    ../xml/query/tuberxpert_computing_query.xsd \
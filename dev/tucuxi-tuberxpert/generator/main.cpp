@@ -0,0 +1,134 @@
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "querygenerator.h"
+
+using namespace std;
+
+/// \brief Parse a comma separated list of unsigned values.
+/// \param _list List to parse, for example "30,90,365".
+/// \param _values Values parsed.
+/// \return True if the list is valid, otherwise false.
+static bool parseList(const string& _list, vector<unsigned>& _values)
+{
+    _values.clear();
+
+    stringstream stream(_list);
+    string value;
+    while (getline(stream, value, ',')) {
+        if (value.empty() || value.find_first_not_of("0123456789") != string::npos) {
+            return false;
+        }
+        _values.push_back(unsigned(stoul(value)));
+    }
+
+    return !_values.empty();
+}
+
+/// \brief Synthetic query generator.
+///
+///        generator [-o output] [-r xpertRequests] [-d drugs] [-t dosageTimeRanges] [-p repeats]
+///                  [-s samples] [-c covariates] [-g targets]
+///
+///        -o  Folder where to write the queries (current folder by default).
+///        -r  Number of xpertRequests (1 by default).
+///        -d  Number of drugs (1 by default, at most 2).
+///        -t  Number of dosage time ranges per drug (1 by default).
+///        -p  Number of repetitions of the dose per time range, 0 for a one day loop (0 by default).
+///        -s  Number of samples per drug (0 by default).
+///        -c  Number of bodyweight covariates (0 by default).
+///        -g  Number of targets per drug (0 by default, at most 4).
+///
+///        Each number can be a comma separated list, a query is written for each combination
+///        in a file named after its parameters, for example:
+///
+///            generator -o scaling -t 10,30,100,365 -s 5
+///
+///        writes four queries whose dosage history grows, that the benchmark reads with -q scaling.
+/// \date 19/10/2026
+/// \author Herzig Melvyn
+int main(int argc, char** argv)
+{
+    string outputPath = ".";
+    vector<unsigned> nbXpertRequests {1};
+    vector<unsigned> nbDrugs {1};
+    vector<unsigned> nbDosageTimeRanges {1};
+    vector<unsigned> nbRepeats {0};
+    vector<unsigned> nbSamples {0};
+    vector<unsigned> nbCovariates {0};
+    vector<unsigned> nbTargets {0};
+
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+
+        if (arg.size() != 2 || arg[0] != '-' || i + 1 >= argc) {
+            cerr << "Invalid argument " << arg << endl;
+            return 1;
+        }
+
+        string value = argv[++i];
+        if (arg[1] == 'o') {
+            outputPath = value;
+            continue;
+        }
+
+        vector<unsigned>* values = nullptr;
+        switch (arg[1]) {
+        case 'r': values = &nbXpertRequests; break;
+        case 'd': values = &nbDrugs; break;
+        case 't': values = &nbDosageTimeRanges; break;
+        case 'p': values = &nbRepeats; break;
+        case 's': values = &nbSamples; break;
+        case 'c': values = &nbCovariates; break;
+        case 'g': values = &nbTargets; break;
+        default:
+            cerr << "Unknown option " << arg << endl;
+            return 1;
+        }
+
+        if (!parseList(value, *values)) {
+            cerr << "Invalid list " << value << " for option " << arg << endl;
+            return 1;
+        }
+    }
+
+    unsigned nbQueries = 0;
+
+    for (unsigned xpertRequests : nbXpertRequests) {
+    for (unsigned drugs : nbDrugs) {
+    for (unsigned dosageTimeRanges : nbDosageTimeRanges) {
+    for (unsigned repeats : nbRepeats) {
+    for (unsigned samples : nbSamples) {
+    for (unsigned covariates : nbCovariates) {
+    for (unsigned targets : nbTargets) {
+
+        QueryGenerator::Parameters parameters;
+        parameters.m_nbXpertRequests = xpertRequests;
+        parameters.m_nbDrugs = drugs;
+        parameters.m_nbDosageTimeRanges = dosageTimeRanges;
+        parameters.m_nbRepeats = repeats;
+        parameters.m_nbSamples = samples;
+        parameters.m_nbCovariates = covariates;
+        parameters.m_nbTargets = targets;
+
+        string fileName = outputPath + "/" + QueryGenerator::makeName(parameters) + ".tqf";
+
+        ofstream file(fileName);
+        file << QueryGenerator::generate(parameters);
+
+        if (!file) {
+            cerr << "Could not write " << fileName << endl;
+            return 1;
+        }
+
+        cout << fileName << endl;
+        ++nbQueries;
+    }}}}}}}
+
+    cout << nbQueries << " queries generated" << endl;
+
+    return 0;
+}
@@ -0,0 +1,258 @@
+#include "querygenerator.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <sstream>
+
+using namespace std;
+
+/// \brief Target types used by the generator, with their unit and their best value relative
+///        to the typical residual concentration of the drug.
+static const struct {
+    const char* m_type;
+    const char* m_unit;
+    double m_factor;
+} TARGET_TYPES[] = {
+    {"residual", "mg/l", 1},
+    {"peak", "mg/l", 3},
+    {"mean", "mg/l", 2},
+    {"auc", "mg*h/l", 40}
+};
+
+string QueryGenerator::generate(Parameters _parameters)
+{
+    clamp(_parameters);
+
+    const vector<Drug> drugs(getDrugs().begin(), getDrugs().begin() + _parameters.m_nbDrugs);
+
+    // The longest dosage history gives the query date.
+    unsigned historyDurationInHours = 0;
+    for (const Drug& drug : drugs) {
+        historyDurationInHours = max(historyDurationInHours,
+                                     _parameters.m_nbDosageTimeRanges * getTimeRangeDurationInHours(_parameters, drug));
+    }
+
+    stringstream query;
+    query << R"(<?xml version="1.0" encoding="UTF-8" standalone="no"?>
+<query version="1.0" xmlns:xsi="http://www.w3.org/2001/XMLSchema-instance" xsi:noNamespaceSchemaLocation="tuberxpert_computing_query.xsd">
+    <date>)" << hoursToDate(historyDurationInHours + 5) << R"(</date>
+    <drugTreatment>
+        <patient>
+            <covariates>
+)";
+
+    // The bodyweight measures are spread over the history.
+    for (unsigned covariate = 0; covariate < _parameters.m_nbCovariates; ++covariate) {
+        query << R"(                <covariate>
+                    <covariateId>bodyweight</covariateId>
+                    <date>)" << hoursToDate(historyDurationInHours * covariate / _parameters.m_nbCovariates) << R"(</date>
+                    <value>)" << 60 + covariate % 10 << R"(</value>
+                    <unit>kg</unit>
+                    <dataType>double</dataType>
+                    <nature>discrete</nature>
+                </covariate>
+)";
+    }
+
+    query << R"(            </covariates>
+        </patient>
+        <drugs>
+)";
+
+    for (const Drug& drug : drugs) {
+        unsigned timeRangeDurationInHours = getTimeRangeDurationInHours(_parameters, drug);
+
+        query << R"(            <drug>
+                <drugId>)" << drug.m_drugId << R"(</drugId>
+                <activePrinciple>something</activePrinciple>
+                <brandName>somebrand</brandName>
+                <atc>something</atc>
+                <treatment>
+                    <dosageHistory>
+)";
+
+        for (unsigned timeRange = 0; timeRange < _parameters.m_nbDosageTimeRanges; ++timeRange) {
+            query << R"(                        <dosageTimeRange>
+                            <start>)" << hoursToDate(timeRange * timeRangeDurationInHours) << R"(</start>
+                            <end>)" << hoursToDate((timeRange + 1) * timeRangeDurationInHours) << R"(</end>
+                            <dosage>
+)";
+
+            if (_parameters.m_nbRepeats == 0) {
+                query << "                                <dosageLoop>\n";
+            } else {
+                query << "                                <dosageRepeat>\n"
+                      << "                                    <iterations>" << _parameters.m_nbRepeats << "</iterations>\n";
+            }
+
+            query << R"(                                    <lastingDosage>
+                                        <interval>)" << (drug.m_intervalInHours < 10 ? "0" : "") << drug.m_intervalInHours << R"(:00:00</interval>
+                                        <dose>
+                                            <value>)" << drug.m_dose << R"(</value>
+                                            <unit>mg</unit>
+                                            <infusionTimeInMinutes>60</infusionTimeInMinutes>
+                                        </dose>
+                                        <formulationAndRoute>
+                                            <formulation>parenteralSolution</formulation>
+                                            <administrationName>foo bar</administrationName>
+                                            <administrationRoute>oral</administrationRoute>
+                                            <absorptionModel>extravascular</absorptionModel>
+                                        </formulationAndRoute>
+                                    </lastingDosage>
+)";
+
+            query << (_parameters.m_nbRepeats == 0 ? "                                </dosageLoop>\n"
+                                                   : "                                </dosageRepeat>\n");
+
+            query << R"(                            </dosage>
+                        </dosageTimeRange>
+)";
+        }
+
+        query << R"(                    </dosageHistory>
+                </treatment>
+)";
+
+        // The samples are taken one hour before the last doses, the last one at the end of the history.
+        unsigned nbDoses = _parameters.m_nbDosageTimeRanges * timeRangeDurationInHours / drug.m_intervalInHours;
+        unsigned nbSamples = min(_parameters.m_nbSamples, nbDoses);
+
+        if (nbSamples > 0) {
+            query << "                <samples>\n";
+        }
+
+        for (unsigned sample = 0; sample < nbSamples; ++sample) {
+            unsigned dose = nbDoses - nbSamples + sample + 1;
+            query << R"(                    <sample>
+                        <sampleId>)" << sample + 1 << R"(</sampleId>
+                        <sampleDate>)" << hoursToDate(dose * drug.m_intervalInHours - 1) << R"(</sampleDate>
+                        <concentrations>
+                            <concentration>
+                                <analyteId>)" << drug.m_drugId << R"(</analyteId>
+                                <value>)" << drug.m_concentration * (0.8 + 0.1 * (sample % 5)) << R"(</value>
+                                <unit>mg/l</unit>
+                            </concentration>
+                        </concentrations>
+                    </sample>
+)";
+        }
+
+        if (nbSamples > 0) {
+            query << "                </samples>\n";
+        }
+
+        // Each target has its own type, two targets of the same type are rejected by the target validator.
+        if (_parameters.m_nbTargets > 0) {
+            query << "                <targets>\n";
+        }
+
+        for (unsigned target = 0; target < _parameters.m_nbTargets; ++target) {
+            double best = drug.m_concentration * TARGET_TYPES[target].m_factor;
+            query << R"(                    <target>
+                        <activeMoietyId>)" << drug.m_drugId << R"(</activeMoietyId>
+                        <targetType>)" << TARGET_TYPES[target].m_type << R"(</targetType>
+                        <unit>)" << TARGET_TYPES[target].m_unit << R"(</unit>
+                        <min>)" << best * 0.75 << R"(</min>
+                        <best>)" << best << R"(</best>
+                        <max>)" << best * 1.25 << R"(</max>
+                        <inefficacyAlarm>)" << best * 0.5 << R"(</inefficacyAlarm>
+                        <toxicityAlarm>)" << best * 2 << R"(</toxicityAlarm>
+                    </target>
+)";
+        }
+
+        if (_parameters.m_nbTargets > 0) {
+            query << "                </targets>\n";
+        }
+
+        query << "            </drug>\n";
+    }
+
+    query << R"(        </drugs>
+    </drugTreatment>
+    <requests>
+)";
+
+    for (unsigned request = 0; request < _parameters.m_nbXpertRequests; ++request) {
+        query << R"(        <xpertRequest>
+            <drugId>)" << drugs[request % drugs.size()].m_drugId << R"(</drugId>
+            <output>
+                <format>xml</format>
+                <language>en</language>
+            </output>
+        </xpertRequest>
+)";
+    }
+
+    query << R"(    </requests>
+</query>
+)";
+
+    return query.str();
+}
+
+string QueryGenerator::makeName(const Parameters& _parameters)
+{
+    return "synthetic_r" + to_string(_parameters.m_nbXpertRequests) +
+            "_d" + to_string(_parameters.m_nbDrugs) +
+            "_t" + to_string(_parameters.m_nbDosageTimeRanges) +
+            "_p" + to_string(_parameters.m_nbRepeats) +
+            "_s" + to_string(_parameters.m_nbSamples) +
+            "_c" + to_string(_parameters.m_nbCovariates) +
+            "_g" + to_string(_parameters.m_nbTargets);
+}
+
+unsigned QueryGenerator::getMaxNbDrugs()
+{
+    return unsigned(getDrugs().size());
+}
+
+unsigned QueryGenerator::getMaxNbTargets()
+{
+    return unsigned(sizeof(TARGET_TYPES) / sizeof(TARGET_TYPES[0]));
+}
+
+void QueryGenerator::clamp(Parameters& _parameters)
+{
+    _parameters.m_nbXpertRequests = max(_parameters.m_nbXpertRequests, 1u);
+    _parameters.m_nbDrugs = min(max(_parameters.m_nbDrugs, 1u), getMaxNbDrugs());
+    _parameters.m_nbDosageTimeRanges = max(_parameters.m_nbDosageTimeRanges, 1u);
+    _parameters.m_nbTargets = min(_parameters.m_nbTargets, getMaxNbTargets());
+}
+
+unsigned QueryGenerator::getTimeRangeDurationInHours(const Parameters& _parameters, const Drug& _drug)
+{
+    return _parameters.m_nbRepeats == 0 ? 24 : _parameters.m_nbRepeats * _drug.m_intervalInHours;
+}
+
+string QueryGenerator::hoursToDate(unsigned _hours)
+{
+    // The history starts on 2018-01-01 at 08:00.
+    _hours += 8;
+
+    // Days since 2018-01-01 to civil date, from Howard Hinnant's days_from_civil inverse.
+    long z = 17532 + long(_hours / 24) + 719468;
+    long era = z / 146097;
+    long doe = z - era * 146097;
+    long yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    long y = yoe + era * 400;
+    long doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    long mp = (5 * doy + 2) / 153;
+    long d = doy - (153 * mp + 2) / 5 + 1;
+    long m = mp < 10 ? mp + 3 : mp - 9;
+    y += m <= 2 ? 1 : 0;
+
+    char date[64];
+    snprintf(date, sizeof(date), "%04ld-%02ld-%02ldT%02u:00:00", y, m, d, _hours % 24);
+    return date;
+}
+
+const vector<QueryGenerator::Drug>& QueryGenerator::getDrugs()
+{
+    static const vector<Drug> drugs {
+        {"imatinib", 400, 12, 0.9},
+        {"rifampicin", 600, 24, 7}
+    };
+
+    return drugs;
+}
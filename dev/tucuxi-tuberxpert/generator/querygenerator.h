@@ -0,0 +1,108 @@
+#ifndef QUERYGENERATOR_H
+#define QUERYGENERATOR_H
+
+#include <string>
+#include <vector>
+
+/// \brief Class that generates synthetic queries, valid against tuberxpert_computing_query.xsd,
+///        whose size is driven by parameters. It is used to measure how the flow scales with
+///        the size of the patient's history.
+///
+///        The generated query contains:
+///        - for each drug, a dosage history of consecutive time ranges, each made of a dosage
+///          repeated a given number of times (or a dosage loop over one day), samples taken
+///          before the last doses and personalised targets of different types,
+///        - bodyweight covariates spread over the history,
+///        - xpertRequests asking for an xml report, assigned to the drugs in turn.
+///
+///        The drugs are taken from the ones supported by the TuberXpert sample queries,
+///        the imatinib and the rifampicin.
+/// \date 19/10/2026
+/// \author Herzig Melvyn
+class QueryGenerator
+{
+public:
+
+    /// \brief Parameters of a generated query.
+    struct Parameters
+    {
+        /// \brief Number of xpertRequests, at least 1.
+        unsigned m_nbXpertRequests = 1;
+
+        /// \brief Number of drugs, between 1 and getMaxNbDrugs().
+        unsigned m_nbDrugs = 1;
+
+        /// \brief Number of dosage time ranges per drug, at least 1.
+        unsigned m_nbDosageTimeRanges = 1;
+
+        /// \brief Number of repetitions of the dose in each dosage time range. 0 for a dosage loop
+        ///        lasting one day.
+        unsigned m_nbRepeats = 0;
+
+        /// \brief Number of samples per drug, at most one per dose.
+        unsigned m_nbSamples = 0;
+
+        /// \brief Number of bodyweight covariates.
+        unsigned m_nbCovariates = 0;
+
+        /// \brief Number of targets per drug, at most getMaxNbTargets().
+        unsigned m_nbTargets = 0;
+    };
+
+    /// \brief Generate a query.
+    /// \param _parameters Parameters of the query, clamped to their limits.
+    /// \return The query string.
+    static std::string generate(Parameters _parameters);
+
+    /// \brief Get a name that identifies the parameters of a query, usable as a file name.
+    /// \param _parameters Parameters of the query.
+    /// \return The name, for example "synthetic_r1_d1_t30_p0_s5_c0_g0".
+    static std::string makeName(const Parameters& _parameters);
+
+    /// \brief Get the maximum number of drugs of a query.
+    /// \return The number of drugs known by the generator.
+    static unsigned getMaxNbDrugs();
+
+    /// \brief Get the maximum number of targets per drug.
+    /// \return The number of target types used by the generator.
+    static unsigned getMaxNbTargets();
+
+protected:
+
+    /// \brief Drug known by the generator.
+    struct Drug
+    {
+        /// \brief Drug identifier, also used as analyte and active moiety identifier.
+        std::string m_drugId;
+
+        /// \brief Dose in mg.
+        double m_dose;
+
+        /// \brief Interval between two doses in hours, dividing 24.
+        unsigned m_intervalInHours;
+
+        /// \brief Typical residual concentration in mg/l.
+        double m_concentration;
+    };
+
+    /// \brief Clamp the parameters to their limits.
+    /// \param _parameters Parameters to clamp.
+    static void clamp(Parameters& _parameters);
+
+    /// \brief Get the duration of a dosage time range of a drug.
+    /// \param _parameters Parameters of the query.
+    /// \param _drug Drug of the dosage history.
+    /// \return The duration in hours.
+    static unsigned getTimeRangeDurationInHours(const Parameters& _parameters, const Drug& _drug);
+
+    /// \brief Format a date of the generated history.
+    /// \param _hours Number of hours since the start of the history, on 2018-01-01 at 08:00.
+    /// \return The date in the xs:dateTime format.
+    static std::string hoursToDate(unsigned _hours);
+
+    /// \brief Get the drugs known by the generator.
+    /// \return The drugs.
+    static const std::vector<Drug>& getDrugs();
+};
+
+#endif // QUERYGENERATOR_H
@@ -2,6 +2,8 @@
 #include "tucucommon/utils.h"
 
 #include "tuberxpert/computer.h"
+#include "tuberxpert/flow/xpertflowstepproviderregistry.h"
+#include "tuberxpert/utils/flowstepcache.h"
 #include "cxxopts/include/cxxopts.hpp"
 
 using namespace std;
@@ -32,8 +34,9 @@ const int CODE_NO_REQUESTS_SUCCEEDED = 2;
 /// \param inputFileName String value to store parsed input file path.
 /// \param outputPath String value to store parsed output file path.
 /// \param languagePath String value to store the location of the folder containing the translation files.
+/// \param cachePath String value to store the location of the folder keeping the flow step outputs between runs.
 /// \return true if parsing went ok otherwise false.
-bool parse(int argc, char* argv[], string& drugPath, string& inputFileName, string& outputPath, string& languagePath)
+bool parse(int argc, char* argv[], string& drugPath, string& inputFileName, string& outputPath, string& languagePath, string& cachePath)
 {
     Tucuxi::Common::LoggerHelper logHelper;
 
@@ -47,6 +50,7 @@ bool parse(int argc, char* argv[], string& drugPath, string& inputFileName, stri
                 ("i,input", "Input request file path", cxxopts::value<string>())
                 ("o,outputpath", "Output report directory path", cxxopts::value<string>())
                 ("l,languagepath", "Translations files directory path", cxxopts::value<string>())
+                ("c,cachepath", "Flow step outputs directory path, reused by the next runs", cxxopts::value<string>())
                 ("help", "Print help");
 
 
@@ -88,10 +92,15 @@ bool parse(int argc, char* argv[], string& drugPath, string& inputFileName, stri
             languagePath = result["languagepath"].as<string>();
         }
 
+        if (result.count("cachepath") > 0) {
+            cachePath = result["cachepath"].as<string>();
+        }
+
         logHelper.info("Drugs directory : {}", drugPath);
         logHelper.info("Input file : {}", inputFileName);
         logHelper.info("Output directory : {}", outputPath);
         logHelper.info("Language directory : {}", languagePath);
+        logHelper.info("Cache directory : {}", cachePath);
 
         return true;
     }
@@ -108,9 +117,9 @@ bool parse(int argc, char* argv[], string& drugPath, string& inputFileName, stri
 int main(int argc, char** argv)
 {
     // Parsing program arguments
-    string drugPath, inputFileName, outputPath;
+    string drugPath, inputFileName, outputPath, cachePath;
     string languagePath = "../language";
-    bool allGood = parse(argc, argv, drugPath, inputFileName, outputPath, languagePath);
+    bool allGood = parse(argc, argv, drugPath, inputFileName, outputPath, languagePath, cachePath);
     if(not allGood){
         return CODE_BAD_ARGUMENTS_ERROR;
     }
@@ -126,6 +135,14 @@ int main(int argc, char** argv)
     logHelper.info("********************************************************");
     logHelper.info("Tuberxpert console application is starting up...");
 
+    // Create the flow step providers once, they are shared by all the requests.
+    Tucuxi::Xpert::XpertFlowStepProviderRegistry::getInstance();
+
+    // Keep the flow step outputs between runs, if requested.
+    if (!Tucuxi::Xpert::FlowStepCache::getInstance().setDirectory(cachePath)) {
+        logHelper.warn("The cache directory cannot be used, the flow step outputs are not kept: {}", cachePath);
+    }
+
     // Computation start
     Tucuxi::Xpert::Computer xpertComputer;
     Tucuxi::Xpert::ComputingStatus result = xpertComputer.computeFromFile(drugPath, inputFileName, outputPath, languagePath);
@@ -10,14 +10,19 @@
 #include "tuberxpert/query/xpertqueryimport.h"
 #include "tuberxpert/query/xpertquerydata.h"
 #include "tuberxpert/result/xpertqueryresult.h"
+#include "tuberxpert/utils/flowstepcache.h"
 #include "tuberxpert/utils/xpertutils.h"
-#include "tuberxpert/flow/general/generalxpertflowstepprovider.h"
+#include "tuberxpert/flow/xpertflowstepproviderregistry.h"
 
 using namespace std;
 
 namespace Tucuxi {
 namespace Xpert {
 
+Computer::Computer(bool _isArenaUsed) :
+    m_isArenaUsed(_isArenaUsed)
+{}
+
 ComputingStatus Computer::computeFromFile(const std::string& _drugPath,
                                           const std::string& _inputFileName,
                                           const std::string& _outputPath,
@@ -57,6 +62,11 @@ ComputingStatus Computer::computeFromString(
 
     drugModelRepository->addFolderPath(_drugPath);
 
+    // The flow step outputs kept between runs depend on the content of the drug models.
+    if (FlowStepCache::getInstance().isEnabled()) {
+        FlowStepCache::getInstance().registerDrugModelFolder(_drugPath);
+    }
+
     /*********************************************************************************
      *                               Query importation                               *
      * *******************************************************************************/
@@ -72,7 +82,7 @@ ComputingStatus Computer::computeFromString(
         return ComputingStatus::IMPORT_ERROR;
     }
 
-    XpertQueryResult xpertQueryResult(move(query), _outputPath);
+    XpertQueryResult xpertQueryResult(move(query), _outputPath, m_isArenaUsed);
 
     /*********************************************************************************
      *                             For each xpert request                            *
@@ -86,12 +96,12 @@ ComputingStatus Computer::computeFromString(
                        to_string(xpertQueryResult.incrementRequestIndexBeingProcessed() + 1)); // +1 because it starts from 0
 
 
-        // Get the XpertFlowStepProvider for the drug of the request.
-        unique_ptr<AbstractXpertFlowStepProvider> xpertFlowStepProvider(nullptr);
-        getXpertFlowStepProvider(xpertRequestResult.getXpertRequest().getDrugId(), xpertFlowStepProvider);
+        // Get the shared XpertFlowStepProvider for the drug of the request.
+        shared_ptr<const AbstractXpertFlowStepProvider> xpertFlowStepProvider =
+                XpertFlowStepProviderRegistry::getInstance().getProvider(xpertRequestResult.getXpertRequest().getDrugId());
 
         // Execute each step provided by the selected XpertFlowStepProvider.
-        executeFlow(xpertRequestResult, _languagePath, xpertFlowStepProvider);
+        executeFlow(xpertRequestResult, _languagePath, *xpertFlowStepProvider);
         if (xpertRequestResult.shouldContinueProcessing() == false) {
             logHelper.error(xpertRequestResult.getErrorMessage());
             ++nbUnfulfilledRequest;
@@ -120,7 +130,7 @@ ComputingStatus Computer::computeFromString(
 
 void Computer::executeFlow(XpertRequestResult& _xpertRequestResult,
                            const string& _languagePath,
-                           const unique_ptr<AbstractXpertFlowStepProvider>& _stepProvider) const
+                           const AbstractXpertFlowStepProvider& _stepProvider) const
 {
 
     Common::LoggerHelper logHelper;
@@ -175,7 +185,7 @@ void Computer::executeFlow(XpertRequestResult& _xpertRequestResult,
      * ************************************************************/
     logHelper.info("Validating covariates and selecting drug model...");
 
-    _stepProvider->getCovariateValidatorAndModelSelector()->perform(_xpertRequestResult);
+    _stepProvider.getCovariateValidatorAndModelSelector()->perform(_xpertRequestResult);
 
     // Check if the model selection was successful.
     if (_xpertRequestResult.shouldContinueProcessing() == false) {
@@ -190,7 +200,7 @@ void Computer::executeFlow(XpertRequestResult& _xpertRequestResult,
      * ************************************************************/
     logHelper.info("Validating doses...");
 
-    _stepProvider->getDoseValidator()->perform(_xpertRequestResult);
+    _stepProvider.getDoseValidator()->perform(_xpertRequestResult);
 
     // Check if the doses validation was successful.
     if (_xpertRequestResult.shouldContinueProcessing() == false) {
@@ -205,7 +215,7 @@ void Computer::executeFlow(XpertRequestResult& _xpertRequestResult,
      * ************************************************************/
     logHelper.info("Validating samples...");
 
-    _stepProvider->getSampleValidator()->perform(_xpertRequestResult);
+    _stepProvider.getSampleValidator()->perform(_xpertRequestResult);
 
     // Check if the samples validation was successful.
     if (_xpertRequestResult.shouldContinueProcessing() == false) {
@@ -220,7 +230,7 @@ void Computer::executeFlow(XpertRequestResult& _xpertRequestResult,
      * ************************************************************/
     logHelper.info("Validating targets...");
 
-    _stepProvider->getTargetValidator()->perform(_xpertRequestResult);
+    _stepProvider.getTargetValidator()->perform(_xpertRequestResult);
 
     // Check if targets validation was successful.
     if (_xpertRequestResult.shouldContinueProcessing() == false) {
@@ -234,7 +244,7 @@ void Computer::executeFlow(XpertRequestResult& _xpertRequestResult,
      * ************************************************************/
     logHelper.info("Creating adjustment trait...");
 
-    _stepProvider->getAdjustmentTraitCreator()->perform(_xpertRequestResult);
+    _stepProvider.getAdjustmentTraitCreator()->perform(_xpertRequestResult);
 
     // Check if the adjustment trait creation was successful.
     if (_xpertRequestResult.shouldContinueProcessing() == false) {
@@ -249,7 +259,7 @@ void Computer::executeFlow(XpertRequestResult& _xpertRequestResult,
     logHelper.info("Submission of the adjustment request...");
 
     // Check if the submission of the adjustment request was successful.
-    _stepProvider->getRequestExecutor()->perform(_xpertRequestResult);
+    _stepProvider.getRequestExecutor()->perform(_xpertRequestResult);
     if (_xpertRequestResult.shouldContinueProcessing() == false) {
         return;
     }
@@ -262,7 +272,7 @@ void Computer::executeFlow(XpertRequestResult& _xpertRequestResult,
     logHelper.info("Generating report...");
 
     // Check if the report generation was successful.
-    _stepProvider->getReportPrinter()->perform(_xpertRequestResult);
+    _stepProvider.getReportPrinter()->perform(_xpertRequestResult);
     if (_xpertRequestResult.shouldContinueProcessing() == false) {
         return;
     }
@@ -273,27 +283,5 @@ void Computer::executeFlow(XpertRequestResult& _xpertRequestResult,
     // any errors during the execution of the flow steps.
 }
 
-void Computer::getXpertFlowStepProvider(const string& _drugId,
-                                        unique_ptr<AbstractXpertFlowStepProvider>& _xpertFlowStepProvider) const
-{
-
-    // The idea is the have this method return a XpertFlowStepProvider for each
-    // drug. If a drug has no specialized XpertFlowStepProvider, the GeneralXpertFlowStepProvider
-    // is returned. For example, like this:
-
-    // if (_drugId == "imatinib") {
-    //     _xpertFlowStepProvider = make_unique<XpertFlow::ImatinibXpertFlowStepProvider>();
-    // } else if (_drugId == "rifampicin") {
-    //     _xpertFlowStepProvider = make_unique<XpertFlow::RifampicinXpertFlowStepProvider>();
-    // } else {
-    //     _xpertFlowStepProvider = make_unique<XpertFlow::GeneralXpertFlowStepProvider>();
-    // }
-
-
-    // But for now, TuberXpert is implemented in a general way.
-    // In future steps, this line should be removed for those commented above.
-    _xpertFlowStepProvider = make_unique<GeneralXpertFlowStepProvider>();
-}
-
 } // namespace Xpert
 } // namespace Tucuxi
@@ -28,6 +28,11 @@ class Computer
 {
 public:
 
+    /// \brief Constructor.
+    /// \param _isArenaUsed True to allocate the flow steps results of each xpertRequest in the arena
+    ///                     of its XpertRequestResult. False is only meant to measure what the arena saves.
+    explicit Computer(bool _isArenaUsed = true);
+
     /// \brief Entry point of the TuberXpert command Line Interface. This method imports
     ///        the query from a file, loads the translation file, and processes each xpertRequest to finally
     ///        print the reports of the successfully processed requests.
@@ -66,13 +71,12 @@ protected:
     /// \param _stepProvider Flow step provider responsible to give the each flow step for a given drug.
     void executeFlow(XpertRequestResult& _xpertRequestResult,
                      const std::string& _languagePath,
-                     const std::unique_ptr<AbstractXpertFlowStepProvider>& _stepProvider) const;
+                     const AbstractXpertFlowStepProvider& _stepProvider) const;
+
+protected:
 
-    /// \brief For a given drug identifier, get the XpertFlowStepProvider that best matches.
-    /// \param _drugId Drug identifier to search for the best AbstractXpertFlowStepProvider.
-    /// \param _xpertFlowStepProvider Unique pointer in which to create the corresponding XpertFlowStepProvider.
-    void getXpertFlowStepProvider(const std::string& _drugId,
-                                  std::unique_ptr<AbstractXpertFlowStepProvider>& _xpertFlowStepProvider) const;
+    /// \brief Whether the flow steps results are allocated in the arena of each XpertRequestResult.
+    const bool m_isArenaUsed;
 };
 
 } // namespace Xpert
@@ -0,0 +1,286 @@
+#include "svgchart.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <sstream>
+
+using namespace std;
+
+namespace Tucuxi {
+namespace Xpert {
+
+/// \brief Margins around the plot area, in pixels, to leave space for the ticks labels.
+static const double MARGIN_LEFT = 60;
+static const double MARGIN_RIGHT = 20;
+static const double MARGIN_TOP = 24;
+static const double MARGIN_BOTTOM = 40;
+
+/// \brief Colors of the graph, close to the ones of graphing.js.
+static const char* const COLOR_BEST_ADJUSTMENT = "#2e7bcf";
+static const char* const COLOR_OTHER_ADJUSTMENT = "#b4b4b4";
+static const char* const COLOR_TARGET = "#3aa757";
+static const char* const COLOR_SAMPLE = "#d9534f";
+static const char* const COLOR_PERCENTILE = "#f0ad4e";
+static const char* const COLOR_GRID = "#e3e3e3";
+static const char* const COLOR_AXIS = "#555555";
+
+/// \brief Escape the characters of a text that have a meaning in XML.
+/// \param _text Text to escape.
+/// \return The escaped text.
+static string escapeXml(const string& _text)
+{
+    string escaped;
+    for (char c : _text) {
+        switch (c) {
+        case '&': escaped += "&amp;"; break;
+        case '<': escaped += "&lt;"; break;
+        case '>': escaped += "&gt;"; break;
+        case '"': escaped += "&quot;"; break;
+        case '\'': escaped += "&apos;"; break;
+        default: escaped += c;
+        }
+    }
+    return escaped;
+}
+
+SvgChart::SvgChart(unsigned _width, unsigned _height) :
+    m_width(_width), m_height(_height)
+{}
+
+string SvgChart::render(const GraphData& _graphData, bool _withAllAdjustments) const
+{
+    const size_t nbCurves = _withAllAdjustments ? _graphData.m_adjustments.size() : min<size_t>(1, _graphData.m_adjustments.size());
+
+    // Only the targets expressed as concentrations share the axis of the curves.
+    vector<const GraphData::Target*> targets;
+    for (const GraphData::Target& target : _graphData.m_targets) {
+        if (target.m_type == "residual" || target.m_type == "peak" || target.m_type == "mean") {
+            targets.push_back(&target);
+        }
+    }
+
+    /***************************************
+     *              Axes bounds            *
+     ***************************************/
+
+    double xMin = _graphData.m_start;
+    double xMax = max(_graphData.m_end, xMin + 1);
+
+    double yMax = 0;
+    for (size_t c = 0; c < nbCurves; ++c) {
+        const GraphData::Curve& curve = _graphData.m_adjustments[c];
+        for (size_t i = 0; i < curve.m_times.size() && i < curve.m_values.size(); ++i) {
+            if (curve.m_times[i] >= xMin && curve.m_times[i] <= xMax) {
+                yMax = max(yMax, curve.m_values[i]);
+            }
+        }
+    }
+    for (const GraphData::Target* target : targets) {
+        yMax = max(yMax, target->m_max);
+    }
+    for (const GraphData::Point& sample : _graphData.m_samples) {
+        yMax = max(yMax, sample.m_value);
+    }
+    for (const GraphData::Band& band : _graphData.m_percentileBands) {
+        for (size_t i = 0; i < band.m_times.size() && i < band.m_highs.size(); ++i) {
+            if (band.m_times[i] >= xMin && band.m_times[i] <= xMax) {
+                yMax = max(yMax, band.m_highs[i]);
+            }
+        }
+    }
+    if (yMax <= 0) {
+        yMax = 1;
+    }
+
+    double yStep = computeTickStep(yMax * 1.05, 6, false);
+    yMax = ceil(yMax * 1.05 / yStep) * yStep;
+
+    double xStep = computeTickStep(xMax - xMin, 8, true);
+
+    // The y step is 1, 2 or 5 times a power of ten, the labels need as many decimals as that power.
+    unsigned yNbDecimals = yStep >= 1 ? 0 : unsigned(ceil(-log10(yStep) - 1e-9));
+
+    const double plotWidth = m_width - MARGIN_LEFT - MARGIN_RIGHT;
+    const double plotHeight = m_height - MARGIN_TOP - MARGIN_BOTTOM;
+
+    auto toX = [&](double _time) { return MARGIN_LEFT + (_time - xMin) / (xMax - xMin) * plotWidth; };
+    auto toY = [&](double _value) { return MARGIN_TOP + plotHeight - _value / yMax * plotHeight; };
+
+    // The clip path must be unique in the page that contains both graphs.
+    const string clipId = _withAllAdjustments ? "clipAllAdj" : "clipBestAdj";
+
+    stringstream svg;
+    svg << "<svg xmlns='http://www.w3.org/2000/svg' width='" << m_width << "' height='" << m_height
+        << "' viewBox='0 0 " << m_width << " " << m_height << "' font-family='sans-serif' font-size='11'>" << endl;
+
+    svg << "<defs><clipPath id='" << clipId << "'><rect x='" << MARGIN_LEFT << "' y='" << MARGIN_TOP
+        << "' width='" << plotWidth << "' height='" << plotHeight << "'/></clipPath></defs>" << endl;
+
+    /***************************************
+     *             Grid and axes           *
+     ***************************************/
+
+    for (double y = 0; y <= yMax + yStep / 2; y += yStep) {
+        string yPixel = formatNumber(toY(y), 1);
+        svg << "<line x1='" << MARGIN_LEFT << "' y1='" << yPixel << "' x2='" << MARGIN_LEFT + plotWidth << "' y2='" << yPixel
+            << "' stroke='" << COLOR_GRID << "'/>"
+            << "<text x='" << MARGIN_LEFT - 6 << "' y='" << yPixel << "' dy='4' text-anchor='end' fill='" << COLOR_AXIS << "'>"
+            << formatNumber(y, yNbDecimals) << "</text>" << endl;
+    }
+
+    for (double x = ceil(xMin / xStep) * xStep; x <= xMax + 1e-9; x += xStep) {
+        string xPixel = formatNumber(toX(x), 1);
+        svg << "<line x1='" << xPixel << "' y1='" << MARGIN_TOP << "' x2='" << xPixel << "' y2='" << MARGIN_TOP + plotHeight
+            << "' stroke='" << COLOR_GRID << "'/>"
+            << "<text x='" << xPixel << "' y='" << MARGIN_TOP + plotHeight + 16 << "' text-anchor='middle' fill='" << COLOR_AXIS << "'>"
+            << formatNumber(x, 1) << "</text>" << endl;
+    }
+
+    svg << "<rect x='" << MARGIN_LEFT << "' y='" << MARGIN_TOP << "' width='" << plotWidth << "' height='" << plotHeight
+        << "' fill='none' stroke='" << COLOR_AXIS << "'/>" << endl;
+
+    // Axes units.
+    svg << "<text x='" << MARGIN_LEFT + plotWidth << "' y='" << m_height - 6 << "' text-anchor='end' fill='" << COLOR_AXIS << "'>h</text>" << endl;
+    svg << "<text x='" << MARGIN_LEFT << "' y='" << MARGIN_TOP - 8 << "' text-anchor='end' fill='" << COLOR_AXIS << "'>"
+        << escapeXml(_graphData.m_unit) << "</text>" << endl;
+
+    // Adjustment date.
+    if (xMin < 0) {
+        string xPixel = formatNumber(toX(0), 1);
+        svg << "<line x1='" << xPixel << "' y1='" << MARGIN_TOP << "' x2='" << xPixel << "' y2='" << MARGIN_TOP + plotHeight
+            << "' stroke='" << COLOR_AXIS << "' stroke-dasharray='2,3'/>" << endl;
+    }
+
+    svg << "<g clip-path='url(#" << clipId << ")'>" << endl;
+
+    /***************************************
+     *                Targets              *
+     ***************************************/
+
+    for (const GraphData::Target* target : targets) {
+        svg << "<rect x='" << MARGIN_LEFT << "' y='" << formatNumber(toY(target->m_max), 1) << "' width='" << plotWidth
+            << "' height='" << formatNumber(toY(target->m_min) - toY(target->m_max), 1)
+            << "' fill='" << COLOR_TARGET << "' fill-opacity='0.12'/>" << endl;
+
+        string yPixel = formatNumber(toY(target->m_best), 1);
+        svg << "<line x1='" << MARGIN_LEFT << "' y1='" << yPixel << "' x2='" << MARGIN_LEFT + plotWidth << "' y2='" << yPixel
+            << "' stroke='" << COLOR_TARGET << "' stroke-dasharray='6,4'/>" << endl;
+    }
+
+    /***************************************
+     *           Percentile bands          *
+     ***************************************/
+
+    // The highs are written forward and the lows backward to close the polygon. The bands
+    // overlap, so the inner ones are darker.
+    for (const GraphData::Band& band : _graphData.m_percentileBands) {
+        size_t nbPoints = min({band.m_times.size(), band.m_lows.size(), band.m_highs.size()});
+        if (nbPoints == 0) {
+            continue;
+        }
+
+        svg << "<polygon fill='" << COLOR_PERCENTILE << "' fill-opacity='0.12' stroke='none' points='";
+        for (size_t i = 0; i < nbPoints; ++i) {
+            svg << formatNumber(toX(band.m_times[i]), 1) << "," << formatNumber(toY(band.m_highs[i]), 1) << " ";
+        }
+        for (size_t i = nbPoints; i-- > 0;) {
+            svg << formatNumber(toX(band.m_times[i]), 1) << "," << formatNumber(toY(band.m_lows[i]), 1) << " ";
+        }
+        svg << "'/>" << endl;
+    }
+
+    /***************************************
+     *                Curves               *
+     ***************************************/
+
+    // The best adjustment is drawn last to be above the others.
+    for (size_t c = nbCurves; c-- > 0;) {
+        const GraphData::Curve& curve = _graphData.m_adjustments[c];
+
+        svg << "<polyline fill='none' stroke-linejoin='round' stroke='" << (c == 0 ? COLOR_BEST_ADJUSTMENT : COLOR_OTHER_ADJUSTMENT)
+            << "' stroke-width='" << (c == 0 ? 2 : 1) << "' points='";
+
+        // Consecutive points that fall in the same pixel column are not written, except the
+        // extrema of the column, to keep the SVG small with dense curves.
+        double lastX = -1;
+        for (size_t i = 0; i < curve.m_times.size() && i < curve.m_values.size(); ++i) {
+            double x = toX(curve.m_times[i]);
+            bool isLast = i + 1 == curve.m_times.size() || i + 1 == curve.m_values.size();
+            bool isExtremum = i > 0 && !isLast &&
+                    (curve.m_values[i] - curve.m_values[i - 1]) * (curve.m_values[i + 1] - curve.m_values[i]) <= 0;
+
+            if (x - lastX >= 0.5 || isLast || isExtremum) {
+                svg << formatNumber(x, 1) << "," << formatNumber(toY(curve.m_values[i]), 1) << " ";
+                lastX = x;
+            }
+        }
+
+        svg << "'/>" << endl;
+    }
+
+    /***************************************
+     *                Samples              *
+     ***************************************/
+
+    for (const GraphData::Point& sample : _graphData.m_samples) {
+        svg << "<circle cx='" << formatNumber(toX(sample.m_time), 1) << "' cy='" << formatNumber(toY(sample.m_value), 1)
+            << "' r='4' fill='" << COLOR_SAMPLE << "' stroke='white'/>" << endl;
+    }
+
+    svg << "</g>" << endl;
+    svg << "</svg>";
+
+    return svg.str();
+}
+
+double SvgChart::computeTickStep(double _range, unsigned _nbTicks, bool _isTime)
+{
+    double rawStep = _range / max(_nbTicks, 1u);
+
+    if (_isTime) {
+        // Steps that keep the ticks on the same hours of the day.
+        static const double steps[] = {1, 2, 3, 6, 12, 24, 48, 72, 96, 168, 336, 672};
+        for (double step : steps) {
+            if (step >= rawStep) {
+                return step;
+            }
+        }
+        return ceil(rawStep / 672) * 672;
+    }
+
+    double magnitude = pow(10, floor(log10(rawStep)));
+    double normalized = rawStep / magnitude;
+
+    if (normalized <= 1) {
+        return magnitude;
+    } else if (normalized <= 2) {
+        return 2 * magnitude;
+    } else if (normalized <= 5) {
+        return 5 * magnitude;
+    }
+    return 10 * magnitude;
+}
+
+string SvgChart::formatNumber(double _value, unsigned _nbDecimals)
+{
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "%.*f", int(_nbDecimals), _value);
+
+    string number = buffer;
+    if (number.find('.') != string::npos) {
+        number.erase(number.find_last_not_of('0') + 1);
+        if (number.back() == '.') {
+            number.pop_back();
+        }
+    }
+
+    if (number == "-0") {
+        number = "0";
+    }
+
+    return number;
+}
+
+} // namespace Xpert
+} // namespace Tucuxi
@@ -0,0 +1,144 @@
+#ifndef SVGCHART_H
+#define SVGCHART_H
+
+#include <string>
+#include <vector>
+
+namespace Tucuxi {
+namespace Xpert {
+
+/// \brief Data of a concentration graph. The times are in hours relative
+///        to the adjustment date, the concentrations are in the unit of the curves.
+/// \date 19/10/2026
+/// \author Herzig Melvyn
+struct GraphData
+{
+    /// \brief Concentration curve of an adjustment.
+    struct Curve
+    {
+        /// \brief Times of the points in hours, in ascending order.
+        std::vector<double> m_times;
+
+        /// \brief Concentrations of the points.
+        std::vector<double> m_values;
+    };
+
+    /// \brief Target of the best adjustment.
+    struct Target
+    {
+        /// \brief Target type, as given by Core::toString(TargetType).
+        std::string m_type;
+
+        /// \brief Minimum value.
+        double m_min;
+
+        /// \brief Best value.
+        double m_best;
+
+        /// \brief Maximum value.
+        double m_max;
+    };
+
+    /// \brief Band between two percentiles, over the cycle around a sample.
+    struct Band
+    {
+        /// \brief Times of the points in hours, in ascending order.
+        std::vector<double> m_times;
+
+        /// \brief Concentrations of the lower percentile.
+        std::vector<double> m_lows;
+
+        /// \brief Concentrations of the higher percentile.
+        std::vector<double> m_highs;
+    };
+
+    /// \brief Measure of a sample.
+    struct Point
+    {
+        /// \brief Time of the sample in hours.
+        double m_time;
+
+        /// \brief Concentration of the sample.
+        double m_value;
+    };
+
+    /// \brief First time displayed in hours, negative when samples are displayed before the adjustment date.
+    double m_start = 0;
+
+    /// \brief Last time displayed in hours.
+    double m_end = 0;
+
+    /// \brief Unit of the concentrations.
+    std::string m_unit;
+
+    /// \brief Curves of the adjustments, the best adjustment first.
+    std::vector<Curve> m_adjustments;
+
+    /// \brief Targets of the best adjustment.
+    std::vector<Target> m_targets;
+
+    /// \brief Samples of the patient.
+    std::vector<Point> m_samples;
+
+    /// \brief Percentile bands around the samples, the outer ones first.
+    std::vector<Band> m_percentileBands;
+};
+
+/// \brief This class renders a GraphData in an inline SVG element. It replaces the canvas
+///        graph drawn by graphing.js when the report must not depend on JavaScript, for
+///        example for the PDF export where wkhtmltopdf would have to run the script.
+///
+///        The SVG contains, from back to front:
+///             - the grid and the axes, in hours relative to the adjustment date and in the concentration unit,
+///             - the range and the best value of each concentration target (residual, peak and mean),
+///             - the percentile bands around the samples,
+///             - the curves of the other adjustments in grey, if requested,
+///             - the curve of the best adjustment,
+///             - the samples.
+/// \date 19/10/2026
+/// \author Herzig Melvyn
+class SvgChart
+{
+public:
+
+    /// \brief Constructor.
+    /// \param _width Width of the SVG in pixels.
+    /// \param _height Height of the SVG in pixels.
+    SvgChart(unsigned _width = 716, unsigned _height = 474);
+
+    /// \brief Render the graph data in an SVG element.
+    /// \param _graphData Data to render.
+    /// \param _withAllAdjustments True to draw the curves of all the adjustments,
+    ///                            false to draw only the best one.
+    /// \return The <svg> element as a string.
+    std::string render(const GraphData& _graphData, bool _withAllAdjustments) const;
+
+protected:
+
+    /// \brief Get a step between the ticks of an axis so that the axis has about the given number
+    ///        of ticks. The step is 1, 2 or 5 times a power of ten, or a multiple of a day for hours.
+    /// \param _range Range of the axis.
+    /// \param _nbTicks Number of ticks wanted.
+    /// \param _isTime True if the axis is in hours.
+    /// \return The step between two ticks.
+    static double computeTickStep(double _range, unsigned _nbTicks, bool _isTime);
+
+    /// \brief Format a number with at most the given number of decimals, without trailing zeros.
+    /// \param _value Value to format.
+    /// \param _nbDecimals Maximum number of decimals.
+    /// \return The formatted value.
+    static std::string formatNumber(double _value, unsigned _nbDecimals);
+
+protected:
+
+    /// \brief Width of the SVG in pixels.
+    const unsigned m_width;
+
+    /// \brief Height of the SVG in pixels.
+    const unsigned m_height;
+};
+
+} // namespace Xpert
+} // namespace Tucuxi
+
+#endif // SVGCHART_H
@@ -4,6 +4,7 @@
 
 #include "tucucore/dosage.h"
 
+#include "tuberxpert/utils/unitconversioncache.h"
 #include "tuberxpert/utils/xpertutils.h"
 #include "tuberxpert/exporter/static/filestring.h"
 #include "tuberxpert/result/xpertqueryresult.h"
@@ -14,6 +15,10 @@ using namespace std;
 namespace Tucuxi {
 namespace Xpert {
 
+XpertRequestResultHtmlExport::XpertRequestResultHtmlExport(GraphBackend _graphBackend) :
+    m_graphBackend(_graphBackend)
+{}
+
 void XpertRequestResultHtmlExport::exportToFile(XpertRequestResult& _xpertRequestResult)
 {
 
@@ -75,11 +80,16 @@ string XpertRequestResultHtmlExport::makeHeaderString() const
                       // Insert js made for tuberxpert
 
                    << "    <!-- JS -->" << endl
-                   << "    <!-- Will be injected by the template engine for 'all-in-one' file. -->" << endl
-                   << "    <script> {{ js.graphing }} </script>" << endl
-                   << "    <script> {{ js.graphdata }} </script>" << endl
-                   << "    <script> {{ js.tuberxpert }} </script>" << endl
-                   << "</head>" << endl;
+                   << "    <!-- Will be injected by the template engine for 'all-in-one' file. -->" << endl;
+
+    // The scripts only draw the graphs, they are useless when the graphs are svg.
+    if (m_graphBackend == GraphBackend::JAVASCRIPT) {
+        templateStream << "    <script> {{ js.graphing }} </script>" << endl
+                       << "    <script> {{ js.graphdata }} </script>" << endl
+                       << "    <script> {{ js.tuberxpert }} </script>" << endl;
+    }
+
+    templateStream << "</head>" << endl;
 
     // Preparing the data to insert.
     inja::json json;
@@ -98,6 +108,11 @@ string XpertRequestResultHtmlExport::makeBodyString(const XpertRequestResult& _x
 {
     stringstream templateStream;
 
+    // The graphs are either canvas drawn by graphing.js or svg rendered here.
+    const bool isSvgGraph = m_graphBackend == GraphBackend::SVG;
+    const string allAdjustmentsGraph = isSvgGraph ? "{{ graph_svg.all }}" : "<canvas id='canAllAdj' width='716' height='474'></canvas>";
+    const string bestAdjustmentGraph = isSvgGraph ? "{{ graph_svg.best }}" : "<canvas id='canBestAdj' width='716' height='474'></canvas>";
+
     // Making the body template.
     // On the far left of the stream we have the template instructions and the real html content 4-5 tabs on the right.
     templateStream
@@ -455,7 +470,7 @@ string XpertRequestResultHtmlExport::makeBodyString(const XpertRequestResult& _x
        <<                       "       <div> {{ adjustments.intro_phrase_translation }} </div>" << endl
        <<                       "       <h4>{{ adjustments.per_interval_translation }}</h4>" << endl
        <<                       "       <div class='canvasAdjustments'>" << endl
-       <<                       "           <canvas id='canAllAdj' width='716' height='474'></canvas>" << endl
+       <<                       "           " << allAdjustmentsGraph << endl
        <<                       "       </div>" << endl
        <<                       "    </div>" << endl
        << endl
@@ -525,7 +540,7 @@ string XpertRequestResultHtmlExport::makeBodyString(const XpertRequestResult& _x
        <<               "       <h3> {{ adjustments.adjustment_suggested_translation }} </h3>" << endl
        <<               "       <div> {{ adjustments.suggestion_phrase_translation }} </div></h4>" << endl
        <<               "       <div class='canvasAdjustments'>" << endl
-       <<               "           <canvas id='canBestAdj' width='716' height='474'></canvas>" << endl
+       <<               "           " << bestAdjustmentGraph << endl
        <<               "       </div>" << endl
        <<               "    </div>" << endl
        << endl
@@ -721,7 +736,10 @@ string XpertRequestResultHtmlExport::makeBodyString(const XpertRequestResult& _x
        <<               "    <!-- Ending clean / otherwise we see background on pdf printing -->" << endl
        <<               "    <div class='ending'/>" << endl
        << endl
-       <<               "</div>" << endl
+       <<               "</div>" << endl;
+
+    if (!isSvgGraph) {
+        templateStream
        <<               "<script>" << endl
        << endl
 
@@ -769,7 +787,10 @@ string XpertRequestResultHtmlExport::makeBodyString(const XpertRequestResult& _x
        <<               "    var obj = new GraphFullData();" << endl
        <<               "    addTargets(obj, targets);" << endl
        <<               "    displayGraphs(obj, adustmentsData, {{graph_data.adjustment_date}}, {{graph_data.end_date}});" << endl
-       <<               "</script>" << endl
+       <<               "</script>" << endl;
+    }
+
+    templateStream
        <<               "</body>" << endl
        <<               "</html>" << endl;
 
@@ -788,7 +809,17 @@ string XpertRequestResultHtmlExport::makeBodyString(const XpertRequestResult& _x
     getParametersJson(_xpertRequestResult, xpertRequestResultJson["pks"]);
     getPredictionsJson(_xpertRequestResult, xpertRequestResultJson["predictions"]);
     getComputationCovariatesJson(_xpertRequestResult, xpertRequestResultJson["computation_covariates"]);
-    getGraphDataJson(_xpertRequestResult, xpertRequestResultJson["graph_data"]);
+
+    if (isSvgGraph) {
+        GraphData graphData;
+        getGraphData(_xpertRequestResult, graphData);
+
+        SvgChart chart;
+        xpertRequestResultJson["graph_svg"]["all"] = chart.render(graphData, true);
+        xpertRequestResultJson["graph_svg"]["best"] = chart.render(graphData, false);
+    } else {
+        getGraphDataJson(_xpertRequestResult, xpertRequestResultJson["graph_data"]);
+    }
 
     return inja::render(templateStream.str(), xpertRequestResultJson);
 }
@@ -1038,7 +1069,7 @@ void XpertRequestResultHtmlExport::getClinicalDatasJson(const unique_ptr<AdminDa
     }
 }
 
-void XpertRequestResultHtmlExport::getCovariatesJson(const vector<CovariateValidationResult>& _covariateResults, inja::json& _covariatesJson) const
+void XpertRequestResultHtmlExport::getCovariatesJson(const pmr::vector<CovariateValidationResult>& _covariateResults, inja::json& _covariatesJson) const
 {
     LanguageManager& langMgr = LanguageManager::getInstance();
 
@@ -1313,7 +1344,7 @@ void XpertRequestResultHtmlExport::getSingleDoseJson(const Core::SingleDose& _do
     _dosageTimeRangeJson["single_doses"].emplace_back(singleDoseJson);
 }
 
-void XpertRequestResultHtmlExport::getSamplesJson(const vector<SampleValidationResult>& _sampleResults, inja::json& _samplesJson) const
+void XpertRequestResultHtmlExport::getSamplesJson(const pmr::vector<SampleValidationResult>& _sampleResults, inja::json& _samplesJson) const
 {
     LanguageManager& langMgr = LanguageManager::getInstance();
 
@@ -1676,6 +1707,11 @@ void XpertRequestResultHtmlExport::getGraphDataJson(const XpertRequestResult& _x
     // For each adjustment
     for (size_t a = 0; a < adjustments.size(); ++a) {
 
+        // The candidates whose curves have not been kept are only listed, not drawn.
+        if (adjustments[a].getData().empty()) {
+            continue;
+        }
+
         inja::json adjustmentJson;
 
         // For each cycle data
@@ -1717,6 +1753,123 @@ void XpertRequestResultHtmlExport::getGraphDataJson(const XpertRequestResult& _x
     }
 }
 
+void XpertRequestResultHtmlExport::getGraphData(const XpertRequestResult& _xpertRequestResult, GraphData& _graphData) const
+{
+    const Common::DateTime& adjustmentTime = _xpertRequestResult.getAdjustmentTrait()->getAdjustmentTime();
+
+    // Hours relative to the adjustment date.
+    auto toHours = [&adjustmentTime](const Common::DateTime& _date) {
+        return (_date.toSeconds() - adjustmentTime.toSeconds()) / 3600.0;
+    };
+
+    _graphData.m_start = 0;
+    _graphData.m_end = toHours(_xpertRequestResult.getAdjustmentTrait()->getEnd());
+
+    const vector<Core::DosageAdjustment>& adjustments = _xpertRequestResult.getAdjustmentData()->getAdjustments();
+
+    // For each target in the best suggestion
+    for (const Core::TargetEvaluationResult& target : adjustments[0].m_targetsEvaluation) {
+        _graphData.m_targets.push_back({Core::toString(target.getTargetType()),
+                                        target.getTarget().getValueMin(),
+                                        target.getTarget().getValueBest(),
+                                        target.getTarget().getValueMax()});
+    }
+
+    // For each adjustment, the cycle data are put end to end
+    for (const Core::DosageAdjustment& adjustment : adjustments) {
+
+        // The candidates whose curves have not been kept are only listed, not drawn.
+        if (adjustment.getData().empty()) {
+            continue;
+        }
+
+        GraphData::Curve curve;
+        for (const Core::CycleData& cycleData : adjustment.getData()) {
+
+            double cycleStart = toHours(cycleData.m_start);
+            for (size_t i = 0; i < cycleData.m_times[0].size() && i < cycleData.m_concentrations[0].size(); ++i) {
+                curve.m_times.push_back(cycleStart + cycleData.m_times[0][i]);
+                curve.m_values.push_back(cycleData.m_concentrations[0][i]);
+            }
+
+            _graphData.m_unit = cycleData.m_unit.toString();
+        }
+
+        _graphData.m_adjustments.push_back(move(curve));
+    }
+
+    if (adjustments[0].getData().empty()) {
+        return;
+    }
+
+    // The samples are converted in the unit of the curves. The graph is extended before
+    // the adjustment date to show them, but by no more than its duration so that the
+    // curves keep at least half of the width.
+    const Common::TucuUnit& curveUnit = adjustments[0].getData()[0].m_unit;
+    for (const SampleValidationResult& sampleResult : _xpertRequestResult.getSampleValidationResults()) {
+
+        double time = toHours(sampleResult.getSource()->getDate());
+        if (time < -_graphData.m_end || time > _graphData.m_end) {
+            continue;
+        }
+
+        try {
+            double value = UnitConversionCache::getInstance().convert(sampleResult.getSource()->getValue(),
+                                                                      sampleResult.getSource()->getUnit(),
+                                                                      curveUnit);
+            _graphData.m_samples.push_back({time, value});
+            _graphData.m_start = min(_graphData.m_start, time);
+        } catch (const invalid_argument&) {
+            // A sample whose unit is not a concentration is not displayed.
+            continue;
+        }
+
+        // The percentiles computed by the SampleValidator around the sample are drawn as bands,
+        // without a second percentiles computation. The outer band is drawn first.
+        auto samplePercentilesIt = _xpertRequestResult.getSamplePercentiles().find(sampleResult.getSource());
+        if (samplePercentilesIt == _xpertRequestResult.getSamplePercentiles().end()) {
+            continue;
+        }
+
+        static const pair<double, double> bandRanks[] = {{5, 95}, {25, 75}};
+        for (const pair<double, double>& ranks : bandRanks) {
+            const vector<Core::CycleData>* lows = samplePercentilesIt->second.findPercentileData(ranks.first);
+            const vector<Core::CycleData>* highs = samplePercentilesIt->second.findPercentileData(ranks.second);
+            if (lows == nullptr || highs == nullptr) {
+                continue;
+            }
+
+            GraphData::Band band;
+            for (size_t c = 0; c < lows->size() && c < highs->size(); ++c) {
+                const Core::CycleData& lowCycle = (*lows)[c];
+                const Core::CycleData& highCycle = (*highs)[c];
+
+                // The concentrations are linear, one factor converts a whole cycle.
+                double factor = 0;
+                try {
+                    factor = UnitConversionCache::getInstance().convert(1, lowCycle.m_unit, curveUnit);
+                } catch (const invalid_argument&) {
+                    break;
+                }
+
+                double cycleStart = toHours(lowCycle.m_start);
+                for (size_t i = 0; i < lowCycle.m_times[0].size() &&
+                                   i < lowCycle.m_concentrations[0].size() &&
+                                   i < highCycle.m_concentrations[0].size(); ++i) {
+                    band.m_times.push_back(cycleStart + lowCycle.m_times[0][i]);
+                    band.m_lows.push_back(lowCycle.m_concentrations[0][i] * factor);
+                    band.m_highs.push_back(highCycle.m_concentrations[0][i] * factor);
+                }
+            }
+
+            if (!band.m_times.empty()) {
+                _graphData.m_start = min(_graphData.m_start, max(-_graphData.m_end, band.m_times.front()));
+                _graphData.m_percentileBands.push_back(move(band));
+            }
+        }
+    }
+}
+
 string XpertRequestResultHtmlExport::prefixPosology(const string& _posologyIndication, const string& _posologyIndicationChain) const
 {
     stringstream newPosologyIndicationsChainStream;
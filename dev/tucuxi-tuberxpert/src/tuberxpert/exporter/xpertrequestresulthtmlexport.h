@@ -3,6 +3,7 @@
 
 #include "tuberxpert/exporter/abstractxpertrequestresultexport.h"
 #include "tuberxpert/exporter/abstracthtmlexport.h"
+#include "tuberxpert/exporter/svgchart.h"
 #include "tuberxpert/query/admindata.h"
 
 #include "inja/inja.hpp"
@@ -10,6 +11,15 @@
 namespace Tucuxi {
 namespace Xpert {
 
+/// \brief How the graphs of the HTML report are drawn.
+///        - JAVASCRIPT: in canvas, by graphing.js when the page is loaded.
+///        - SVG: as inline svg rendered by SvgChart, the page contains no script.
+enum class GraphBackend
+{
+    JAVASCRIPT,
+    SVG
+};
+
 /// \brief This class exports an XpertRequestResult in HTML.
 ///        It creates an all-in-one html file that contains
 ///        the necessary css and js to be autonomous.
@@ -55,12 +65,19 @@ namespace Xpert {
 ///         covariates were represented by a set of rows in the same table. This approach is often used in
 ///         the HTML template of this class when we do not know where a group of data is going to start.
 ///
+///        The graphs can also be rendered as inline SVG (see GraphBackend). Then, the report contains
+///        no JavaScript and wkhtmltopdf does not have to run it to draw the graphs.
+///
 /// \date 23/06/2022
 /// \author Herzig Melvyn
 class XpertRequestResultHtmlExport : public AbstractXpertRequestResultExport, public AbstractHtmlExport
 {
 public:
 
+    /// \brief Constructor.
+    /// \param _graphBackend How to draw the graphs of the report.
+    XpertRequestResultHtmlExport(GraphBackend _graphBackend = GraphBackend::JAVASCRIPT);
+
     /// \brief Export the result of the xpertRequest to a file. The export may fail. In this
     ///        case, the XpertRequestResult error message is set.
     /// \param _xpertRequestResult Result of the xpertRequest to export.
@@ -134,7 +151,7 @@ protected:
     /// \brief Prepare and put the covariate validation results in the json.
     /// \param _covariateResults The vector of the covariate validation results to put in the json.
     /// \param _covariatesJson Json object where to put the collected data.
-    void getCovariatesJson(const std::vector<CovariateValidationResult>& _covariateResults, inja::json& _covariatesJson) const;
+    void getCovariatesJson(const std::pmr::vector<CovariateValidationResult>& _covariateResults, inja::json& _covariatesJson) const;
 
     /// \brief Prepare and put the dosage history in the json.
     /// \param _history The DosageHistory to put in the json.
@@ -217,7 +234,7 @@ protected:
     /// \brief Prepare and put the samples validation results in the json.
     /// \param _sampleResults The vector of the sample validation results to put in the json.
     /// \param _samplesJson Json object where to put the collected data.
-    void getSamplesJson(const std::vector<SampleValidationResult>& _sampleResults, inja::json& _samplesJson) const;
+    void getSamplesJson(const std::pmr::vector<SampleValidationResult>& _sampleResults, inja::json& _samplesJson) const;
 
     /// \brief Prepare and put the adjustments in the json.
     /// \param _adjustmentData Object containing the adjustments.
@@ -249,6 +266,14 @@ protected:
     /// \param _graphDataJson Json object where to put the collected data.
     void getGraphDataJson(const XpertRequestResult& _xpertRequestResult, inja::json& _graphDataJson) const;
 
+    /// \brief Prepare the adjustment data, the targets and the samples for the svg graphs.
+    ///        It collects the same data as getGraphDataJson, the samples and the 5-95 and 25-75 percentile
+    ///        bands kept by the SampleValidator around them.
+    /// \param _xpertRequestResult XpertRequestResult containing the adjustment trait, the adjustment data, the samples
+    ///        and their percentiles.
+    /// \param _graphData Graph data where to put the collected data.
+    void getGraphData(const XpertRequestResult& _xpertRequestResult, GraphData& _graphData) const;
+
     /// \brief Prefix the given posology to the given posology indication chain.
     /// \param _posologyIndication Posology to prefix.
     /// \param _posologyIndicationChain Existing posology indication chain.
@@ -274,6 +299,9 @@ protected:
     ///        an argument each time.
     const XpertRequestResult* m_xpertRequestResultInUse;
 
+    /// \brief How the graphs of the report are drawn.
+    const GraphBackend m_graphBackend;
+
 };
 
 } // namespace Xpert
@@ -322,7 +322,7 @@ void XpertRequestResultXmlExport::exportClinicalDatas(const unique_ptr<ClinicalD
     }
 }
 
-void XpertRequestResultXmlExport::exportCovariateResults(const vector<CovariateValidationResult>& _covariateResults, Common::XmlNode& _rootNode)
+void XpertRequestResultXmlExport::exportCovariateResults(const pmr::vector<CovariateValidationResult>& _covariateResults, Common::XmlNode& _rootNode)
 {
     // <covariates>
     Common::XmlNode covariatesNode =
@@ -420,7 +420,7 @@ void XpertRequestResultXmlExport::exportDose(
     }
 }
 
-void XpertRequestResultXmlExport::exportSampleResults(const vector<SampleValidationResult>& _sampleResults, Common::XmlNode& _rootNode)
+void XpertRequestResultXmlExport::exportSampleResults(const pmr::vector<SampleValidationResult>& _sampleResults, Common::XmlNode& _rootNode)
 {
     // <samples>
     Common::XmlNode samplesNode =
@@ -580,7 +580,10 @@ void XpertRequestResultXmlExport::exportAdjustmentData(const unique_ptr<Core::Ad
         exportDosageHistory(adj.m_history, adjustmentNode);
 
         //          <cycleDatas>
-        exportCycleDatas(adj.getData(), adjustmentNode);
+        // The candidates that are only listed have no cycle data (see RequestExecutor::limitCandidates).
+        if (!adj.getData().empty()) {
+            exportCycleDatas(adj.getData(), adjustmentNode);
+        }
     }
 }
 
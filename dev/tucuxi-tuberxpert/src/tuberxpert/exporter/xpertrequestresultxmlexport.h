@@ -85,7 +85,7 @@ protected:
     /// \brief Create and append the covariates validation results nodes to the root node.
     /// \param _covariateResults Covariate validation results to export.
     /// \param _rootNode Root node where to add the created nodes.
-    void exportCovariateResults(const std::vector<CovariateValidationResult>& _covariateResults, Common::XmlNode& _rootNode);
+    void exportCovariateResults(const std::pmr::vector<CovariateValidationResult>& _covariateResults, Common::XmlNode& _rootNode);
 
     /// \brief Create and append the treatment node to the root node.
     /// \param _treatment Treatment to export.
@@ -101,7 +101,7 @@ protected:
     /// \brief Create and append the sample validation results nodes to the root node.
     /// \param _sampleResults Sample validation results to export.
     /// \param _rootNode Root node where to add the created nodes.
-    void exportSampleResults(const std::vector<SampleValidationResult>& _sampleResults, Common::XmlNode& _rootNode);
+    void exportSampleResults(const std::pmr::vector<SampleValidationResult>& _sampleResults, Common::XmlNode& _rootNode);
 
     /// \brief Create and append the adjustment data node to the root node.
     /// \param _adjustmentData Adjustment data to export.
@@ -20,10 +20,13 @@ public:
     virtual ~AbstractXpertFlowStep(){};
 
     /// \brief Method to call in order to perform the flow step.
+    ///        The flow steps are shared by the requests of a drug and may perform several
+    ///        requests at the same time, thus the data of a request is only kept in the
+    ///        XpertRequestResult, never in the flow step.
     /// \param _xpertRequestResult XpertRequestResult object which will contain the
     ///        result of this flow step and which contains the information
     ///        necessary for the execution of this flow step.
-    virtual void perform(XpertRequestResult& _xpertRequestResult) = 0;
+    virtual void perform(XpertRequestResult& _xpertRequestResult) const = 0;
 
 };
 
@@ -4,21 +4,26 @@
 
 #include "tucucommon/unit.h"
 #include "tucucore/intakeevent.h"
-#include "tucucore/intakeextractor.h"
 #include "tucucore/computingservice/computingresult.h"
 
 #include "tuberxpert/result/xpertqueryresult.h"
 #include "tuberxpert/utils/xpertutils.h"
+#include "tuberxpert/utils/unitconversioncache.h"
 
 using namespace std;
 
 namespace Tucuxi {
 namespace Xpert {
 
-void AdjustmentTraitCreator::perform(XpertRequestResult& _xpertRequestResult)
+AdjustmentTraitCreator::AdjustmentTraitCreator(const PointDensity& _pointDensity) :
+    m_pointDensity(_pointDensity)
+{}
+
+void AdjustmentTraitCreator::perform(XpertRequestResult& _xpertRequestResult) const
 {
     // Fixing the computation time. Useful for computing the adjustment / start / end times...
-    m_computationTime = _xpertRequestResult.getXpertQueryResult().getComputationTime();
+    // It is a local since the flow step is shared by the requests.
+    const Common::DateTime& computationTime = _xpertRequestResult.getXpertQueryResult().getComputationTime();
 
     // Check if there is a treatment.
     if (_xpertRequestResult.getTreatment() == nullptr) {
@@ -50,7 +55,7 @@ void AdjustmentTraitCreator::perform(XpertRequestResult& _xpertRequestResult)
     string responseId = "";
 
     // Points per hour.
-    double nbPointsPerHour = 20;
+    double nbPointsPerHour = m_pointDensity.getNbPointsPerHour(*_xpertRequestResult.getDrugModel());
 
     // Computing options.
     Core::ComputingOption computingOption{
@@ -62,7 +67,7 @@ void AdjustmentTraitCreator::perform(XpertRequestResult& _xpertRequestResult)
     };
 
     // Adjustment date.
-    Common::DateTime adjustmentTime = getAdjustmentTimeAndLastIntake(_xpertRequestResult, fullFormulationAndRoute);
+    Common::DateTime adjustmentTime = getAdjustmentTimeAndLastIntake(_xpertRequestResult, fullFormulationAndRoute, computationTime);
 
     // Period.
     Common::DateTime start;
@@ -70,7 +75,7 @@ void AdjustmentTraitCreator::perform(XpertRequestResult& _xpertRequestResult)
 
     try {
 
-        getPeriod(fullFormulationAndRoute, _xpertRequestResult, adjustmentTime, start, end);
+        getPeriod(fullFormulationAndRoute, _xpertRequestResult, adjustmentTime, computationTime, start, end);
 
     } catch (const invalid_argument& e) {
         // We catch the fact the the treatment may already be over (if it is a standard treatment).
@@ -96,8 +101,8 @@ void AdjustmentTraitCreator::perform(XpertRequestResult& _xpertRequestResult)
     // Formulation and route selection option.
     Core::FormulationAndRouteSelectionOption formulationAndRouteSelectionOption = _xpertRequestResult.getXpertRequest().getFormulationAndRouteSelectionOption();
 
-    // Creating and setting the trait.
-    Core::ComputingTraitAdjustment computingTraitAdjustment = Core::ComputingTraitAdjustment(
+    // Creating the trait and moving it into the XpertRequestResult, which shares it immutably.
+    unique_ptr<Core::ComputingTraitAdjustment> computingTraitAdjustment = make_unique<Core::ComputingTraitAdjustment>(
                 responseId,
                 start,
                 end,
@@ -111,7 +116,7 @@ void AdjustmentTraitCreator::perform(XpertRequestResult& _xpertRequestResult)
                 targetExtractionOption,
                 formulationAndRouteSelectionOption);
 
-    _xpertRequestResult.setAdjustmentTrait(computingTraitAdjustment);
+    _xpertRequestResult.setAdjustmentTrait(move(computingTraitAdjustment));
 
 }
 
@@ -125,27 +130,25 @@ Core::PredictionParameterType AdjustmentTraitCreator::getPredictionParameterType
     }
 }
 
-Common::DateTime AdjustmentTraitCreator::getAdjustmentTimeAndLastIntake(XpertRequestResult& _xpertRequestResult, const Core::FullFormulationAndRoute* _fullFormulationAndRoute) const
+Common::DateTime AdjustmentTraitCreator::getAdjustmentTimeAndLastIntake(XpertRequestResult& _xpertRequestResult,
+                                                                        const Core::FullFormulationAndRoute* _fullFormulationAndRoute,
+                                                                        const Common::DateTime& _computationTime) const
 {
     // In any case, we need the intake series, so we prepare it now. With it we can extract the last intake.
     // Get the latest (in the past) dosage time range start as the extraction starting time.
-    Common::DateTime startTimeOfTheLatestDosage = getLatestDosageTimeRangeStart(_xpertRequestResult.getTreatment()->getDosageHistory(), m_computationTime);
+    Common::DateTime startTimeOfTheLatestDosage = getLatestDosageTimeRangeStart(_xpertRequestResult.getTreatment()->getDosageHistory(), _computationTime);
 
-    Core::IntakeExtractor intakeExtractor;
-    Core::IntakeSeries intakes;
-    Core::ComputingStatus cs = intakeExtractor.extract(_xpertRequestResult.getTreatment()->getDosageHistory(),
-                                                       startTimeOfTheLatestDosage,
-                                                       Common::DateTime::undefinedDateTime(),
-                                                       1,
-                                                       _fullFormulationAndRoute->getValidDoses()->getUnit(),
-                                                       intakes);
+    // The series is shared with the other flow steps of the request that use the same window, it is read in place.
+    const Core::IntakeSeries* intakes = _xpertRequestResult.getSeriesCache().getIntakes(_fullFormulationAndRoute->getValidDoses()->getUnit(),
+                                                                                       startTimeOfTheLatestDosage,
+                                                                                       Common::DateTime::undefinedDateTime());
 
-    // If time is not undefined and the computing result of intake series is ok, then get the last intake.
-    if (!startTimeOfTheLatestDosage.isUndefined() && cs == Core::ComputingStatus::Ok) {
+    // If time is not undefined and the intake series could be extracted, then get the last intake.
+    if (!startTimeOfTheLatestDosage.isUndefined() && intakes != nullptr) {
 
         // Set the last intake in the XpertRequestResult.
         unique_ptr<Core::IntakeEvent> lastIntake;
-        getLatestIntake(intakes, lastIntake);
+        getLatestIntake(*intakes, _computationTime, lastIntake);
         _xpertRequestResult.setLastIntake(move(lastIntake));
     }
 
@@ -153,8 +156,8 @@ Common::DateTime AdjustmentTraitCreator::getAdjustmentTimeAndLastIntake(XpertReq
     if (!_xpertRequestResult.getXpertRequest().getAdjustmentTime().isUndefined()){
         return _xpertRequestResult.getXpertRequest().getAdjustmentTime();
 
-    // If time is not undefined and the computing result of intake series is ok
-    } else if (!startTimeOfTheLatestDosage.isUndefined() && cs == Core::ComputingStatus::Ok){
+    // If time is not undefined and the intake series could be extracted.
+    } else if (!startTimeOfTheLatestDosage.isUndefined() && intakes != nullptr){
 
         // This leaves 3 possible scenarios:
         // 1) There is a treatment in progress -> The next intake after computation time is the adjustment time.
@@ -165,7 +168,7 @@ Common::DateTime AdjustmentTraitCreator::getAdjustmentTimeAndLastIntake(XpertReq
         // We process  1 and 2 (in approximateAdjustmentTimeFromIntakes) before 3, because some computations may "fail",
         // in that case we fallback into 3.
 
-        Common::DateTime adjustmentBasedOnIntakes = approximateAdjustmentTimeFromIntakes(_xpertRequestResult, intakes);
+        Common::DateTime adjustmentBasedOnIntakes = approximateAdjustmentTimeFromIntakes(_xpertRequestResult, *intakes, _computationTime);
 
         // We check if 1 or 2 was successful.
         if(!adjustmentBasedOnIntakes.isUndefined()) {
@@ -175,14 +178,16 @@ Common::DateTime AdjustmentTraitCreator::getAdjustmentTimeAndLastIntake(XpertReq
 
     // 3)  There is no dosage history in the past -> The adjustment time can be at any time, arbitrarily the computation time + 1 hour.
     // Or fallback from 1 and 2
-    return m_computationTime + Duration(chrono::hours(1));
+    return _computationTime + Duration(chrono::hours(1));
 }
 
-Common::DateTime AdjustmentTraitCreator::approximateAdjustmentTimeFromIntakes(XpertRequestResult& _xpertRequestResult, Core::IntakeSeries _intakes) const
+Common::DateTime AdjustmentTraitCreator::approximateAdjustmentTimeFromIntakes(XpertRequestResult& _xpertRequestResult,
+                                                                              const Core::IntakeSeries& _intakes,
+                                                                              const Common::DateTime& _computationTime) const
 {
 
     // Now, we look for the nearest intake in the future. If there is none, for the last one in the past.
-    Common::DateTime possibleAdjustmentTime = getTimeOfNearestFutureOrLatestIntake(_intakes);
+    Common::DateTime possibleAdjustmentTime = getTimeOfNearestFutureOrLatestIntake(_intakes, _computationTime);
 
     // For some reasons, the intakes series may be empty. In this case, just return undefined date.
     if (possibleAdjustmentTime.isUndefined()) {
@@ -190,12 +195,12 @@ Common::DateTime AdjustmentTraitCreator::approximateAdjustmentTimeFromIntakes(Xp
     }
 
     // The time of extracted intake is in the past.
-    if (possibleAdjustmentTime < m_computationTime) {
+    if (possibleAdjustmentTime < _computationTime) {
 
         // Add 2 * helf-life until the computing time is reached, it defines the adjustment time.
         const Core::HalfLife& halfLife = _xpertRequestResult.getDrugModel()->getTimeConsiderations().getHalfLife();
-        while (possibleAdjustmentTime < m_computationTime) {
-            double timeValue = Common::UnitManager::convertToUnit(halfLife.getValue(), halfLife.getUnit(), Common::TucuUnit("h"));
+        double timeValue = UnitConversionCache::getInstance().convert(halfLife.getValue(), halfLife.getUnit(), Common::TucuUnit("h"));
+        while (possibleAdjustmentTime < _computationTime) {
             possibleAdjustmentTime += Common::Duration(chrono::hours(int(2 * timeValue)));
         }
     }
@@ -207,7 +212,8 @@ Common::DateTime AdjustmentTraitCreator::approximateAdjustmentTimeFromIntakes(Xp
     return possibleAdjustmentTime;
 }
 
-Common::DateTime AdjustmentTraitCreator::getTimeOfNearestFutureOrLatestIntake(Core::IntakeSeries _intakes) const
+Common::DateTime AdjustmentTraitCreator::getTimeOfNearestFutureOrLatestIntake(const Core::IntakeSeries& _intakes,
+                                                                              const Common::DateTime& _computationTime) const
 {
     // Saved time to return.
     Common::DateTime savedTime = Common::DateTime::undefinedDateTime();
@@ -218,12 +224,12 @@ Common::DateTime AdjustmentTraitCreator::getTimeOfNearestFutureOrLatestIntake(Co
 
         // Since we iterate from the end, we remember each future take that is closest to the computation time.
         if ( savedTime.isUndefined() ||
-             ((*it).getEventTime() < savedTime && (*it).getEventTime() > m_computationTime)) {
+             ((*it).getEventTime() < savedTime && (*it).getEventTime() > _computationTime)) {
             savedTime = (*it).getEventTime();
         }
 
         // If it is in the past.
-        if ((*it).getEventTime() < m_computationTime) {
+        if ((*it).getEventTime() < _computationTime) {
 
             // If there is an intake in the future
             if (!savedTime.isUndefined()){
@@ -239,23 +245,25 @@ Common::DateTime AdjustmentTraitCreator::getTimeOfNearestFutureOrLatestIntake(Co
     return savedTime; // Undefined date.
 }
 
-void AdjustmentTraitCreator::getLatestIntake(Core::IntakeSeries _intakes, unique_ptr<Core::IntakeEvent>& _lastIntake) const
+void AdjustmentTraitCreator::getLatestIntake(const Core::IntakeSeries& _intakes,
+                                             const Common::DateTime& _computationTime,
+                                             unique_ptr<Core::IntakeEvent>& _lastIntake) const
 {
-    Core::IntakeEvent* latestIntake = nullptr;
+    const Core::IntakeEvent* latestIntake = nullptr;
 
     // For each intake
-    for(Core::IntakeEvent& intake : _intakes) {
+    for(const Core::IntakeEvent& intake : _intakes) {
 
         // The intake is saved if:
         //  - the saved one is nullptr and the intake is before the computation time.
         //  or
         //  - the saved one is the oldest and the intake is before the computation
-        if (intake.getEventTime() < m_computationTime && (latestIntake == nullptr || latestIntake->getEventTime() < intake.getEventTime())) {
+        if (intake.getEventTime() < _computationTime && (latestIntake == nullptr || latestIntake->getEventTime() < intake.getEventTime())) {
             latestIntake = &intake;
         }
 
         // If all the intakes in the past have been parsed.
-        if (intake.getEventTime() > m_computationTime) {
+        if (intake.getEventTime() > _computationTime) {
             break;
         }
     }
@@ -267,6 +275,7 @@ void AdjustmentTraitCreator::getLatestIntake(Core::IntakeSeries _intakes, unique
 void AdjustmentTraitCreator::getPeriod(const Core::FullFormulationAndRoute* _fullFormulationAndRoute,
                                        const XpertRequestResult& _xpertRequestResult,
                                        const Common::DateTime& _adjustmentTime,
+                                       const Common::DateTime& _computationTime,
                                        Common::DateTime& _start,
                                        Common::DateTime& _end) const
 {
@@ -274,11 +283,11 @@ void AdjustmentTraitCreator::getPeriod(const Core::FullFormulationAndRoute* _ful
     if (_fullFormulationAndRoute->getStandardTreatment() != nullptr && _fullFormulationAndRoute->getStandardTreatment()->getIsFixedDuration()) {
 
         // Getting treatment start.
-        _start = getOldestDosageTimeRangeStart(_xpertRequestResult.getTreatment()->getDosageHistory(), m_computationTime);
+        _start = getOldestDosageTimeRangeStart(_xpertRequestResult.getTreatment()->getDosageHistory(), _computationTime);
 
         // Getting treatment end ( start + standard treatment duration )
         double treatmentDuration = _fullFormulationAndRoute->getStandardTreatment()->getDuration();
-        treatmentDuration = Common::UnitManager::convertToUnit(treatmentDuration, _fullFormulationAndRoute->getStandardTreatment()->getUnit(), Common::TucuUnit("d"));
+        treatmentDuration = UnitConversionCache::getInstance().convert(treatmentDuration, _fullFormulationAndRoute->getStandardTreatment()->getUnit(), Common::TucuUnit("d"));
         _end = _start + Common::Duration(Common::days(int(treatmentDuration)));
 
         // If the treatment is over.
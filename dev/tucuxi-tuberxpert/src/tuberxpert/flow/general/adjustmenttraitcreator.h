@@ -11,6 +11,7 @@
 #include "tuberxpert/flow/abstract/abstractxpertflowstep.h"
 #include "tuberxpert/result/xpertrequestresult.h"
 #include "tuberxpert/query/xpertrequestdata.h"
+#include "tuberxpert/utils/pointdensity.h"
 
 namespace Tucuxi {
 namespace Xpert {
@@ -26,11 +27,15 @@ class AdjustmentTraitCreator : public AbstractXpertFlowStep
 {
 public:
 
+    /// \brief Constructor.
+    /// \param _pointDensity Point density of the adjustment trait.
+    AdjustmentTraitCreator(const PointDensity& _pointDensity = PointDensity(20));
+
     /// \brief Create the adjustment trait based on the information in the XpertRequestResult and
     ///        set the last intake.
     /// \param _xpertRequestResult XpertRequestResult containing the xpertRequest, the treatment,
     ///        and the drug model that will recieve the trait when it is created.
-    void perform(XpertRequestResult& _xpertRequestResult);
+    void perform(XpertRequestResult& _xpertRequestResult) const;
 
 protected:
 
@@ -51,26 +56,37 @@ protected:
     /// \param _xpertRequestResult XpertRequestResult containing the treatment and the drug model to extract intakes
     ///        and the request.
     /// \param _fullFormulationAndRoute Full formulation and route associated to the treatment.
+    /// \param _computationTime Computation time of the query.
     /// \return The adjustment time.
-    Common::DateTime getAdjustmentTimeAndLastIntake(XpertRequestResult& _xpertRequestResult, const Core::FullFormulationAndRoute* _fullFormulationAndRoute) const;
+    Common::DateTime getAdjustmentTimeAndLastIntake(XpertRequestResult& _xpertRequestResult,
+                                                    const Core::FullFormulationAndRoute* _fullFormulationAndRoute,
+                                                    const Common::DateTime& _computationTime) const;
 
     /// \brief Approximation of the adjustment time bases on the given intake series.
     ///        This function is called by "getAdjustmentTimeAndLastIntake".
     /// \param _xpertRequestResult XpertRequestResult used to get the half life of the drug model.
     /// \param _intakes Intake series used for approximation.
+    /// \param _computationTime Computation time of the query.
     /// \return The adjustment time if found one, otherwise an undefined time.
-    Common::DateTime approximateAdjustmentTimeFromIntakes(XpertRequestResult& _xpertRequestResult, Core::IntakeSeries _intakes) const;
+    Common::DateTime approximateAdjustmentTimeFromIntakes(XpertRequestResult& _xpertRequestResult,
+                                                          const Core::IntakeSeries& _intakes,
+                                                          const Common::DateTime& _computationTime) const;
 
     /// \brief Given an intake series, try to extract the closest intake in the future. If none is found,
     ///        extract the closed in the past. By closest, we mean "the closest to the computation time".
     /// \param _intakes Intake series to work with.
+    /// \param _computationTime Computation time of the query.
     /// \return The time found, otherwise an undefined time if the series is empty.
-    Common::DateTime getTimeOfNearestFutureOrLatestIntake(Core::IntakeSeries _intakes) const;
+    Common::DateTime getTimeOfNearestFutureOrLatestIntake(const Core::IntakeSeries& _intakes,
+                                                          const Common::DateTime& _computationTime) const;
 
     /// \brief Get a pointer on the last intake of the intake series that is before the computation time.
     /// \param _intakes Intake series to work with.
+    /// \param _computationTime Computation time of the query.
     /// \param _lastIntake Unique pointer to store the result.
-    void getLatestIntake(Core::IntakeSeries _intakes, std::unique_ptr<Core::IntakeEvent>& _lastIntake) const;
+    void getLatestIntake(const Core::IntakeSeries& _intakes,
+                         const Common::DateTime& _computationTime,
+                         std::unique_ptr<Core::IntakeEvent>& _lastIntake) const;
 
     /// \brief Extract the start and end time of the adjustment.
     ///        - If the treatment is not a standard treatment:
@@ -83,11 +99,13 @@ protected:
     /// \param _fullFormulationAndRoute Full formulation and route associated to the treatment.
     /// \param _xpertRequestResult XpertRequestResult used to get the dosage history and the xpertRequest.
     /// \param _adjustmentTime Estimated adjustment time.
+    /// \param _computationTime Computation time of the query.
     /// \param _start Resulting start time.
     /// \param _end Resulting end time.
     void getPeriod(const Core::FullFormulationAndRoute* _fullFormulationAndRoute,
                    const XpertRequestResult& _xpertRequestResult,
                    const Common::DateTime& _adjustmentTime,
+                   const Common::DateTime& _computationTime,
                    Common::DateTime& _start,
                    Common::DateTime& _end) const;
 
@@ -121,10 +139,8 @@ protected:
 
 protected:
 
-    /// \brief Fix the computation time to get the same values when testing
-    ///        at different times. Retrieved from the XpertRequestResult in perform method.
-    ///        It allows not to be forced to use local time when time-based calculations are needed.
-    Common::DateTime m_computationTime;
+    /// \brief Point density of the adjustment trait.
+    PointDensity m_pointDensity;
 };
 
 } // namespace Xpert
@@ -1,5 +1,6 @@
 #include "covariatevalidatorandmodelselector.h"
 
+#include <algorithm>
 #include <vector>
 #include <limits>
 #include <optional>
@@ -16,7 +17,9 @@
 #include "tucucommon/utils.h"
 #include "tucucommon/unit.h"
 
+#include "tuberxpert/utils/flowstepcache.h"
 #include "tuberxpert/utils/xpertutils.h"
+#include "tuberxpert/utils/unitconversioncache.h"
 #include "tuberxpert/result/xpertqueryresult.h"
 
 using namespace std;
@@ -24,10 +27,10 @@ using namespace std;
 namespace Tucuxi {
 namespace Xpert {
 
-void CovariateValidatorAndModelSelector::perform(XpertRequestResult& _xpertRequestResult)
+void CovariateValidatorAndModelSelector::perform(XpertRequestResult& _xpertRequestResult) const
 {
-    // Fix the computation time.
-    m_computationTime = _xpertRequestResult.getXpertQueryResult().getComputationTime();
+    // Fix the computation time. It is a local since the flow step is shared by the requests.
+    const Common::DateTime& computationTime = _xpertRequestResult.getXpertQueryResult().getComputationTime();
 
     Tucuxi::Common::LoggerHelper logHelper;
 
@@ -59,54 +62,87 @@ void CovariateValidatorAndModelSelector::perform(XpertRequestResult& _xpertReque
         return;
     }
 
+    // The selection only depends on the candidate models and their content, the formulations and routes, the covariates,
+    // the language and the computation time. If they did not change since a previous run, only the selected model is scored again.
+    FlowStepCacheKey selectionKey("covariateValidatorAndModelSelector.drugModelId");
+    selectionKey.add(drugId)
+            .add(double(static_cast<int>(_xpertRequestResult.getXpertRequest().getOutputLang())))
+            .add(computationTime)
+            .add(double(drugModels.size()));
+    for (const Core::DrugModel* drugModel : drugModels) {
+        selectionKey.addDrugModel(drugModel->getDrugModelId());
+    }
+    selectionKey.addFormulationsAndRoutes(_xpertRequestResult.getTreatment()->getDosageHistory())
+            .addCovariates(_xpertRequestResult.getTreatment()->getCovariates());
+
+    string selectedModelId;
+    bool isSelectionCached = FlowStepCache::getInstance().find(selectionKey, selectedModelId);
+    if (isSelectionCached) {
+        auto selectedModelIt = find_if(drugModels.begin(), drugModels.end(), [&selectedModelId](const Core::DrugModel* _drugModel) {
+            return _drugModel->getDrugModelId() == selectedModelId;
+        });
+
+        // The selected model is already known to be compatible, the other ones are not evaluated.
+        if (selectedModelIt != drugModels.end()) {
+            drugModels = {*selectedModelIt};
+        } else {
+            isSelectionCached = false;
+        }
+    }
+
     // Remember the best drug model.
     unsigned lowestKnownScore = numeric_limits<unsigned>::max();             // Score of the best model known.
     const Core::DrugModel* bestModel = nullptr;                              // Pointer on the best model known.
-    vector<CovariateValidationResult> covariateValidationResultsOfBestModel; // Covariates validation result for the best model known.
+    pmr::vector<CovariateValidationResult> covariateValidationResultsOfBestModel(_xpertRequestResult.getArena()); // Covariates validation result for the best model known.
 
     Core::TreatmentDrugModelCompatibilityChecker drugModelTreatmentCompatiblityChecker;
 
     // Evaluate each drug model for the given drug identifier.
     for (const Core::DrugModel* drugModel : drugModels) {
 
-        // Does the drug model supports the formulation and route of the treatment?
-        if (!drugModelTreatmentCompatiblityChecker.checkCompatibility(_xpertRequestResult.getTreatment().get(), drugModel)) {
-            logHelper.warn(drugModel->getDrugModelId() + " incompatible: Formulations and routes are not matching.");
-            continue;
-        }
+        // The compatibility and the constraints of a selected model found in the cache are already checked.
+        if (!isSelectionCached) {
 
-        // Are the drug model constraints respected?
-        Common::DateTime start = getOldestCovariateDateTime(_xpertRequestResult.getTreatment()->getCovariates());
-        Common::DateTime end = m_computationTime;
-        vector<Core::DrugDomainConstraintsEvaluator::EvaluationResult> results;
-        Core::DrugDomainConstraintsEvaluator constraintEvaluator;
-        Core::DrugDomainConstraintsEvaluator::Result constraintsResult = constraintEvaluator.evaluate(*drugModel,
-                                                                                                      *_xpertRequestResult.getTreatment(),
-                                                                                                      start,
-                                                                                                      end,
-                                                                                                      results);
-
-        // If the contraints are not compatible.
-        if(constraintsResult == Core::DrugDomainConstraintsEvaluator::Result::Incompatible) {
-            logHelper.warn(drugModel->getDrugModelId() + " incompatible: constraints not respected.");
-            continue;
-        }
+            // Does the drug model supports the formulation and route of the treatment?
+            if (!drugModelTreatmentCompatiblityChecker.checkCompatibility(_xpertRequestResult.getTreatment().get(), drugModel)) {
+                logHelper.warn(drugModel->getDrugModelId() + " incompatible: Formulations and routes are not matching.");
+                continue;
+            }
 
-        // If the covariates extraction failed.
-        if(constraintsResult == Core::DrugDomainConstraintsEvaluator::Result::ComputationError) {
-            _xpertRequestResult.setErrorMessage("Covariates extraction failed for drug model: " +
-                                                drugModel->getDrugModelId() +
-                                                ". It may be caused by covariates that could not be converted.");
-            return;
+            // Are the drug model constraints respected?
+            Common::DateTime start = getOldestCovariateDateTime(_xpertRequestResult.getTreatment()->getCovariates(), computationTime);
+            Common::DateTime end = computationTime;
+            vector<Core::DrugDomainConstraintsEvaluator::EvaluationResult> results;
+            Core::DrugDomainConstraintsEvaluator constraintEvaluator;
+            Core::DrugDomainConstraintsEvaluator::Result constraintsResult = constraintEvaluator.evaluate(*drugModel,
+                                                                                                          *_xpertRequestResult.getTreatment(),
+                                                                                                          start,
+                                                                                                          end,
+                                                                                                          results);
+
+            // If the contraints are not compatible.
+            if(constraintsResult == Core::DrugDomainConstraintsEvaluator::Result::Incompatible) {
+                logHelper.warn(drugModel->getDrugModelId() + " incompatible: constraints not respected.");
+                continue;
+            }
+
+            // If the covariates extraction failed.
+            if(constraintsResult == Core::DrugDomainConstraintsEvaluator::Result::ComputationError) {
+                _xpertRequestResult.setErrorMessage("Covariates extraction failed for drug model: " +
+                                                    drugModel->getDrugModelId() +
+                                                    ". It may be caused by covariates that could not be converted.");
+                return;
+            }
         }
 
         try {
             // Compute the score for this drug model.
-            vector<CovariateValidationResult> covariateResults;
+            pmr::vector<CovariateValidationResult> covariateResults(_xpertRequestResult.getArena());
             unsigned score = computeScore(
                         _xpertRequestResult.getTreatment()->getCovariates(),
                         drugModel->getCovariates(),
                         _xpertRequestResult.getXpertRequest().getOutputLang(),
+                        computationTime,
                         covariateResults);
 
             // Compare the score with the score of the best drug model.
@@ -139,6 +175,7 @@ void CovariateValidatorAndModelSelector::perform(XpertRequestResult& _xpertReque
         // Check the language compatibility.
         if (checkCovariateDefinitionsSupportedLanguage(bestModel->getCovariates(), _xpertRequestResult.getXpertRequest().getOutputLang())) {
 
+            FlowStepCache::getInstance().insert(selectionKey, bestModel->getDrugModelId());
             _xpertRequestResult.setCovariateResults(move(covariateValidationResultsOfBestModel));
             _xpertRequestResult.setDrugModel(bestModel);
         // The model does not support the language.
@@ -168,9 +205,10 @@ bool CovariateValidatorAndModelSelector::checkFormulationsAndRoutesCompatibility
     return true;
 }
 
-Common::DateTime CovariateValidatorAndModelSelector::getOldestCovariateDateTime(const Core::PatientVariates& _patientCovariates) const
+Common::DateTime CovariateValidatorAndModelSelector::getOldestCovariateDateTime(const Core::PatientVariates& _patientCovariates,
+                                                                              const Common::DateTime& _computationTime) const
 {
-    Common::DateTime oldestDateTimeKnown = m_computationTime;
+    Common::DateTime oldestDateTimeKnown = _computationTime;
 
     // For each patient's covariate.
     for (const unique_ptr<Core::PatientCovariate>& patientCovariate: _patientCovariates) {
@@ -185,7 +223,8 @@ Common::DateTime CovariateValidatorAndModelSelector::getOldestCovariateDateTime(
 unsigned CovariateValidatorAndModelSelector::computeScore(const Core::PatientVariates& _patientVariates,
                                              const Core::CovariateDefinitions& _modelDefinitions,
                                              OutputLang _lang,
-                                             vector<CovariateValidationResult>& _results) const
+                                             const Common::DateTime& _computationTime,
+                                             pmr::vector<CovariateValidationResult>& _results) const
 {
     unsigned score = 0;
 
@@ -241,7 +280,7 @@ unsigned CovariateValidatorAndModelSelector::computeScore(const Core::PatientVar
                     // Get the age out of patient birthdate covariate.
                     double age = getAgeIn(idToDefinitionFiltered["age"]->getType(),
                                           idToPatient["birthdate"][0]->getValueAsDate(),
-                                           m_computationTime);
+                                           _computationTime);
 
                     // Check the validation.
                     if (checkOperation(age, definition, idToPatient["birthdate"][0], _lang, _results) == false) {
@@ -266,7 +305,7 @@ unsigned CovariateValidatorAndModelSelector::computeScore(const Core::PatientVar
 
                     // Get the value and convert.
                     Core::Value value = Common::Utils::stringToValue( patientCovariate->getValue(), patientCovariate->getDataType());
-                    value = Common::UnitManager::convertToUnit(value, patientCovariate->getUnit(), definition->getUnit());
+                    value = UnitConversionCache::getInstance().convert(value, patientCovariate->getUnit(), definition->getUnit());
 
                     if (checkOperation(value, definition, patientCovariate, _lang, _results) == false && !alreadyScored) {
                         ++score;
@@ -284,7 +323,7 @@ bool CovariateValidatorAndModelSelector::checkOperation(double _patientConverted
                                                         const Core::CovariateDefinition* _definition,
                                                         const Core::PatientCovariate* _patient,
                                                         OutputLang _lang,
-                                                        vector<CovariateValidationResult>& _results) const
+                                                        pmr::vector<CovariateValidationResult>& _results) const
 {
     // Get the validation operation.
     Core::Operation* _op = _definition->getValidation();
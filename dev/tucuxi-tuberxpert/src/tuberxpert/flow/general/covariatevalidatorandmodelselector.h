@@ -35,7 +35,7 @@ public:
     /// \brief For a given XpertRequestResult, get the best drug model and define
     ///        the CovariateValidationResult vector.
     /// \param _xpertRequestResult XpertRequestResult to process.
-    void perform(XpertRequestResult& _xpertRequestResult);
+    void perform(XpertRequestResult& _xpertRequestResult) const;
 
 protected: 
 
@@ -46,9 +46,11 @@ protected:
 
     /// \brief Get the oldest date of the patient's covariates.
     /// \param _patientCovariates List of patient's covariates.
+    /// \param _computationTime Computation time of the query.
     /// \return Date and time of the oldest covariate. If there are no covariates, returns
     ///         the computation time.
-    Common::DateTime getOldestCovariateDateTime(const Core::PatientVariates& _patientCovariates) const;
+    Common::DateTime getOldestCovariateDateTime(const Core::PatientVariates& _patientCovariates,
+                                                const Common::DateTime& _computationTime) const;
 
     /// \brief For some given covariate definitions from a drug model,
     ///        compute the drug model score based on the patient's covariates.
@@ -56,6 +58,7 @@ protected:
     /// \param _modelDefinitions Covariate definitions of the drug model.
     /// \param _lang Language of the xpertRequest to get the correct translation of the error message
     ///         of the definition when filling _results.
+    /// \param _computationTime Computation time of the query, used to get the age of the patient.
     /// \param _results Vector to store the covariate validation results for this model.
     /// \return The score of the model.
     /// \throw invalid_argument When the conversion between the patient covariate and model
@@ -64,7 +67,8 @@ protected:
     unsigned computeScore(const Core::PatientVariates& _patientCovariates,
                           const Core::CovariateDefinitions& _modelDefinitions,
                           OutputLang _lang,
-                          std::vector<CovariateValidationResult>& _results) const;
+                          const Common::DateTime& _computationTime,
+                          std::pmr::vector<CovariateValidationResult>& _results) const;
 
     /// \brief For a given covariate definition, obtain  its validation operation and check
     ///        whether the patient covariate's value is valid.
@@ -82,7 +86,7 @@ protected:
                         const Core::CovariateDefinition* _definition,
                         const Core::PatientCovariate* _patient,
                         OutputLang _lang,
-                        std::vector<CovariateValidationResult>& _results) const;
+                        std::pmr::vector<CovariateValidationResult>& _results) const;
 
     /// \brief For a given set of covariate definitions. This method checks that they
     ///        all support the requested output language or at least English.
@@ -92,13 +96,6 @@ protected:
     /// \return Return true if english or _lang is supported otherwise false.
     bool checkCovariateDefinitionsSupportedLanguage(const Core::CovariateDefinitions& _modelDefinitions,
                                                     OutputLang _lang) const;
-
-protected:
-
-    /// \brief Fix the computation time to get the same age when executing
-    ///        at different times. Retrieved from the XpertRequestResult in perform method.
-    ///        It allows not to be forced to use local time when time-based calculations are needed.
-    Common::DateTime m_computationTime;
 };
 
 } // namespace Xpert
@@ -5,6 +5,7 @@
 #include "tucucommon/unit.h"
 
 #include "tuberxpert/utils/xpertutils.h"
+#include "tuberxpert/utils/unitconversioncache.h"
 #include "tuberxpert/language/languagemanager.h"
 #include "tuberxpert/result/dosevalidationresult.h"
 
@@ -13,7 +14,7 @@ using namespace std;
 namespace Tucuxi {
 namespace Xpert {
 
-void DoseValidator::perform(XpertRequestResult& _xpertRequestResult)
+void DoseValidator::perform(XpertRequestResult& _xpertRequestResult) const
 {
     // Check if there is a treatment.
     if (_xpertRequestResult.getTreatment() == nullptr) {
@@ -32,7 +33,7 @@ void DoseValidator::perform(XpertRequestResult& _xpertRequestResult)
 
     // Explore the dosage history to validate doses.
     try {
-        map<const Core::SingleDose *, DoseValidationResult> results;
+        pmr::map<const Core::SingleDose*, DoseValidationResult> results(_xpertRequestResult.getArena());
         checkDoses(dosageHistory, modelFormulationAndRoutes, results);
         _xpertRequestResult.setDoseResults(move(results));
     } catch (invalid_argument& e) {
@@ -42,7 +43,7 @@ void DoseValidator::perform(XpertRequestResult& _xpertRequestResult)
 
 void DoseValidator::checkDoses(const Core::DosageHistory& _dosageHistory,
                                const Core::FormulationAndRoutes& _modelFormulationsAndRoutes,
-                               map<const Core::SingleDose *, DoseValidationResult>& _results) const
+                               pmr::map<const Core::SingleDose*, DoseValidationResult>& _results) const
 {
 
     // For each dosage time range.
@@ -54,7 +55,7 @@ void DoseValidator::checkDoses(const Core::DosageHistory& _dosageHistory,
 
 void DoseValidator::checkDoses(const Core::DosageTimeRange& _timeRange,
                                const Core::FormulationAndRoutes& _modelFormulationsAndRoutes,
-                               map<const Core::SingleDose*, DoseValidationResult>& _results) const
+                               pmr::map<const Core::SingleDose*, DoseValidationResult>& _results) const
 {
     checkDoses(*_timeRange.getDosage(), _modelFormulationsAndRoutes, _results);
 }
@@ -67,7 +68,7 @@ void DoseValidator::checkDoses(const Core::DosageTimeRange& _timeRange,
 
 void DoseValidator::checkDoses(const Core::Dosage& _dosage,
                                const Core::FormulationAndRoutes& _modelFormulationsAndRoutes,
-                               std::map<const Core::SingleDose*, DoseValidationResult>& _results) const
+                               pmr::map<const Core::SingleDose*, DoseValidationResult>& _results) const
 {
     // The calls order is important here.
     // First start with the subclasses, else it won't work
@@ -80,35 +81,35 @@ void DoseValidator::checkDoses(const Core::Dosage& _dosage,
 
 void DoseValidator::checkDoses(const Core::DosageLoop& _dosageLoop,
                                const Core::FormulationAndRoutes& _modelFormulationsAndRoutes,
-                               map<const Core::SingleDose*, DoseValidationResult>& _results) const
+                               pmr::map<const Core::SingleDose*, DoseValidationResult>& _results) const
 {
     checkDoses(*_dosageLoop.getDosage(), _modelFormulationsAndRoutes, _results);
 }
 
 void DoseValidator::checkDoses(const Core::DosageRepeat& _dosageRepeat,
                                const Core::FormulationAndRoutes& _modelFormulationsAndRoutes,
-                               map<const Core::SingleDose*, DoseValidationResult>& _results) const
+                               pmr::map<const Core::SingleDose*, DoseValidationResult>& _results) const
 {
     checkDoses(*_dosageRepeat.getDosage(), _modelFormulationsAndRoutes, _results);
 }
 
 void DoseValidator::checkDoses(const Core::DosageSequence& _dosageSequence,
                                const Core::FormulationAndRoutes& _modelFormulationsAndRoutes,
-                               map<const Core::SingleDose*, DoseValidationResult>& _results) const
+                               pmr::map<const Core::SingleDose*, DoseValidationResult>& _results) const
 {
     checkDosageBoundedList(_dosageSequence.getDosageList(), _modelFormulationsAndRoutes, _results);
 }
 
 void DoseValidator::checkDoses(const Core::ParallelDosageSequence& _parallelDosageSequence,
                                const Core::FormulationAndRoutes& _modelFormulationsAndRoutes,
-                               map<const Core::SingleDose*, DoseValidationResult>& _results) const
+                               pmr::map<const Core::SingleDose*, DoseValidationResult>& _results) const
 {
     checkDosageBoundedList(_parallelDosageSequence.getDosageList(), _modelFormulationsAndRoutes, _results);
 }
 
 void DoseValidator::checkDosageBoundedList(const Core::DosageBoundedList& _dosageBoundedList,
                                            const Core::FormulationAndRoutes& _modelFormulationsAndRoutes,
-                                           map<const Core::SingleDose*, DoseValidationResult>& _results) const
+                                           pmr::map<const Core::SingleDose*, DoseValidationResult>& _results) const
 {
     // For each dosage.
     for (const std::unique_ptr<Tucuxi::Core::DosageBounded>& dosage : _dosageBoundedList) {
@@ -118,7 +119,7 @@ void DoseValidator::checkDosageBoundedList(const Core::DosageBoundedList& _dosag
 
 void DoseValidator::checkDoses(const Core::SingleDose& _singleDose,
                                const Core::FormulationAndRoutes& _modelFormulationsAndRoutes,
-                               map<const Core::SingleDose*, DoseValidationResult>& _results) const
+                               pmr::map<const Core::SingleDose*, DoseValidationResult>& _results) const
 {
     // Get the formulation and route from the model that is equal to the
     // single dose formulation and route.
@@ -135,7 +136,7 @@ void DoseValidator::checkDoses(const Core::SingleDose& _singleDose,
         const Core::FullFormulationAndRoute* ModelFormAndRoute = compatibleFormulationAndRouteIt.base()->get();
 
         // Convert the single dose value to match model formulation and route unit.
-        double value = Common::UnitManager::convertToUnit(_singleDose.getDose(), _singleDose.getDoseUnit(), ModelFormAndRoute->getValidDoses()->getUnit());
+        double value = UnitConversionCache::getInstance().convert(_singleDose.getDose(), _singleDose.getDoseUnit(), ModelFormAndRoute->getValidDoses()->getUnit());
 
         // Checking if limits are respected.
         string warning = "";
@@ -29,7 +29,7 @@ public:
     ///        If the evaluation fails (for example: incompatible dose units) the XpertRequestResult
     ///        is invalidated (i.e. it gets an error).
     /// \param _xpertRequestResult XpertRequestResult to evaluate doses.
-    void perform(XpertRequestResult& _xpertRequestResult);
+    void perform(XpertRequestResult& _xpertRequestResult) const;
 
 protected:
 
@@ -41,7 +41,7 @@ protected:
     ///                         if unit conversions have failed.
     void checkDoses(const Core::DosageHistory& _dosageHistory,
                     const Core::FormulationAndRoutes& _modelFormulationsAndRoutes,
-                    std::map<const Core::SingleDose*, DoseValidationResult>& _results) const;
+                    std::pmr::map<const Core::SingleDose*, DoseValidationResult>& _results) const;
 
     /// \brief Parse a given DosageTimeRange and evaluate the contained doses.
     /// \param _timeRange Dosage time range to parse.
@@ -51,7 +51,7 @@ protected:
     ///                         if unit conversions have failed.
     void checkDoses(const Core::DosageTimeRange& _timeRange,
                     const Core::FormulationAndRoutes& _modelFormulationsAndRoutes,
-                    std::map<const Core::SingleDose*, DoseValidationResult>& _results) const;
+                    std::pmr::map<const Core::SingleDose*, DoseValidationResult>& _results) const;
 
     /// \brief Convert an abstract dosage to its real type to call the corresponding checkDoses method.
     /// \param _dosage Dosage to convert.
@@ -61,7 +61,7 @@ protected:
     ///                         if unit conversions have failed.
     void checkDoses(const Core::Dosage& _dosage,
                     const Core::FormulationAndRoutes& _modelFormulationsAndRoutes,
-                    std::map<const Core::SingleDose*, DoseValidationResult>& _results) const;
+                    std::pmr::map<const Core::SingleDose*, DoseValidationResult>& _results) const;
 
     /// \brief Parse a given DosageLoop and evaluate the contained doses.
     /// \param _dosageLoop Dosage loop to parse.
@@ -71,7 +71,7 @@ protected:
     ///                         if unit conversions have failed.
     void checkDoses(const Core::DosageLoop& _dosageLoop,
                     const Core::FormulationAndRoutes& _modelFormulationsAndRoutes,
-                    std::map<const Core::SingleDose*, DoseValidationResult>& _results) const;
+                    std::pmr::map<const Core::SingleDose*, DoseValidationResult>& _results) const;
 
     /// \brief Parse a given DosageRepeat and evaluate the contained doses.
     /// \param _dosageRepeat Dosage repeat to parse.
@@ -81,7 +81,7 @@ protected:
     ///                         if unit conversions have failed.
     void checkDoses(const Core::DosageRepeat& _dosageRepeat,
                     const Core::FormulationAndRoutes& _modelFormulationsAndRoutes,
-                    std::map<const Core::SingleDose*, DoseValidationResult>& _results) const;
+                    std::pmr::map<const Core::SingleDose*, DoseValidationResult>& _results) const;
 
     /// \brief Parse a given DosageSequence and evaluate the contained doses.
     /// \param _dosageSequence Dosage sequence to parse.
@@ -91,7 +91,7 @@ protected:
     ///                         if unit conversions have failed.
     void checkDoses(const Core::DosageSequence& _dosageSequence,
                     const Core::FormulationAndRoutes& _modelFormulationsAndRoutes,
-                    std::map<const Core::SingleDose*, DoseValidationResult>& _results) const;
+                    std::pmr::map<const Core::SingleDose*, DoseValidationResult>& _results) const;
 
     /// \brief Parse a given ParallelDosageSequence and evaluate the contained doses.
     /// \param _parallelDosageSequence Parallel dosage sequence to parse.
@@ -101,7 +101,7 @@ protected:
     ///                         if unit conversions have failed.
     void checkDoses(const Core::ParallelDosageSequence& _parallelDosageSequence,
                     const Core::FormulationAndRoutes& _modelFormulationsAndRoutes,
-                    std::map<const Core::SingleDose*, DoseValidationResult>& _results) const;
+                    std::pmr::map<const Core::SingleDose*, DoseValidationResult>& _results) const;
 
     /// \brief Parse all doses from a DosageBoundedList. Mainly used by check dose method with
     ///        dosage sequence and parallel dosage sequence.
@@ -112,7 +112,7 @@ protected:
     ///                         if unit conversions have failed.
     void checkDosageBoundedList(const Core::DosageBoundedList& _dosageBoundedList,
                                 const Core::FormulationAndRoutes& _modelFormulationsAndRoutes,
-                                std::map<const Core::SingleDose*, DoseValidationResult>& _results) const;
+                                std::pmr::map<const Core::SingleDose*, DoseValidationResult>& _results) const;
 
     /// \brief For a single dose, check its compatibility with the drug model's recommended doses.
     ///        The drug model doses are located in the list of formulations and routes in argument.
@@ -123,7 +123,7 @@ protected:
     ///                         if unit conversion has failed.
     void checkDoses(const Core::SingleDose& _singleDose,
                     const Core::FormulationAndRoutes& _modelFormulationsAndRoutes,
-                    std::map<const Core::SingleDose*, DoseValidationResult>& _results) const;
+                    std::pmr::map<const Core::SingleDose*, DoseValidationResult>& _results) const;
 };
 
 } // namespace Xpert
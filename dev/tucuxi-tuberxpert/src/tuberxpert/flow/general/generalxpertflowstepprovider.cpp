@@ -13,15 +13,25 @@ using namespace std;
 namespace Tucuxi {
 namespace Xpert {
 
-GeneralXpertFlowStepProvider::GeneralXpertFlowStepProvider()
+GeneralXpertFlowStepProvider::GeneralXpertFlowStepProvider() :
+    GeneralXpertFlowStepProvider(PointDensity(20), PointDensity(20), PointDensity(6))
+{}
+
+GeneralXpertFlowStepProvider::GeneralXpertFlowStepProvider(const PointDensity& _sampleValidatorPointDensity,
+                                                           const PointDensity& _adjustmentPointDensity,
+                                                           const PointDensity& _steadyStatePointDensity,
+                                                           GraphBackend _htmlGraphBackend,
+                                                           GraphBackend _pdfGraphBackend,
+                                                           size_t _maxNbCandidates,
+                                                           size_t _maxNbCandidatesWithCurves)
 {
     m_covariateValidatorAndModelSelector = make_unique<CovariateValidatorAndModelSelector>();
     m_doseValidator = make_unique<DoseValidator>();
-    m_sampleValidator = make_unique<SampleValidator>();
+    m_sampleValidator = make_unique<SampleValidator>(_sampleValidatorPointDensity);
     m_targetValidator = make_unique<TargetValidator>();
-    m_adjustmentTraitCreator = make_unique<AdjustmentTraitCreator>();
-    m_requestExecutor = make_unique<RequestExecutor>();
-    m_reportPrinter = make_unique<ReportPrinter>();
+    m_adjustmentTraitCreator = make_unique<AdjustmentTraitCreator>(_adjustmentPointDensity);
+    m_requestExecutor = make_unique<RequestExecutor>(_steadyStatePointDensity, _maxNbCandidates, _maxNbCandidatesWithCurves);
+    m_reportPrinter = make_unique<ReportPrinter>(_htmlGraphBackend, _pdfGraphBackend);
 }
 
 const std::unique_ptr<AbstractXpertFlowStep>& GeneralXpertFlowStepProvider::getCovariateValidatorAndModelSelector() const
@@ -1,9 +1,12 @@
 #ifndef GENERALXPERTFLOWSTEPPROVIDER_H
 #define GENERALXPERTFLOWSTEPPROVIDER_H
 
+#include <cstddef>
 #include <memory>
 
+#include "tuberxpert/exporter/xpertrequestresulthtmlexport.h"
 #include "tuberxpert/flow/abstract/abstractxpertflowstepprovider.h"
+#include "tuberxpert/utils/pointdensity.h"
 
 namespace Tucuxi {
 namespace Xpert {
@@ -24,9 +27,27 @@ class GeneralXpertFlowStepProvider : public AbstractXpertFlowStepProvider
 {
 public:
 
-    /// \brief Constructor. Set the general flow steps (mainly generic/non-drug specific).
+    /// \brief Constructor. Set the general flow steps (mainly generic/non-drug specific)
+    ///        with the default fixed point densities.
     GeneralXpertFlowStepProvider();
 
+    /// \brief Constructor. Set the general flow steps with the given point densities.
+    ///        Drug specific providers can use it to tune the densities of the computing steps.
+    /// \param _sampleValidatorPointDensity Point density of the SampleValidator percentiles traits.
+    /// \param _adjustmentPointDensity Point density of the adjustment trait made by the AdjustmentTraitCreator.
+    /// \param _steadyStatePointDensity Point density of the RequestExecutor steady state cycle prediction.
+    /// \param _htmlGraphBackend How the ReportPrinter draws the graphs of the HTML reports.
+    /// \param _pdfGraphBackend How the ReportPrinter draws the graphs of the PDF reports.
+    /// \param _maxNbCandidates Maximum number of adjustment candidates kept by the RequestExecutor.
+    /// \param _maxNbCandidatesWithCurves Maximum number of best adjustment candidates whose curves are kept by the RequestExecutor.
+    GeneralXpertFlowStepProvider(const PointDensity& _sampleValidatorPointDensity,
+                                 const PointDensity& _adjustmentPointDensity,
+                                 const PointDensity& _steadyStatePointDensity,
+                                 GraphBackend _htmlGraphBackend = GraphBackend::JAVASCRIPT,
+                                 GraphBackend _pdfGraphBackend = GraphBackend::SVG,
+                                 std::size_t _maxNbCandidates = 10,
+                                 std::size_t _maxNbCandidatesWithCurves = 3);
+
     /// \brief Get the step responsible for covariate validation and drug model selection.
     /// \return An instance of CovariateValidatorAndModelSelector.
     const std::unique_ptr<AbstractXpertFlowStep>& getCovariateValidatorAndModelSelector() const override;
@@ -13,7 +13,11 @@ using namespace std;
 namespace Tucuxi {
 namespace Xpert {
 
-void ReportPrinter::perform(XpertRequestResult& _xpertRequestResult)
+ReportPrinter::ReportPrinter(GraphBackend _htmlGraphBackend, GraphBackend _pdfGraphBackend) :
+    m_htmlGraphBackend(_htmlGraphBackend), m_pdfGraphBackend(_pdfGraphBackend)
+{}
+
+void ReportPrinter::perform(XpertRequestResult& _xpertRequestResult) const
 {
     // Extract the request format.
     OutputFormat desiredOutputFormat = _xpertRequestResult.getXpertRequest().getOutputFormat();
@@ -23,8 +27,8 @@ void ReportPrinter::perform(XpertRequestResult& _xpertRequestResult)
     // Select the cooresponding exporter.
     switch(desiredOutputFormat) {
     case OutputFormat::XML  : exporter = make_unique<XpertRequestResultXmlExport>(); break;
-    case OutputFormat::HTML : exporter = make_unique<XpertRequestResultHtmlExport>(); break;
-    case OutputFormat::PDF  : exporter = make_unique<XpertRequestResultPdfExport>(make_unique<XpertRequestResultHtmlExport>()); break;
+    case OutputFormat::HTML : exporter = make_unique<XpertRequestResultHtmlExport>(m_htmlGraphBackend); break;
+    case OutputFormat::PDF  : exporter = make_unique<XpertRequestResultPdfExport>(make_unique<XpertRequestResultHtmlExport>(m_pdfGraphBackend)); break;
     }
 
     // Launch export.
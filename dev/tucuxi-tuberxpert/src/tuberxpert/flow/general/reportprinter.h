@@ -1,6 +1,7 @@
 #ifndef REPORTPRINTER_H
 #define REPORTPRINTER_H
 
+#include "tuberxpert/exporter/xpertrequestresulthtmlexport.h"
 #include "tuberxpert/flow/abstract/abstractxpertflowstep.h"
 #include "tuberxpert/result/xpertrequestresult.h"
 
@@ -17,16 +18,32 @@ namespace Xpert {
 ///            - XpertRequestResultHtmlExport
 ///            - XpertRequestResultPdfExport
 ///
+///        The graphs of the HTML and PDF reports can be drawn by JavaScript or rendered
+///        as SVG. By default, the PDF report uses SVG so that wkhtmltopdf runs no script.
+///
 /// \date 23/06/2022
 /// \author Herzig Melvyn
 class ReportPrinter : public AbstractXpertFlowStep
 {
 public:
 
+    /// \brief Constructor.
+    /// \param _htmlGraphBackend How to draw the graphs of the HTML reports.
+    /// \param _pdfGraphBackend How to draw the graphs of the PDF reports.
+    ReportPrinter(GraphBackend _htmlGraphBackend = GraphBackend::JAVASCRIPT,
+                  GraphBackend _pdfGraphBackend = GraphBackend::SVG);
+
     /// \brief Select the corresponding exporter and send him the XpertRequestResult.
     /// \param _xpertRequestResult XpertRequestResult to export.
-    void perform(XpertRequestResult& _xpertRequestResult) override;
+    void perform(XpertRequestResult& _xpertRequestResult) const override;
+
+protected:
+
+    /// \brief How to draw the graphs of the HTML reports.
+    const GraphBackend m_htmlGraphBackend;
 
+    /// \brief How to draw the graphs of the PDF reports.
+    const GraphBackend m_pdfGraphBackend;
 };
 
 } // namespace Xpert
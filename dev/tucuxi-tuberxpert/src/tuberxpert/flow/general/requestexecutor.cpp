@@ -1,15 +1,31 @@
 #include "requestexecutor.h"
 
+#include <algorithm>
+#include <chrono>
 #include <memory>
 
+#include "tucucore/intakeevent.h"
+#include "tucucore/intakeextractor.h"
+#include "tucucore/computingservice/computingresponse.h"
+
+#include "tuberxpert/utils/adjustmenttraitview.h"
 #include "tuberxpert/utils/xpertutils.h"
+#include "tuberxpert/utils/unitconversioncache.h"
 
 using namespace std;
 
 namespace Tucuxi {
 namespace Xpert {
 
-void RequestExecutor::perform(XpertRequestResult& _xpertRequestResult)
+RequestExecutor::RequestExecutor(const PointDensity& _steadyStatePointDensity,
+                                 size_t _maxNbCandidates,
+                                 size_t _maxNbCandidatesWithCurves) :
+    m_steadyStatePointDensity(_steadyStatePointDensity),
+    m_maxNbCandidates(max<size_t>(_maxNbCandidates, 1)),
+    m_maxNbCandidatesWithCurves(max<size_t>(_maxNbCandidatesWithCurves, 1))
+{}
+
+void RequestExecutor::perform(XpertRequestResult& _xpertRequestResult) const
 {
     // Check if there is an adjustment trait.
     if (_xpertRequestResult.getAdjustmentTrait() == nullptr) {
@@ -23,31 +39,32 @@ void RequestExecutor::perform(XpertRequestResult& _xpertRequestResult)
         return;
     }
 
-    // Create a copy of the adjustment trait and prepare the response holder.
-    unique_ptr<Core::ComputingTraitAdjustment> baseAdjustmentTrait = make_unique<Core::ComputingTraitAdjustment>(*_xpertRequestResult.getAdjustmentTrait());
-    unique_ptr<Core::AdjustmentData> adjustmentResult = nullptr;
-
-    // Execute the request
-    executeRequestAndGetResult<Core::ComputingTraitAdjustment, Core::AdjustmentData>(move(baseAdjustmentTrait), _xpertRequestResult, adjustmentResult);
+    // Execute the request. Tucuxi core owns the trait of its request, so the shared trait is materialized once for it.
+    RequestResult<Core::AdjustmentData> adjustmentResult = executeRequest(AdjustmentTraitView(_xpertRequestResult.getAdjustmentTrait()).materialize(),
+                                                                          _xpertRequestResult);
 
     // If the request execution failed
-    if (adjustmentResult == nullptr){
+    if (!adjustmentResult.isOk()){
         _xpertRequestResult.setErrorMessage("Adjustment request execution failed.");
         return;
 
     // If all went well.
     } else {
 
-        if (adjustmentResult->getAdjustments().empty()) {
+        if (adjustmentResult.getData().getAdjustments().empty()) {
             _xpertRequestResult.setErrorMessage("No adjustment found.");
             return;
         }
 
+        // Only keep what the reports present.
+        unique_ptr<Core::AdjustmentData> adjustmentData = adjustmentResult.takeData();
+        limitCandidates(*adjustmentData);
+
         // Save the parameters for the current request type (A priori or A posteriori).
-        _xpertRequestResult.addParameters(adjustmentResult->getAdjustments().front().getData().front().m_parameters);
+        _xpertRequestResult.addParameters(adjustmentData->getAdjustments().front().getData().front().m_parameters);
 
         // Save the adjustment data into the XpertRequestResult
-        _xpertRequestResult.setAdjustmentData(move(adjustmentResult));
+        _xpertRequestResult.setAdjustmentData(move(adjustmentData));
 
         // Get the statistics at steady state and the parameters of previous type.
         gatherAdditionalData(_xpertRequestResult);
@@ -56,126 +73,145 @@ void RequestExecutor::perform(XpertRequestResult& _xpertRequestResult)
     }
 }
 
-void RequestExecutor::gatherAdditionalData(XpertRequestResult& _xpertRequestResult) const
+void RequestExecutor::limitCandidates(Core::AdjustmentData& _adjustmentData) const
 {
-    unique_ptr<Core::ComputingTraitAdjustment> baseAdjustmentTrait = make_unique<Core::ComputingTraitAdjustment>(*_xpertRequestResult.getAdjustmentTrait());
+    // The candidates are limited in place, the kept ones are neither copied nor moved.
+    vector<Core::DosageAdjustment>& adjustments = _adjustmentData.getModifiableAdjustments();
 
-    // ------- statistics at steady state ---------
+    // The removed candidates and their curves are released here.
+    if (adjustments.size() > m_maxNbCandidates) {
+        adjustments.erase(adjustments.begin() + m_maxNbCandidates, adjustments.end());
+    }
 
-    // Update the end time to approximate a steady state to extract the statistics at steady state.
-    // Ideally, this would have been done in a single query, but it is not possible to remove the extra cycle
-    // data in the current core state. We should have included them with the xpert request result.
-    // A steady state is approximated with adjustment time + multiplier * half life.
-    const Core::HalfLife& halfLife = _xpertRequestResult.getDrugModel()->getTimeConsiderations().getHalfLife();
-    double hoursToAdd = Common::UnitManager::convertToUnit(halfLife.getValue(), halfLife.getUnit(), Common::TucuUnit("h"));
-    Common::DateTime staeadyEndTime = baseAdjustmentTrait->getAdjustmentTime() + Duration(chrono::hours(int(halfLife.getMultiplier() * hoursToAdd)));
-
-    // Create the computing trait that goes to steady state.
-    unique_ptr<Core::ComputingTraitAdjustment> steadyStateAdustmentTrait = nullptr;
-    tweakComputingTraitAdjustment(baseAdjustmentTrait,
-                                  staeadyEndTime,
-                                  20,
-                                  baseAdjustmentTrait->getComputingOption().getParametersType(),
-                                  steadyStateAdustmentTrait);
-    unique_ptr<Core::AdjustmentData> steadyAdjustmentResult = nullptr;
+    // Release the curves of the candidates that are only listed.
+    for (size_t i = m_maxNbCandidatesWithCurves; i < adjustments.size(); ++i) {
+        vector<Core::CycleData>().swap(adjustments[i].m_data);
+    }
+}
 
-    // Execute the request.
-    executeRequestAndGetResult<Core::ComputingTraitAdjustment, Core::AdjustmentData>(move(steadyStateAdustmentTrait), _xpertRequestResult, steadyAdjustmentResult);
+void RequestExecutor::gatherAdditionalData(XpertRequestResult& _xpertRequestResult) const
+{
+    const Core::ComputingTraitAdjustment& baseAdjustmentTrait = *_xpertRequestResult.getAdjustmentTrait();
 
-    // If execution failed.
-    if (steadyAdjustmentResult == nullptr){
+    // ------- statistics at steady state ---------
+
+    if (!computeSteadyStateStatistics(_xpertRequestResult, baseAdjustmentTrait)) {
         _xpertRequestResult.setErrorMessage("Failed to extract statistics at steady state.");
         return;
-    } else {
-
-        // Extracting the statistics at steady state for the best adjustment.
-        _xpertRequestResult.setCycleStats(steadyAdjustmentResult->getAdjustments().front().getData().back().m_statistics);
     }
 
     // ------- Parameters type "A priori" ---------
 
     // We don't want to extract them again, so we check the base trait prediction parameter type.
-    if (baseAdjustmentTrait->getComputingOption().getParametersType() == Core::PredictionParameterType::Aposteriori) {
-
-        // Create a computing trait A priori.
-        unique_ptr<Core::ComputingTraitAdjustment> aprioriAdustmentTrait = nullptr;
-        tweakComputingTraitAdjustment(baseAdjustmentTrait,
-                                      baseAdjustmentTrait->getEnd(),
-                                      1,
-                                      Core::PredictionParameterType::Apriori,
-                                      aprioriAdustmentTrait);
-        unique_ptr<Core::AdjustmentData> aprioriAdjustmentResult = nullptr;
-
-        // Execute the request.
-        executeRequestAndGetResult<Core::ComputingTraitAdjustment, Core::AdjustmentData>(move(aprioriAdustmentTrait), _xpertRequestResult, aprioriAdjustmentResult);
-
-        // If execution failed.
-        if (aprioriAdjustmentResult == nullptr){
+    if (baseAdjustmentTrait.getComputingOption().getParametersType() == Core::PredictionParameterType::Aposteriori) {
+
+        if (!extractParameters(_xpertRequestResult, Core::PredictionParameterType::Apriori)) {
             _xpertRequestResult.setErrorMessage("Failed to extract apriori parameters.");
             return;
-        } else {
-
-            // Saving the "A priori" parameters.
-            _xpertRequestResult.addParameters(aprioriAdjustmentResult->getAdjustments().front().getData().front().m_parameters);
         }
     }
 
     // ------- Parameters "Typical patient" ---------
 
-    // Create the computing trait for population.
-    unique_ptr<Core::ComputingTraitAdjustment> populationAdustmentTrait = nullptr;
-    tweakComputingTraitAdjustment(baseAdjustmentTrait,
-                                  baseAdjustmentTrait->getEnd(),
-                                  1,
-                                  Core::PredictionParameterType::Population,
-                                  populationAdustmentTrait);
-    unique_ptr<Core::AdjustmentData> populationAdjustmentResult = nullptr;
-
-    // Execute the request
-    executeRequestAndGetResult<Core::ComputingTraitAdjustment, Core::AdjustmentData>(move(populationAdustmentTrait), _xpertRequestResult, populationAdjustmentResult);
-
-    // If execution failed.
-    if (populationAdjustmentResult == nullptr){
+    if (!extractParameters(_xpertRequestResult, Core::PredictionParameterType::Population)) {
         _xpertRequestResult.setErrorMessage("Failed to extract population parameters.");
         return;
-    } else {
-        // Saving the "Typical patient" parameters.
-        _xpertRequestResult.addParameters(populationAdjustmentResult->getAdjustments().front().getData().front().m_parameters);
     }
 }
 
-void RequestExecutor::tweakComputingTraitAdjustment(const unique_ptr<Core::ComputingTraitAdjustment>& _baseTrait,
-                                                          const Common::DateTime& _newEnd,
-                                                          double _newNbPointsPerHour,
-                                                          Core::PredictionParameterType _newPredictionType,
-                                                          std::unique_ptr<Core::ComputingTraitAdjustment>& _resultingAdjustment) const
+bool RequestExecutor::computeSteadyStateStatistics(XpertRequestResult& _xpertRequestResult,
+                                                   const Core::ComputingTraitAdjustment& _baseTrait) const
 {
+    const Core::DosageAdjustment& bestAdjustment = _xpertRequestResult.getAdjustmentData()->getAdjustments().front();
+
+    // A steady state is approximated with adjustment time + multiplier * half life.
+    const Core::HalfLife& halfLife = _xpertRequestResult.getDrugModel()->getTimeConsiderations().getHalfLife();
+    double hoursToAdd = UnitConversionCache::getInstance().convert(halfLife.getValue(), halfLife.getUnit(), Common::TucuUnit("h"));
+    Common::DateTime steadyStateTime = _baseTrait.getAdjustmentTime() + Duration(chrono::hours(int(halfLife.getMultiplier() * hoursToAdd)));
+
+    // Find the last intake of the best dosage before the steady state time. Its interval is the
+    // steady state cycle. Only the times are used, so the dose unit does not matter.
+    Core::IntakeExtractor intakeExtractor;
+    Core::IntakeSeries intakes;
+    Core::ComputingStatus cs = intakeExtractor.extract(bestAdjustment.m_history,
+                                                       _baseTrait.getAdjustmentTime(),
+                                                       steadyStateTime,
+                                                       1,
+                                                       Common::TucuUnit("mg"),
+                                                       intakes);
+
+    if (cs != Core::ComputingStatus::Ok || intakes.empty()) {
+        return false;
+    }
+
+    Common::DateTime cycleStart = intakes.back().getEventTime();
+    Common::DateTime cycleEnd = cycleStart + intakes.back().getInterval();
+
+    // Build the treatment the core would use for the best dosage: the patient history followed by the
+    // best dosage. The covariates and samples are kept so that the parameters are the same as the adjustment's.
+    const unique_ptr<Core::DrugTreatment>& drugTreatment = _xpertRequestResult.getTreatment();
+    Core::DrugTreatment steadyStateTreatment;
+
+    for (const unique_ptr<Core::DosageTimeRange>& timeRange : drugTreatment->getDosageHistory().getDosageTimeRanges()) {
+        steadyStateTreatment.getModifiableDosageHistory().addTimeRange(*timeRange);
+    }
+    steadyStateTreatment.getModifiableDosageHistory().mergeDosage(&bestAdjustment.m_history);
+
+    for (const unique_ptr<Core::PatientCovariate>& covariate : drugTreatment->getCovariates()) {
+        steadyStateTreatment.addCovariate(make_unique<Core::PatientCovariate>(*covariate));
+    }
+
+    for (const unique_ptr<Core::Sample>& sample : drugTreatment->getSamples()) {
+        steadyStateTreatment.addSample(make_unique<Core::Sample>(*sample));
+    }
 
-    // Make new computing option with the new prediction parameter type.
-    Core::ComputingOption newOptions{
-        _newPredictionType,
-        _baseTrait->getComputingOption().getCompartmentsOption(),
-        _baseTrait->getComputingOption().retrieveStatistics(),
-        _baseTrait->getComputingOption().retrieveParameters(),
-        _baseTrait->getComputingOption().retrieveCovariates()
-    };
-
-    // Make a new adjustment trait with new number of points per hour, new end time and
-    // for the best dosage.
-    _resultingAdjustment = make_unique<Core::ComputingTraitAdjustment>(
+    // Only predict the steady state cycle, with a density locally refined for its peak. The core
+    // starts the intakes extraction half life * multiplier before the cycle start, so the residual
+    // of the previous intakes is accumulated by superposition without being stored.
+    unique_ptr<Core::ComputingTraitConcentration> steadyStateTrait = make_unique<Core::ComputingTraitConcentration>(
                 "",
-                _baseTrait->getStart(),
-                _newEnd,
-                _newNbPointsPerHour,
-                newOptions,
-                _baseTrait->getAdjustmentTime(),
-                Core::BestCandidatesOption::BestDosage,
-                _baseTrait->getLoadingOption(),
-                _baseTrait->getRestPeriodOption(),
-                _baseTrait->getSteadyStateTargetOption(),
-                _baseTrait->getTargetExtractionOption(),
-                _baseTrait->getFormulationAndRouteSelectionOption()
-                );
+                cycleStart,
+                cycleEnd,
+                m_steadyStatePointDensity.getNbPointsPerHour(*_xpertRequestResult.getDrugModel(), intakes.back().getInterval()),
+                _baseTrait.getComputingOption());
+
+    // Execute the request.
+    RequestResult<Core::SinglePredictionData> steadyStateResult = executeRequest(move(steadyStateTrait),
+                                                                                 _xpertRequestResult,
+                                                                                 steadyStateTreatment);
+
+    // If execution failed.
+    if (!steadyStateResult.isOk() || steadyStateResult.getData().getData().empty()) {
+        return false;
+    }
+
+    // The first cycle data is the one starting at the steady state intake.
+    _xpertRequestResult.setCycleStats(steadyStateResult.getData().getData().front().m_statistics);
+
+    return true;
+}
+
+bool RequestExecutor::extractParameters(XpertRequestResult& _xpertRequestResult,
+                                        Core::PredictionParameterType _parametersType) const
+{
+    // Derive the trait from the shared one, only the overrides are stored until the submission.
+    AdjustmentTraitView parametersTrait = AdjustmentTraitView(_xpertRequestResult.getAdjustmentTrait())
+            .withNbPointsPerHour(1)
+            .withParametersType(_parametersType)
+            .withCandidatesOption(Core::BestCandidatesOption::BestDosage);
+
+    // Execute the request.
+    RequestResult<Core::AdjustmentData> parametersResult = executeRequest(parametersTrait.materialize(), _xpertRequestResult);
+
+    // If execution failed.
+    if (!parametersResult.isOk() || parametersResult.getData().getAdjustments().empty()) {
+        return false;
+    }
+
+    // Saving the parameters.
+    _xpertRequestResult.addParameters(parametersResult.getData().getAdjustments().front().getData().front().m_parameters);
+
+    return true;
 }
 
 } // namespace Xpert
@@ -1,47 +1,82 @@
 #ifndef REQUESTEXECUTOR_H
 #define REQUESTEXECUTOR_H
 
+#include <cstddef>
+
 #include "tuberxpert/flow/abstract/abstractxpertflowstep.h"
 #include "tuberxpert/result/xpertrequestresult.h"
+#include "tuberxpert/utils/pointdensity.h"
 
 namespace Tucuxi {
 namespace Xpert {
 
 /// \brief This step takes the adjustment trait in the XpertRequestResult
 ///        and executes it, then makes a new request to extract statistics
-///        at steady states and requests to get parameters at "previous types".
+///        on the steady state cycle and requests to get parameters at "previous types".
 /// \date 25/06/2022
 /// \author Herzig Melvyn
 class RequestExecutor : public AbstractXpertFlowStep
 {
 public:
 
+    /// \brief Constructor.
+    /// \param _steadyStatePointDensity Point density of the steady state cycle prediction.
+    /// \param _maxNbCandidates Maximum number of adjustment candidates kept after the computation (at least 1).
+    /// \param _maxNbCandidatesWithCurves Maximum number of best candidates that keep their curves (at least 1).
+    RequestExecutor(const PointDensity& _steadyStatePointDensity = PointDensity(6),
+                    std::size_t _maxNbCandidates = 10,
+                    std::size_t _maxNbCandidatesWithCurves = 3);
+
     /// \brief Extract the adjustment trait from the XpertRequestResult, make the request for Tucuxi core and submit it.
     ///        If something fails, the error message of the XpertRequestResult is set and it must not be processed anymore.
     /// \param _xpertRequestResult XpertRequestResult containing the adjustment trait to use.
-    void perform(XpertRequestResult& _xpertRequestResult) override;
+    void perform(XpertRequestResult& _xpertRequestResult) const override;
 
 protected:
 
+    /// \brief Limit the adjustment candidates right after the computation. The core returns the best candidate
+    ///        of each interval with its curves, but the reports only present the best ones.
+    ///        Only the first maximum number of candidates are kept (they are sorted by score) and only
+    ///        the first maximum number of candidates with curves keep their cycle data.
+    /// \param _adjustmentData Adjustment data whose candidates are limited.
+    void limitCandidates(Core::AdjustmentData& _adjustmentData) const;
+
     /// \brief This method is called after the first request to Tucuxi core succeed (in perform).
     ///        It collects the statistics at steady state and the parameters for previous prediction types.
-    ///        To do so, it creates new traits the extend the end date to reach steady state or that change the parameters type.
+    ///        To do so, it derives views of the shared adjustment trait that change the parameters type
+    ///        and only materializes the trait of each request when it is submitted.
     /// \param _xpertRequestResult XpertRequestResult to set the additional data and to get the base adjustment trait.
     void gatherAdditionalData(XpertRequestResult& _xpertRequestResult) const;
 
-    /// \brief Copy a computing adjustment trait but with a different end time,
-    ///        points per hour or prediction parameter type. Set the best candidate option to BestDosage,
-    ///        since that is the only one we are interested in.
-    /// \param _baseTrait Base adjustment trait to copy.
-    /// \param _newEnd New end time to use.
-    /// \param _newNbPointsPerHour New number of points per hour to use.
-    /// \param _newPredictionType New prediction parameters type to use.
-    /// \param _resultingAdjustment Resulting new adjustment trait.
-    void tweakComputingTraitAdjustment(const std::unique_ptr<Core::ComputingTraitAdjustment>& _baseTrait,
-                                       const Common::DateTime& _newEnd,
-                                       double _newNbPointsPerHour,
-                                       Core::PredictionParameterType _newPredictionType,
-                                       std::unique_ptr<Core::ComputingTraitAdjustment>& _resultingAdjustment) const;
+    /// \brief Compute the statistics at steady state of the best dosage and set them in the XpertRequestResult.
+    ///        Instead of extending the whole adjustment until steady state, only the cycle of the best dosage
+    ///        reached after adjustment time + half life * multiplier is predicted, with the steady state point density.
+    /// \param _xpertRequestResult XpertRequestResult containing the adjustment data and where to set the statistics.
+    /// \param _baseTrait Adjustment trait used for the adjustment data.
+    /// \return True if the statistics have been set, otherwise false.
+    bool computeSteadyStateStatistics(XpertRequestResult& _xpertRequestResult,
+                                      const Core::ComputingTraitAdjustment& _baseTrait) const;
+
+    /// \brief Submit the parameters extraction request of a prediction parameters type and add the parameters
+    ///        in the XpertRequestResult. The trait only keeps the best dosage with one point per hour,
+    ///        since only the parameters are of interest.
+    /// \param _xpertRequestResult XpertRequestResult where to add the parameters and containing the base adjustment trait.
+    /// \param _parametersType Prediction parameters type to extract.
+    /// \return True if the parameters have been added, otherwise false.
+    bool extractParameters(XpertRequestResult& _xpertRequestResult,
+                           Core::PredictionParameterType _parametersType) const;
+
+protected:
+
+    /// \brief Point density of the steady state cycle prediction. The statistics
+    ///        only need the shape of a single cycle, so it is lower than the adjustment one.
+    PointDensity m_steadyStatePointDensity;
+
+    /// \brief Maximum number of adjustment candidates kept after the computation.
+    std::size_t m_maxNbCandidates;
+
+    /// \brief Maximum number of best adjustment candidates that keep their curves.
+    std::size_t m_maxNbCandidatesWithCurves;
 };
 
 } // namespace Xpert
@@ -6,6 +6,10 @@
 #include <chrono>
 #include <map>
 #include <sstream>
+#include <cmath>
+#include <algorithm>
+#include <iomanip>
+#include <limits>
 
 #include <iostream>
 
@@ -13,14 +17,23 @@
 #include "tucucore/computingservice/computingtrait.h"
 #include "tucucore/definitions.h"
 
+#include "tuberxpert/utils/flowstepcache.h"
 #include "tuberxpert/utils/xpertutils.h"
+#include "tuberxpert/utils/unitconversioncache.h"
 
 using namespace std;
 
 namespace Tucuxi {
 namespace Xpert {
 
-void SampleValidator::perform(XpertRequestResult& _xpertRequestResult)
+SampleValidator::SampleValidator(const PointDensity& _pointDensity, const Core::PercentileRanks& _keptRanks) :
+    m_pointDensity(_pointDensity), m_keptRanks(_keptRanks)
+{
+    // The kept percentiles are stored in ascending order of rank.
+    sort(m_keptRanks.begin(), m_keptRanks.end());
+}
+
+void SampleValidator::perform(XpertRequestResult& _xpertRequestResult) const
 {
     // Check if there is a treatment.
     if (_xpertRequestResult.getTreatment() == nullptr) {
@@ -41,33 +54,83 @@ void SampleValidator::perform(XpertRequestResult& _xpertRequestResult)
         return;
     }
 
-    vector<SampleValidationResult> results;
+    pmr::vector<SampleValidationResult> results(_xpertRequestResult.getArena());
+    pmr::map<const Core::Sample*, SamplePercentiles> samplePercentiles(_xpertRequestResult.getArena());
+
+    const unique_ptr<Core::DrugTreatment>& drugTreatment = _xpertRequestResult.getTreatment();
+
+    // The intakes are only needed when the density depends on the cycle around the sample or to find
+    // the classifications kept by the FlowStepCache. One series, up to the latest sample, is shared by all the samples.
+    const Core::IntakeSeries* intakes = nullptr;
+    bool isCacheEnabled = FlowStepCache::getInstance().isEnabled();
+    if ((m_pointDensity.dependsOnCycleDuration() || isCacheEnabled) && !drugTreatment->getSamples().empty()) {
+        Common::DateTime latestSampleDate = drugTreatment->getSamples().front()->getDate();
+        for (const unique_ptr<Core::Sample>& sample : drugTreatment->getSamples()) {
+            if (sample->getDate() > latestSampleDate) {
+                latestSampleDate = sample->getDate();
+            }
+        }
+
+        intakes = _xpertRequestResult.getSeriesCache().getIntakes(Common::TucuUnit("mg"),
+                                                                  getOldestDosageTimeRangeStart(drugTreatment->getDosageHistory(), latestSampleDate),
+                                                                  latestSampleDate + chrono::hours(1));
+    }
 
     // Getting percentiles for each sample.
-    for(const unique_ptr<Core::Sample>& sample : _xpertRequestResult.getTreatment()->getSamples()) {
+    for(const unique_ptr<Core::Sample>& sample : drugTreatment->getSamples()) {
 
-        // Prepare te computing request for percentiles computation.
-        string responseId = "";
         Common::DateTime start = sample->getDate() - chrono::hours(1);  // Minus/plus 1 hour are just here "effectless", the core
         Common::DateTime end = sample->getDate() + chrono::hours(1);    // computes other start and end dates for a cycleData.
+
+        // The percentiles trait only covers the cycle around the sample, its density may be locally refined.
+        double nbPointsPerHour = m_pointDensity.getNbPointsPerHour(*_xpertRequestResult.getDrugModel(),
+                                                                   getSampleCycleDuration(intakes, sample->getDate()));
+
+        // The a priori percentiles around the sample only depend on the drug model and its content, the covariates
+        // and the intakes up to the sample. If they did not change since a previous run, the classification is reused.
+        FlowStepCacheKey classificationKey("sampleValidator.classification");
+        if (isCacheEnabled) {
+            classificationKey.addDrugModel(_xpertRequestResult.getDrugModel()->getDrugModelId())
+                    .add(nbPointsPerHour)
+                    .add(double(m_keptRanks.size()));
+            for (double rank : m_keptRanks) {
+                classificationKey.add(rank);
+            }
+            classificationKey.addCovariates(drugTreatment->getCovariates())
+                    .addIntakes(intakes, end)
+                    .add(sample->getDate())
+                    .add(sample->getValue())
+                    .add(sample->getUnit().toString());
+
+            string cachedClassification;
+            unsigned cachedGroup = 0;
+            unique_ptr<SamplePercentiles> cachedPercentiles;
+            if (FlowStepCache::getInstance().find(classificationKey, cachedClassification) &&
+                    readClassification(cachedClassification, cachedGroup, cachedPercentiles)) {
+                results.emplace_back(SampleValidationResult(sample.get(), cachedGroup));
+                samplePercentiles.emplace(sample.get(), move(*cachedPercentiles));
+                continue;
+            }
+        }
+
+        // Prepare te computing request for percentiles computation.
+        string responseId = "";
         Core::PercentileRanks ranks(99);
         iota(ranks.begin(), ranks.end(), 1);
-        double nbPointsPerHour = 20;
 
         // In a future version where all analytes are in separate
         // cycleData, use AllAnalytes.
         Core::ComputingOption computingOption{Core::PredictionParameterType::Apriori, Core::CompartmentsOption::AllActiveMoieties};
 
-        // Percentile trait and response.
+        // Percentile trait.
         unique_ptr<Core::ComputingTraitPercentiles> percentileTrait =
                 make_unique<Core::ComputingTraitPercentiles>(responseId, start, end, ranks, nbPointsPerHour, computingOption);
-        unique_ptr<Core::PercentilesData> percentilesResult = nullptr;
 
         // Execute the request.
-        executeRequestAndGetResult<Core::ComputingTraitPercentiles, Core::PercentilesData>(move(percentileTrait), _xpertRequestResult, percentilesResult);
+        RequestResult<Core::PercentilesData> percentilesResult = executeRequest(move(percentileTrait), _xpertRequestResult);
 
         // If computation failed, abort xpertRequest processing.
-        if (percentilesResult == nullptr) {
+        if (!percentilesResult.isOk()) {
             _xpertRequestResult.setErrorMessage("Percentiles computation failed.");
             return;
         }
@@ -75,7 +138,7 @@ void SampleValidator::perform(XpertRequestResult& _xpertRequestResult)
         // The sample position starts at 0.
         unsigned groupOver99Percentiles = 0;
         try {
-            groupOver99Percentiles = findGroupPositionOver99Percentiles(percentilesResult.get(), sample);
+            groupOver99Percentiles = findGroupPositionOver99Percentiles(&percentilesResult.getData(), sample);
         } catch (const invalid_argument& e) {
 
             // We catch unit error or if the sample is not bound by any cycleData.
@@ -84,10 +147,18 @@ void SampleValidator::perform(XpertRequestResult& _xpertRequestResult)
         }
 
         results.emplace_back(SampleValidationResult(sample.get(), groupOver99Percentiles));
+
+        // Keep the selected ranks before the 99 percentiles are released.
+        SamplePercentiles keptPercentiles = keepSelectedRanks(percentilesResult.getData());
+        if (isCacheEnabled) {
+            FlowStepCache::getInstance().insert(classificationKey, writeClassification(groupOver99Percentiles, keptPercentiles));
+        }
+        samplePercentiles.emplace(sample.get(), move(keptPercentiles));
     }
 
     // Save the validation results.
     _xpertRequestResult.setSampleResults(move(results));
+    _xpertRequestResult.setSamplePercentiles(move(samplePercentiles));
 }
 
 unsigned SampleValidator::findGroupPositionOver99Percentiles(const Core::PercentilesData* _percentilesData,
@@ -98,7 +169,7 @@ unsigned SampleValidator::findGroupPositionOver99Percentiles(const Core::Percent
 
     int cycleDataIndex = -1;
 
-    const vector<Core::CycleData> firstPercentileData = _percentilesData->getPercentileData(0);
+    const vector<Core::CycleData>& firstPercentileData = _percentilesData->getPercentileData(0);
     for (size_t cycleIndex = 0; cycleIndex < firstPercentileData.size(); ++cycleIndex){
 
         // If the sample date is between the cycleData start and end date.
@@ -121,10 +192,17 @@ unsigned SampleValidator::findGroupPositionOver99Percentiles(const Core::Percent
     // to parse everything again when switching percentile.
     size_t savedIndexOfPair = 0;
 
+    // Convert the sample value to the cycleData unit. All the percentiles share the same unit,
+    // so the conversion is done once.
+    double convertedSampleConcentration = UnitConversionCache::getInstance().convert(
+                _sample->getValue(),
+                _sample->getUnit(),
+                firstPercentileData[cycleDataIndex].m_unit);
+
     for (size_t percentileIndex = 0; percentileIndex < 99; ++percentileIndex) {
 
         // Get the percentile.
-        const vector<Core::CycleData> percentileData = _percentilesData->getPercentileData(percentileIndex);
+        const vector<Core::CycleData>& percentileData = _percentilesData->getPercentileData(percentileIndex);
 
         // Get its times and concentrations.
         const vector<double>& times = percentileData[cycleDataIndex].m_times[0];
@@ -142,12 +220,6 @@ unsigned SampleValidator::findGroupPositionOver99Percentiles(const Core::Percent
                 continue;
             }
 
-            // Convert the sample value to the cycleData unit.
-            double convertedSampleConcentration = Common::UnitManager::convertToUnit(
-                        _sample->getValue(),
-                        _sample->getUnit(),
-                        percentileData[cycleDataIndex].m_unit);
-
             // If the mesure is lower than the interpolated mesure, it belongs to the current percentile
             // (+1 because we iterate from 0 to 98)
             // The interpolation proceeds  as follows (assuming the concentration interpolation is linear):
@@ -179,5 +251,127 @@ unsigned SampleValidator::findGroupPositionOver99Percentiles(const Core::Percent
     return 100;
 }
 
+Common::Duration SampleValidator::getSampleCycleDuration(const Core::IntakeSeries* _intakes,
+                                                        const Common::DateTime& _sampleDate) const
+{
+    if (_intakes == nullptr) {
+        return Common::Duration();
+    }
+
+    // The intakes are sorted by date, the last one before the sample holds its cycle.
+    Common::Duration cycleDuration;
+    for (const Core::IntakeEvent& intake : *_intakes) {
+        if (intake.getEventTime() > _sampleDate) {
+            break;
+        }
+        cycleDuration = intake.getInterval();
+    }
+
+    return cycleDuration;
+}
+
+SamplePercentiles SampleValidator::keepSelectedRanks(const Core::PercentilesData& _percentilesData) const
+{
+    Core::PercentileRanks ranks;
+    vector<vector<Core::CycleData>> percentileData;
+
+    for (double rank : m_keptRanks) {
+
+        // The percentiles data holds the ranks 1 - 99 at the indexes 0 - 98.
+        if (rank < 1 || rank > 99 || rank != floor(rank)) {
+            continue;
+        }
+
+        ranks.push_back(rank);
+        percentileData.push_back(_percentilesData.getPercentileData(unsigned(rank) - 1));
+    }
+
+    return SamplePercentiles(ranks, move(percentileData));
+}
+
+string SampleValidator::writeClassification(unsigned _group, const SamplePercentiles& _percentiles) const
+{
+    // The doubles are written with enough digits to be read back exactly.
+    ostringstream stream;
+    stream << setprecision(numeric_limits<double>::max_digits10);
+
+    stream << _group << ' ' << _percentiles.getRanks().size() << '\n';
+    for (size_t rankIndex = 0; rankIndex < _percentiles.getRanks().size(); ++rankIndex) {
+
+        const vector<Core::CycleData>& cycles = _percentiles.getPercentileData(rankIndex);
+        stream << _percentiles.getRanks()[rankIndex] << ' ' << cycles.size() << '\n';
+
+        // Only the first analyte is kept, as everywhere else in the flow.
+        for (const Core::CycleData& cycle : cycles) {
+            const vector<double>& times = cycle.m_times[0];
+            const vector<double>& concentrations = cycle.m_concentrations[0];
+
+            stream << dateTimeToXmlString(cycle.m_start) << ' '
+                   << dateTimeToXmlString(cycle.m_end) << ' '
+                   << quoted(cycle.m_unit.toString()) << ' '
+                   << times.size() << '\n';
+
+            for (size_t i = 0; i < times.size(); ++i) {
+                stream << times[i] << ' ' << concentrations[i] << '\n';
+            }
+        }
+    }
+
+    return stream.str();
+}
+
+bool SampleValidator::readClassification(const string& _classification,
+                                         unsigned& _group,
+                                         unique_ptr<SamplePercentiles>& _percentiles) const
+{
+    istringstream stream(_classification);
+
+    size_t nbRanks = 0;
+    if (!(stream >> _group >> nbRanks)) {
+        return false;
+    }
+
+    Core::PercentileRanks ranks;
+    vector<vector<Core::CycleData>> percentileData;
+
+    for (size_t rankIndex = 0; rankIndex < nbRanks; ++rankIndex) {
+
+        double rank = 0;
+        size_t nbCycles = 0;
+        if (!(stream >> rank >> nbCycles)) {
+            return false;
+        }
+
+        vector<Core::CycleData> cycles;
+        for (size_t cycleIndex = 0; cycleIndex < nbCycles; ++cycleIndex) {
+
+            string cycleStart, cycleEnd, unit;
+            size_t nbPoints = 0;
+            if (!(stream >> cycleStart >> cycleEnd >> quoted(unit) >> nbPoints)) {
+                return false;
+            }
+
+            Core::TimeOffsets times(nbPoints);
+            Core::Concentrations concentrations(nbPoints);
+            for (size_t i = 0; i < nbPoints; ++i) {
+                if (!(stream >> times[i] >> concentrations[i])) {
+                    return false;
+                }
+            }
+
+            cycles.emplace_back(Common::DateTime(cycleStart, "%Y-%m-%dT%H:%M:%S"),
+                                Common::DateTime(cycleEnd, "%Y-%m-%dT%H:%M:%S"),
+                                Common::TucuUnit(unit));
+            cycles.back().addData(times, concentrations);
+        }
+
+        ranks.push_back(rank);
+        percentileData.push_back(move(cycles));
+    }
+
+    _percentiles = make_unique<SamplePercentiles>(ranks, move(percentileData));
+    return true;
+}
+
 } // namespace Xpert
 } // namespace Tucuxi
@@ -1,12 +1,17 @@
 #ifndef SAMPLEVALIDATOR_H
 #define SAMPLEVALIDATOR_H
 
+#include <memory>
+#include <string>
+
 #include "tucucommon/datetime.h"
 #include "tucucore/drugtreatment/sample.h"
+#include "tucucore/intakeevent.h"
 #include "tucucore/computingservice/computingresponse.h"
 
 #include "tuberxpert/flow/abstract/abstractxpertflowstep.h"
 #include "tuberxpert/result/xpertrequestresult.h"
+#include "tuberxpert/utils/pointdensity.h"
 
 struct TestSampleValidator;
 
@@ -29,6 +34,13 @@ namespace Xpert {
 ///
 ///        Each sample is evaluated. In the future version, perhaps consider forgetting the too old samples.
 ///
+///        The percentiles of the selected ranks are kept in the XpertRequestResult (SamplePercentiles) so
+///        that the exporters can draw percentile bands without computing the percentiles again.
+///
+///        When the FlowStepCache is enabled, the classification of a sample (group and kept percentiles) is kept
+///        between runs, keyed by the drug model content, the covariates and the intakes up to the sample. A
+///        resubmitted query only computes the percentiles of the samples whose inputs changed.
+///
 ///        It assumes that the LanguageManager is loaded with a complete translations file.
 /// \date 08/06/2022
 /// \author Herzig Melvyn
@@ -36,9 +48,15 @@ class SampleValidator : public AbstractXpertFlowStep
 {
 public:
 
+    /// \brief Constructor.
+    /// \param _pointDensity Point density of the percentiles traits.
+    /// \param _keptRanks Ranks of the percentiles kept in the XpertRequestResult, between 1 and 99.
+    SampleValidator(const PointDensity& _pointDensity = PointDensity(20),
+                    const Core::PercentileRanks& _keptRanks = {5, 10, 25, 50, 75, 90, 95});
+
     /// \brief Evaluate each sample in the treatment from the XpertRequestResult.
     /// \param _xpertRequestResult XpertRequestResult containing samples to evaluate.
-    void perform(XpertRequestResult& _xpertRequestResult);
+    void perform(XpertRequestResult& _xpertRequestResult) const;
 
 protected:
 
@@ -53,6 +71,42 @@ protected:
     unsigned findGroupPositionOver99Percentiles(const Core::PercentilesData* _percentilesData,
                                                 const std::unique_ptr<Core::Sample>& _sample) const;
 
+    /// \brief Get the duration of the cycle surrounding a sample: the interval of the latest intake
+    ///        that starts before or at the sample date.
+    /// \param _intakes Intakes of the treatment up to the sample. May be nullptr.
+    /// \param _sampleDate Date of the sample.
+    /// \return The interval of the intake or an empty duration if there is no such intake.
+    Common::Duration getSampleCycleDuration(const Core::IntakeSeries* _intakes, const Common::DateTime& _sampleDate) const;
+
+    /// \brief Extract the percentiles of the kept ranks from a percentiles data of the 99 ranks.
+    ///        The ranks that are not integers between 1 and 99 are ignored.
+    /// \param _percentilesData Response of the core with 99 percentiles.
+    /// \return The compact percentiles with only the kept ranks.
+    SamplePercentiles keepSelectedRanks(const Core::PercentilesData& _percentilesData) const;
+
+    /// \brief Write the classification of a sample to keep it in the FlowStepCache.
+    /// \param _group Position of the sample over the 99 percentiles.
+    /// \param _percentiles Kept percentiles around the sample.
+    /// \return The written classification.
+    std::string writeClassification(unsigned _group, const SamplePercentiles& _percentiles) const;
+
+    /// \brief Read a classification written by writeClassification.
+    /// \param _classification Written classification.
+    /// \param _group Where to store the position of the sample.
+    /// \param _percentiles Where to store the kept percentiles.
+    /// \return True if the classification could be read, otherwise false.
+    bool readClassification(const std::string& _classification,
+                            unsigned& _group,
+                            std::unique_ptr<SamplePercentiles>& _percentiles) const;
+
+protected:
+
+    /// \brief Point density of the percentiles traits.
+    PointDensity m_pointDensity;
+
+    /// \brief Ranks of the percentiles kept in the XpertRequestResult.
+    Core::PercentileRanks m_keptRanks;
+
     // For testing purposes, the tests works with findGroupPositionOver99Percentiles and not with getSampleValidations. This is easier
     // because it allows us to forge our own percentiles data and to be able to predict the location of some predetermined samples.
     friend TestSampleValidator;
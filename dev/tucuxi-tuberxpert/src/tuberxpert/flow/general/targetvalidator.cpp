@@ -15,7 +15,7 @@ using namespace std;
 namespace Tucuxi {
 namespace Xpert {
 
-void TargetValidator::perform(XpertRequestResult& _xpertRequestResult)
+void TargetValidator::perform(XpertRequestResult& _xpertRequestResult) const
 {
 
     // Check if there is a treatment.
@@ -24,7 +24,7 @@ public:
     ///        If any of these checks fail, the XpertRequestResult gets an error and
     ///        should not be processed further.
     /// \param _xpertRequestResult XpertResult object containing the targets and the associated drug model.
-    void perform(XpertRequestResult& _xpertRequestResult);
+    void perform(XpertRequestResult& _xpertRequestResult) const;
 };
 
 } // namespace Xpert
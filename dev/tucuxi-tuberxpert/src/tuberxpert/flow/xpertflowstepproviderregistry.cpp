@@ -0,0 +1,59 @@
+#include "xpertflowstepproviderregistry.h"
+
+#include "tuberxpert/flow/general/generalxpertflowstepprovider.h"
+
+using namespace std;
+
+namespace Tucuxi {
+namespace Xpert {
+
+unique_ptr<XpertFlowStepProviderRegistry> XpertFlowStepProviderRegistry::s_upInstance{nullptr};
+
+mutex XpertFlowStepProviderRegistry::s_mutex;
+
+XpertFlowStepProviderRegistry::XpertFlowStepProviderRegistry() :
+    m_generalProvider(make_shared<GeneralXpertFlowStepProvider>())
+{
+    // For now, TuberXpert is implemented in a general way.
+    // The drug specific providers are registered here, for example:
+    // m_providers.emplace("imatinib", make_shared<ImatinibXpertFlowStepProvider>());
+    // m_providers.emplace("rifampicin", make_shared<RifampicinXpertFlowStepProvider>());
+}
+
+XpertFlowStepProviderRegistry& XpertFlowStepProviderRegistry::getInstance()
+{
+    lock_guard<mutex> lock(s_mutex);
+    if (s_upInstance == nullptr)
+    {
+        s_upInstance = make_unique<XpertFlowStepProviderRegistry>();
+    }
+    return *s_upInstance;
+}
+
+void XpertFlowStepProviderRegistry::registerProvider(const string& _drugId,
+                                                     shared_ptr<const AbstractXpertFlowStepProvider> _xpertFlowStepProvider)
+{
+    unique_lock<shared_mutex> lock(m_providersMutex);
+    m_providers[_drugId] = move(_xpertFlowStepProvider);
+}
+
+shared_ptr<const AbstractXpertFlowStepProvider> XpertFlowStepProviderRegistry::getProvider(const string& _drugId) const
+{
+    shared_lock<shared_mutex> lock(m_providersMutex);
+
+    // The copy is made under the lock, the provider survives a later registration for the drug.
+    auto providerIt = m_providers.find(_drugId);
+    if (providerIt != m_providers.end() && providerIt->second != nullptr) {
+        return providerIt->second;
+    }
+
+    return m_generalProvider;
+}
+
+shared_ptr<const AbstractXpertFlowStepProvider> XpertFlowStepProviderRegistry::getGeneralProvider() const
+{
+    return m_generalProvider;
+}
+
+} // namespace Xpert
+} // namespace Tucuxi
@@ -0,0 +1,89 @@
+#ifndef XPERTFLOWSTEPPROVIDERREGISTRY_H
+#define XPERTFLOWSTEPPROVIDERREGISTRY_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+
+#include "tuberxpert/flow/abstract/abstractxpertflowstepprovider.h"
+
+namespace Tucuxi {
+namespace Xpert {
+
+/// \brief The xpert flow step provider registry is a singleton that holds one
+///        xpert flow step provider per drug identifier. The providers are created once
+///        and shared by all the requests of the drug, so that the flow steps are not allocated
+///        for each request.
+///
+///        When a drug has no specialized provider, the GeneralXpertFlowStepProvider is returned.
+///
+///        Drug specific providers are registered at startup, for example:
+///        registerProvider("imatinib", make_shared<ImatinibXpertFlowStepProvider>());
+///
+///        The providers are handed out as shared pointers to const: their flow steps keep no
+///        data of a request, so that a provider can execute several requests at the same time,
+///        and a provider replaced by a registration stays alive until its requests are done.
+/// \date 19/10/2026
+/// \author Herzig Melvyn
+class XpertFlowStepProviderRegistry
+{
+public:
+
+    /// \brief Get the unique instance of XpertFlowStepProviderRegistry.
+    /// \return The xpert flow step provider registry unique instance.
+    static XpertFlowStepProviderRegistry& getInstance();
+
+    /// \brief Register the provider of a drug. If the drug already has a provider, it is replaced.
+    /// \param _drugId Drug identifier of the provider.
+    /// \param _xpertFlowStepProvider Provider to use for the drug.
+    void registerProvider(const std::string& _drugId,
+                          std::shared_ptr<const AbstractXpertFlowStepProvider> _xpertFlowStepProvider);
+
+    /// \brief For a given drug identifier, get the xpert flow step provider that best matches.
+    /// \param _drugId Drug identifier to search for the best AbstractXpertFlowStepProvider.
+    /// \return The provider registered for the drug, otherwise the general provider.
+    std::shared_ptr<const AbstractXpertFlowStepProvider> getProvider(const std::string& _drugId) const;
+
+    /// \brief Get the general provider, used for the drugs without specialized provider.
+    /// \return The general provider.
+    std::shared_ptr<const AbstractXpertFlowStepProvider> getGeneralProvider() const;
+
+private:
+
+    /// \brief Constructor. Used internally to create the singleton instance.
+    ///        It creates the general provider.
+    XpertFlowStepProviderRegistry();
+
+    /// \brief Singleton should not be clonable.
+    XpertFlowStepProviderRegistry(XpertFlowStepProviderRegistry& _other) = delete;
+
+    /// \brief Singleton should not be assignable.
+    void operator=(const XpertFlowStepProviderRegistry& _other) = delete;
+
+private:
+
+    /// \brief XpertFlowStepProviderRegistry unique instance.
+    static std::unique_ptr<XpertFlowStepProviderRegistry> s_upInstance;
+
+    /// \brief Mutex to manage multi threading creation.
+    static std::mutex s_mutex;
+
+    /// \brief Protects the map of providers. Lookups share the lock, registrations are exclusive.
+    mutable std::shared_mutex m_providersMutex;
+
+    /// \brief General provider, used when a drug has no specialized provider.
+    std::shared_ptr<const AbstractXpertFlowStepProvider> m_generalProvider;
+
+    /// \brief Map of the drug identifiers to their specialized provider.
+    std::map<std::string, std::shared_ptr<const AbstractXpertFlowStepProvider>> m_providers;
+
+    // Otherwise singleton does not work.
+    friend std::unique_ptr<XpertFlowStepProviderRegistry> std::make_unique<XpertFlowStepProviderRegistry>();
+};
+
+} // namespace Xpert
+} // namespace Tucuxi
+
+#endif // XPERTFLOWSTEPPROVIDERREGISTRY_H
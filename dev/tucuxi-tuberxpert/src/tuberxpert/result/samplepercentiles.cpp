@@ -0,0 +1,34 @@
+#include "samplepercentiles.h"
+
+using namespace std;
+
+namespace Tucuxi {
+namespace Xpert {
+
+SamplePercentiles::SamplePercentiles(const Core::PercentileRanks& _ranks, vector<vector<Core::CycleData>>&& _percentileData) :
+    m_ranks(_ranks), m_percentileData(move(_percentileData))
+{}
+
+const Core::PercentileRanks& SamplePercentiles::getRanks() const
+{
+    return m_ranks;
+}
+
+const vector<Core::CycleData>& SamplePercentiles::getPercentileData(size_t _rankIndex) const
+{
+    return m_percentileData.at(_rankIndex);
+}
+
+const vector<Core::CycleData>* SamplePercentiles::findPercentileData(double _rank) const
+{
+    for (size_t i = 0; i < m_ranks.size() && i < m_percentileData.size(); ++i) {
+        if (m_ranks[i] == _rank) {
+            return &m_percentileData[i];
+        }
+    }
+
+    return nullptr;
+}
+
+} // namespace Xpert
+} // namespace Tucuxi
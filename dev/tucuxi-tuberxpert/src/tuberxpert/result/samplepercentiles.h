@@ -0,0 +1,58 @@
+#ifndef SAMPLEPERCENTILES_H
+#define SAMPLEPERCENTILES_H
+
+#include <vector>
+
+#include "tucucore/definitions.h"
+#include "tucucore/computingservice/computingresponse.h"
+
+namespace Tucuxi {
+namespace Xpert {
+
+/// \brief This class stores, in a compact form, the "a priori" percentiles computed by
+///        the SampleValidator around a patient sample.
+///
+///        The SampleValidator computes the 99 percentiles to position the sample. Only
+///        some selected ranks are kept here (for example 5, 25, 75 and 95) so that the
+///        exporters and the graph renderers can draw percentile bands around the sample
+///        without submitting a second percentiles computation to the core.
+/// \date 19/10/2026
+/// \author Herzig Melvyn
+class SamplePercentiles
+{
+public:
+
+    /// \brief Constructor.
+    /// \param _ranks Kept ranks, in ascending order.
+    /// \param _percentileData Cycle data of each kept rank, in the same order as _ranks.
+    SamplePercentiles(const Core::PercentileRanks& _ranks, std::vector<std::vector<Core::CycleData>>&& _percentileData);
+
+    // Getters
+
+    /// \brief Get the kept ranks.
+    /// \return The kept ranks, in ascending order.
+    const Core::PercentileRanks& getRanks() const;
+
+    /// \brief Get the cycle data of a kept rank.
+    /// \param _rankIndex Index of the rank in the kept ranks.
+    /// \return The cycle data of the percentile.
+    const std::vector<Core::CycleData>& getPercentileData(size_t _rankIndex) const;
+
+    /// \brief Get the cycle data of a given rank, if it was kept.
+    /// \param _rank Rank of the percentile, for example 95.
+    /// \return The cycle data of the percentile or nullptr if the rank was not kept.
+    const std::vector<Core::CycleData>* findPercentileData(double _rank) const;
+
+protected:
+
+    /// \brief Kept ranks, in ascending order.
+    Core::PercentileRanks m_ranks;
+
+    /// \brief Cycle data of each kept rank.
+    std::vector<std::vector<Core::CycleData>> m_percentileData;
+};
+
+} // namespace Xpert
+} // namespace Tucuxi
+
+#endif // SAMPLEPERCENTILES_H
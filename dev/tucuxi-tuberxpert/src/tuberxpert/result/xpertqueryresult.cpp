@@ -9,7 +9,7 @@ using namespace std;
 namespace Tucuxi {
 namespace Xpert {
 
-XpertQueryResult::XpertQueryResult(unique_ptr<XpertQueryData> _xpertQuery, const string& _outputPath) :
+XpertQueryResult::XpertQueryResult(unique_ptr<XpertQueryData> _xpertQuery, const string& _outputPath, bool _isArenaUsed) :
     m_computationTime(_xpertQuery->getpQueryDate()),
     m_adminData(_xpertQuery->moveAdminData()),
     m_outputPath(_outputPath),
@@ -29,7 +29,8 @@ XpertQueryResult::XpertQueryResult(unique_ptr<XpertQueryData> _xpertQuery, const
         m_xpertRequestResults.emplace_back(*this,
                                            _xpertQuery->moveXpertRequest(i),
                                            move(drugTreatment),
-                                           errorMessage);
+                                           errorMessage,
+                                           _isArenaUsed);
     }
 }
 
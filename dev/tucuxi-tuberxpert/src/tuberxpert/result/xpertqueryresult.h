@@ -31,7 +31,8 @@ public:
     /// \param _xpertQuery Object from which the admin data, drug treatment, the xpert requests
     ///                    and the computation time can be extracted.
     /// \param _outputPath Path to export reports.
-    XpertQueryResult(std::unique_ptr<XpertQueryData> _xpertQuery, const std::string& _outputPath);
+    /// \param _isArenaUsed True to allocate the flow steps results of each XpertRequestResult in its arena.
+    XpertQueryResult(std::unique_ptr<XpertQueryData> _xpertQuery, const std::string& _outputPath, bool _isArenaUsed = true);
 
     /// \brief Copy constructor is not supported because of unique pointers.
     XpertQueryResult(const XpertQueryResult& _other) = delete;
@@ -8,19 +8,31 @@ using namespace std;
 namespace Tucuxi {
 namespace Xpert {
 
+/// \brief Size of the first buffer of the arena. A request with a few covariates, doses and samples
+///        fits in it, the arena allocates bigger buffers from the heap when needed.
+static const size_t ARENA_INITIAL_SIZE = 16 * 1024;
+
 XpertRequestResult::XpertRequestResult(
         const XpertQueryResult& _xpertQueryResult,
         unique_ptr<XpertRequestData> _xpertRequest,
         unique_ptr<Core::DrugTreatment> _drugTreatment,
-        const string& _errorMessage):
+        const string& _errorMessage,
+        bool _isArenaUsed):
     m_xpertQueryResult(_xpertQueryResult),
+    m_arena(_isArenaUsed ? make_unique<pmr::monotonic_buffer_resource>(ARENA_INITIAL_SIZE) : nullptr),
     m_xpertRequest(move(_xpertRequest)),
     m_drugTreatment(move(_drugTreatment)),
+    m_seriesCache(m_drugTreatment.get()),
     m_errorMessage(_errorMessage),
     m_drugModel(nullptr),
+    m_covariateValidationResults(getArena()),
+    m_doseValidationResults(getArena()),
+    m_sampleValidationResults(getArena()),
+    m_samplePercentiles(getArena()),
     m_adjustmentTrait(nullptr),
     m_adjustmentData(nullptr),
-    m_lastIntake(nullptr)
+    m_lastIntake(nullptr),
+    m_parameters(getArena())
 {}
 
 const XpertRequestData& XpertRequestResult::getXpertRequest() const
@@ -43,22 +55,27 @@ const Core::DrugModel* XpertRequestResult::getDrugModel() const
     return m_drugModel;
 }
 
-const vector<CovariateValidationResult>& XpertRequestResult::getCovariateValidationResults() const
+const pmr::vector<CovariateValidationResult>& XpertRequestResult::getCovariateValidationResults() const
 {
     return m_covariateValidationResults;
 }
 
-const map<const Core::SingleDose*, DoseValidationResult>& XpertRequestResult::getDoseValidationResults() const
+const pmr::map<const Core::SingleDose*, DoseValidationResult>& XpertRequestResult::getDoseValidationResults() const
 {
     return m_doseValidationResults;
 }
 
-const vector<SampleValidationResult>& XpertRequestResult::getSampleValidationResults() const
+const pmr::vector<SampleValidationResult>& XpertRequestResult::getSampleValidationResults() const
 {
     return m_sampleValidationResults;
 }
 
-const unique_ptr<Core::ComputingTraitAdjustment>& XpertRequestResult::getAdjustmentTrait() const
+const pmr::map<const Core::Sample*, SamplePercentiles>& XpertRequestResult::getSamplePercentiles() const
+{
+    return m_samplePercentiles;
+}
+
+const shared_ptr<const Core::ComputingTraitAdjustment>& XpertRequestResult::getAdjustmentTrait() const
 {
     return m_adjustmentTrait;
 }
@@ -78,7 +95,7 @@ const XpertQueryResult& XpertRequestResult::getXpertQueryResult() const
     return m_xpertQueryResult;
 }
 
-const vector<vector<Core::ParameterValue>>& XpertRequestResult::getParameters() const
+const pmr::vector<pmr::vector<Core::ParameterValue>>& XpertRequestResult::getParameters() const
 {
     return m_parameters;
 }
@@ -88,6 +105,20 @@ const Core::CycleStats &XpertRequestResult::getCycleStats() const
     return m_cycleStats;
 }
 
+pmr::memory_resource* XpertRequestResult::getArena() const
+{
+    if (m_arena == nullptr) {
+        return pmr::new_delete_resource();
+    }
+
+    return m_arena.get();
+}
+
+const TreatmentSeriesCache& XpertRequestResult::getSeriesCache() const
+{
+    return m_seriesCache;
+}
+
 void XpertRequestResult::setErrorMessage(const string& _message)
 {
     m_errorMessage = _message;
@@ -98,9 +129,9 @@ void XpertRequestResult::setDrugModel(const Core::DrugModel* _drugModel)
     m_drugModel = _drugModel;
 }
 
-void XpertRequestResult::setCovariateResults(vector<CovariateValidationResult>&& _covariateValidationResults)
+void XpertRequestResult::setCovariateResults(pmr::vector<CovariateValidationResult>&& _covariateValidationResults)
 {
-    m_covariateValidationResults = _covariateValidationResults;
+    m_covariateValidationResults = move(_covariateValidationResults);
 
     // Sort the covariate validation results by name and date.
     OutputLang lang = m_xpertRequest->getOutputLang();
@@ -126,14 +157,14 @@ void XpertRequestResult::setCovariateResults(vector<CovariateValidationResult>&&
     });
 }
 
-void XpertRequestResult::setDoseResults(map<const Core::SingleDose*, DoseValidationResult>&& _doseValidationResults)
+void XpertRequestResult::setDoseResults(pmr::map<const Core::SingleDose*, DoseValidationResult>&& _doseValidationResults)
 {
-    m_doseValidationResults = _doseValidationResults;
+    m_doseValidationResults = move(_doseValidationResults);
 }
 
-void XpertRequestResult::setSampleResults(vector<SampleValidationResult>&& _sampleValidationResults)
+void XpertRequestResult::setSampleResults(pmr::vector<SampleValidationResult>&& _sampleValidationResults)
 {
-    m_sampleValidationResults = _sampleValidationResults;
+    m_sampleValidationResults = move(_sampleValidationResults);
 
     // Sort the sample results by date and by analyteId.
     sort(m_sampleValidationResults.begin(), m_sampleValidationResults.end(),
@@ -150,9 +181,14 @@ void XpertRequestResult::setSampleResults(vector<SampleValidationResult>&& _samp
     });
 }
 
-void XpertRequestResult::setAdjustmentTrait(const Core::ComputingTraitAdjustment& _adjustmentTrait)
+void XpertRequestResult::setSamplePercentiles(pmr::map<const Core::Sample*, SamplePercentiles>&& _samplePercentiles)
+{
+    m_samplePercentiles = move(_samplePercentiles);
+}
+
+void XpertRequestResult::setAdjustmentTrait(unique_ptr<Core::ComputingTraitAdjustment> _adjustmentTrait)
 {
-    m_adjustmentTrait = make_unique<Core::ComputingTraitAdjustment>(_adjustmentTrait);
+    m_adjustmentTrait = move(_adjustmentTrait);
 }
 
 void XpertRequestResult::setAdjustmentData(unique_ptr<Core::AdjustmentData> _adjustmentData)
@@ -167,8 +203,9 @@ void XpertRequestResult::setLastIntake(unique_ptr<Core::IntakeEvent> _lastIntake
 
 void XpertRequestResult::addParameters(const vector<Core::ParameterValue>& _parameters)
 {
+    // The group is built in the arena by the allocator of m_parameters.
     auto it = m_parameters.begin();
-    m_parameters.emplace(it, _parameters);
+    m_parameters.emplace(it, _parameters.begin(), _parameters.end());
 }
 
 void XpertRequestResult::setCycleStats(const Core::CycleStats _cycleStats)
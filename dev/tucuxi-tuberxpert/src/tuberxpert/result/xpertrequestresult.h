@@ -1,6 +1,8 @@
 #ifndef XPERTREQUESTRESULT_H
 #define XPERTREQUESTRESULT_H
 
+#include <map>
+#include <memory_resource>
 #include <string>
 #include <vector>
 
@@ -14,6 +16,8 @@
 #include "tuberxpert/result/covariatevalidationresult.h"
 #include "tuberxpert/result/dosevalidationresult.h"
 #include "tuberxpert/result/samplevalidationresult.h"
+#include "tuberxpert/result/samplepercentiles.h"
+#include "tuberxpert/utils/treatmentseriescache.h"
 
 struct TestCovariateValidatorAndModelSelector;
 
@@ -37,11 +41,16 @@ class XpertQueryResult;
 ///            - The covariate validation results (CovariateValidationResult).
 ///            - The dose validation results (DoseValidationResult).
 ///            - The sample validation results (SampleValidationResult).
+///            - The percentiles computed around each sample (SamplePercentiles).
 ///            - The adjustment trait used to find a better treatment.
 ///            - The adjustment data returned by Tucuxi computation core.
 ///            - The last intake.
 ///            - The parameters (Typical patient, A priori and eventually A posteriori).
 ///            - The statistics at steady state.
+///
+///        The containers of the flow steps results are allocated in a monotonic arena owned
+///        by the XpertRequestResult. The flow steps build their results in this arena (see getArena),
+///        so that the many small allocations of a request are released at once with the request.
 /// \date 20/05/2022
 /// \author Herzig Melvyn
 class XpertRequestResult
@@ -56,11 +65,14 @@ public:
     /// \param _drugTreatment Associated treatment if extraction was successful.
     /// \param _errorMessage If the extraction of the treatment was not successful, the corresponding
     ///                      error message or empty string.
+    /// \param _isArenaUsed True to allocate the flow steps results in the arena. False to allocate
+    ///                     them one by one on the heap, for example to measure what the arena saves.
     XpertRequestResult(
             const XpertQueryResult& _xpertQueryResult,
             std::unique_ptr<XpertRequestData> _xpertRequest,
             std::unique_ptr<Core::DrugTreatment> _drugTreatment,
-            const std::string& _errorMessage);
+            const std::string& _errorMessage,
+            bool _isArenaUsed = true);
 
     // Getters
 
@@ -84,22 +96,29 @@ public:
     ///        flow step.
     /// \return The vector containing each CovariateValidationResult for each covariate.
     ///         May be empty if the flow step has failed/has not been performed.
-    const std::vector<CovariateValidationResult>& getCovariateValidationResults() const;
+    const std::pmr::vector<CovariateValidationResult>& getCovariateValidationResults() const;
 
     /// \brief Get the dose validation results of the DoseValidator flow step.
     /// \return The vector containing each DoseValidationResult for each dose found in the treatment.
     ///         This may be empty if there is no dosage or if the flow step has failed/has not been performed.
-    const std::map<const Core::SingleDose*, DoseValidationResult>& getDoseValidationResults() const;
+    const std::pmr::map<const Core::SingleDose*, DoseValidationResult>& getDoseValidationResults() const;
 
     /// \brief Get the sample validation results of the SampleValidator flow step.
     /// \return The vector containing each SampleValidationResult for each sample found in the treatment.
     ///         This may be empty if there is no sample or if the flow step has failed/has not been performed.
-    const std::vector<SampleValidationResult>& getSampleValidationResults() const;
+    const std::pmr::vector<SampleValidationResult>& getSampleValidationResults() const;
+
+    /// \brief Get the percentiles computed around each sample during the SampleValidator flow step.
+    ///        Only the ranks selected by the SampleValidator are kept.
+    /// \return The map containing the SamplePercentiles of each sample found in the treatment.
+    ///         This may be empty if there is no sample or if the flow step has failed/has not been performed.
+    const std::pmr::map<const Core::Sample*, SamplePercentiles>& getSamplePercentiles() const;
 
     /// \brief Get the adjustment trait used to make the adjustment request.
     ///        The trait is made during the AdjustmentTraitCreator flow step.
+    ///        It is immutable and shared, the traits derived from it are built from an AdjustmentTraitView.
     /// \return The adjustment trait. This may be nullptr if the flow step has failed/has not been performed.
-    const std::unique_ptr<Core::ComputingTraitAdjustment>& getAdjustmentTrait() const;
+    const std::shared_ptr<const Core::ComputingTraitAdjustment>& getAdjustmentTrait() const;
 
     /// \brief Get the adjustment data retrieved by the computating the adjustment trait.
     ///        The data is retrieved by the RequestExecutor flow step.
@@ -123,13 +142,25 @@ public:
     ///         - In index 1, the A priori values.
     ///         - In index 2, the A posteriori values. (Does not exist if the type of computation
     ///           of the adjustment trait is A priori.)
-    const std::vector<std::vector<Core::ParameterValue>>& getParameters() const;
+    const std::pmr::vector<std::pmr::vector<Core::ParameterValue>>& getParameters() const;
 
     /// \brief Get the extrapolated statistics at steady state.
     ///        The data is retrieved by the RequestExecutor flow step.
     /// \return The extrapolated steady-state statistics.
     const Core::CycleStats& getCycleStats() const;
 
+    /// \brief Get the arena in which the flow steps results are allocated.
+    ///        The flow steps should create their result containers with this memory resource
+    ///        so that the setters move them without copying their elements.
+    ///        The memory is released when the XpertRequestResult is destroyed.
+    /// \return The memory resource of the arena, or the heap resource if the arena is not used.
+    std::pmr::memory_resource* getArena() const;
+
+    /// \brief Get the intake series extracted from the treatment. They are extracted when a flow step
+    ///        first asks for them and shared by all the flow steps of the request.
+    /// \return The series cache of the treatment.
+    const TreatmentSeriesCache& getSeriesCache() const;
+
     // Setters
 
     /// \brief Define a new error message. This is used by the flow step to
@@ -146,22 +177,27 @@ public:
     ///        several times. Used during the CovariateValidatiorAndModelSelector flow step.
     ///        The names are sorted according to the C++ comparison. This means that 'Z' < 'Â'.
     /// \param _covariateValidationResults Covariate validation results to store.
-    void setCovariateResults(std::vector<CovariateValidationResult>&& _covariateValidationResults);
+    void setCovariateResults(std::pmr::vector<CovariateValidationResult>&& _covariateValidationResults);
 
     /// \brief Set a new map of dose validation results.
     ///        Used during the DoseValidatior flow step.
     /// \param _doseValidationResults Dose validation results to store.
-    void setDoseResults(std::map<const Core::SingleDose*, DoseValidationResult>&& _doseValidationResults);
+    void setDoseResults(std::pmr::map<const Core::SingleDose*, DoseValidationResult>&& _doseValidationResults);
 
     /// \brief Set a new vector of sample validation results.
     ///        Used during the SampleValidatior flow step.
     /// \param _sampleValidationResults Dose validation results to store.
-    void setSampleResults(std::vector<SampleValidationResult>&& _sampleValidationResults);
+    void setSampleResults(std::pmr::vector<SampleValidationResult>&& _sampleValidationResults);
+
+    /// \brief Set a new map of sample percentiles.
+    ///        Used during the SampleValidatior flow step.
+    /// \param _samplePercentiles Percentiles of each sample to store.
+    void setSamplePercentiles(std::pmr::map<const Core::Sample*, SamplePercentiles>&& _samplePercentiles);
 
     /// \brief Set the adjustment trait to use when creating the computing request for the core.
     ///        Used during the AdjustmentTraitCreator flow step.
-    /// \param _adjustmentTrait Adjustment trait to store.
-    void setAdjustmentTrait(const Core::ComputingTraitAdjustment& _adjustmentTrait);
+    /// \param _adjustmentTrait Adjustment trait to store. It is moved, not copied.
+    void setAdjustmentTrait(std::unique_ptr<Core::ComputingTraitAdjustment> _adjustmentTrait);
 
     /// \brief Set the adjustment data that is retrieved after the adjustment trait is executed.
     ///        Used during the RequestExecutor flow step.
@@ -202,12 +238,20 @@ protected:
     ///        XpertRequestResult.
     const XpertQueryResult& m_xpertQueryResult;
 
+    /// \brief Monotonic arena of the flow steps results. It is declared before the containers
+    ///        that use it so that it is destroyed after them. It is held by pointer so that its
+    ///        address does not change when the XpertRequestResult is moved. Nullptr if the arena is not used.
+    std::unique_ptr<std::pmr::monotonic_buffer_resource> m_arena;
+
     /// \brief Related requestXpert.
     std::unique_ptr<XpertRequestData> m_xpertRequest;
 
     /// \brief The drug treatment for the xpertRequest drug.
     std::unique_ptr<Core::DrugTreatment> m_drugTreatment;
 
+    /// \brief Intake series extracted from the drug treatment. Declared after the treatment it points to.
+    TreatmentSeriesCache m_seriesCache;
+
     /// \brief Error message possibly set during a flow step.
     std::string m_errorMessage;
 
@@ -218,20 +262,25 @@ protected:
     ///        flow step.
     ///        One entry per patient covariate present and by definition missing
     ///        with respect to the selected drug model.
-    std::vector<CovariateValidationResult> m_covariateValidationResults;
+    std::pmr::vector<CovariateValidationResult> m_covariateValidationResults;
 
     /// \brief Validation result for each dose performed during DoseValidator flow step.
     ///        One entry per single dose found. The keys of the map are the same pointers
     ///        as the source in each DoseValidationResult.
-    std::map<const Core::SingleDose*, DoseValidationResult> m_doseValidationResults;
+    std::pmr::map<const Core::SingleDose*, DoseValidationResult> m_doseValidationResults;
 
     /// \brief Validation result for each sample made during SampleValidator flow step.
     ///        One entry per sample found.
-    std::vector<SampleValidationResult> m_sampleValidationResults;
+    std::pmr::vector<SampleValidationResult> m_sampleValidationResults;
+
+    /// \brief Percentiles computed around each sample during SampleValidator flow step.
+    ///        One entry per sample found. Only the ranks selected by the SampleValidator are kept,
+    ///        so that the exporters can reuse them without a second percentiles computation.
+    std::pmr::map<const Core::Sample*, SamplePercentiles> m_samplePercentiles;
 
     /// \brief Adjustment trait used to make the adjustment request
     ///        The trait is made during the AdjustmentTraitCreator flow step.
-    std::unique_ptr<Core::ComputingTraitAdjustment> m_adjustmentTrait;
+    std::shared_ptr<const Core::ComputingTraitAdjustment> m_adjustmentTrait;
 
     /// \brief Adjustment data retrieved by the computating the adjustment trait.
     ///        The data is retrieved by the RequestExecutor flow step.
@@ -247,7 +296,7 @@ protected:
     ///        - In index 1, the a priori values.
     ///        - In index 2, the a posteriori values. (Does not exist if the type of computation
     ///        of the base adjustment trait is a priori.)
-    std::vector<std::vector<Core::ParameterValue>> m_parameters;
+    std::pmr::vector<std::pmr::vector<Core::ParameterValue>> m_parameters;
 
     /// \brief Extrapolated statistics at steady state.
     ///        The data is retrieved by the RequestExecutor flow step.
@@ -28,6 +28,7 @@ HEADERS += \
     $$PWD/exporter/abstracthtmlexport.h \
     $$PWD/exporter/abstractxpertrequestresultexport.h \
     $$PWD/exporter/static/filestring.h \
+    $$PWD/exporter/svgchart.h \
     $$PWD/exporter/xpertrequestresulthtmlexport.h \
     $$PWD/exporter/xpertrequestresultpdfexport.h \
     $$PWD/exporter/xpertrequestresultxmlexport.h \
@@ -41,6 +42,7 @@ HEADERS += \
     $$PWD/flow/general/requestexecutor.h \
     $$PWD/flow/general/samplevalidator.h \
     $$PWD/flow/general/targetvalidator.h \
+    $$PWD/flow/xpertflowstepproviderregistry.h \
     $$PWD/query/admindata.h \
     $$PWD/query/xpertquerydata.h \
     $$PWD/query/xpertqueryimport.h \
@@ -51,14 +53,22 @@ HEADERS += \
     $$PWD/result/abstractvalidationresult.h \
     $$PWD/result/covariatevalidationresult.h \
     $$PWD/result/dosevalidationresult.h \
+    $$PWD/result/samplepercentiles.h \
     $$PWD/result/samplevalidationresult.h \
     $$PWD/result/xpertqueryresult.h \
     $$PWD/result/xpertrequestresult.h \
+    $$PWD/utils/adjustmenttraitview.h \
+    $$PWD/utils/flowstepcache.h \
+    $$PWD/utils/pointdensity.h \
+    $$PWD/utils/requestresult.h \
+    $$PWD/utils/treatmentseriescache.h \
+    $$PWD/utils/unitconversioncache.h \
     $$PWD/utils/xpertutils.h
 
 SOURCES += \
     $$PWD/computer.cpp \
     $$PWD/exporter/static/filestring.cpp \
+    $$PWD/exporter/svgchart.cpp \
     $$PWD/exporter/xpertrequestresulthtmlexport.cpp \
     $$PWD/exporter/xpertrequestresultpdfexport.cpp \
     $$PWD/exporter/xpertrequestresultxmlexport.cpp \
@@ -70,6 +80,7 @@ SOURCES += \
     $$PWD/flow/general/requestexecutor.cpp \
     $$PWD/flow/general/samplevalidator.cpp \
     $$PWD/flow/general/targetvalidator.cpp \
+    $$PWD/flow/xpertflowstepproviderregistry.cpp \
     $$PWD/query/admindata.cpp \
     $$PWD/query/xpertquerydata.cpp \
     $$PWD/query/xpertqueryimport.cpp \
@@ -79,7 +90,13 @@ SOURCES += \
     $$PWD/query/xpertrequestdata.cpp \
     $$PWD/result/covariatevalidationresult.cpp \
     $$PWD/result/dosevalidationresult.cpp \
+    $$PWD/result/samplepercentiles.cpp \
     $$PWD/result/samplevalidationresult.cpp \
     $$PWD/result/xpertqueryresult.cpp \
     $$PWD/result/xpertrequestresult.cpp \
+    $$PWD/utils/adjustmenttraitview.cpp \
+    $$PWD/utils/flowstepcache.cpp \
+    $$PWD/utils/pointdensity.cpp \
+    $$PWD/utils/treatmentseriescache.cpp \
+    $$PWD/utils/unitconversioncache.cpp \
     $$PWD/utils/xpertutils.cpp
@@ -0,0 +1,85 @@
+#include "adjustmenttraitview.h"
+
+#include <utility>
+
+using namespace std;
+
+namespace Tucuxi {
+namespace Xpert {
+
+AdjustmentTraitView::AdjustmentTraitView(shared_ptr<const Core::ComputingTraitAdjustment> _baseTrait) :
+    m_baseTrait(move(_baseTrait)),
+    m_end(nullopt),
+    m_nbPointsPerHour(nullopt),
+    m_parametersType(nullopt),
+    m_candidatesOption(nullopt)
+{}
+
+AdjustmentTraitView AdjustmentTraitView::withEnd(const Common::DateTime& _end) const
+{
+    AdjustmentTraitView view = *this;
+    view.m_end = _end;
+    return view;
+}
+
+AdjustmentTraitView AdjustmentTraitView::withNbPointsPerHour(double _nbPointsPerHour) const
+{
+    AdjustmentTraitView view = *this;
+    view.m_nbPointsPerHour = _nbPointsPerHour;
+    return view;
+}
+
+AdjustmentTraitView AdjustmentTraitView::withParametersType(Core::PredictionParameterType _parametersType) const
+{
+    AdjustmentTraitView view = *this;
+    view.m_parametersType = _parametersType;
+    return view;
+}
+
+AdjustmentTraitView AdjustmentTraitView::withCandidatesOption(Core::BestCandidatesOption _candidatesOption) const
+{
+    AdjustmentTraitView view = *this;
+    view.m_candidatesOption = _candidatesOption;
+    return view;
+}
+
+const Core::ComputingTraitAdjustment& AdjustmentTraitView::getBaseTrait() const
+{
+    return *m_baseTrait;
+}
+
+unique_ptr<Core::ComputingTraitAdjustment> AdjustmentTraitView::materialize() const
+{
+    // Without override, the trait is the base one.
+    if (!m_end && !m_nbPointsPerHour && !m_parametersType && !m_candidatesOption) {
+        return make_unique<Core::ComputingTraitAdjustment>(*m_baseTrait);
+    }
+
+    const Core::ComputingOption& baseOptions = m_baseTrait->getComputingOption();
+
+    // Only the prediction parameters type of the computing option can be overridden.
+    Core::ComputingOption options{
+        m_parametersType.value_or(baseOptions.getParametersType()),
+        baseOptions.getCompartmentsOption(),
+        baseOptions.retrieveStatistics(),
+        baseOptions.retrieveParameters(),
+        baseOptions.retrieveCovariates()
+    };
+
+    return make_unique<Core::ComputingTraitAdjustment>(
+                "",
+                m_baseTrait->getStart(),
+                m_end.value_or(m_baseTrait->getEnd()),
+                m_nbPointsPerHour.value_or(m_baseTrait->getNbPointsPerHour()),
+                options,
+                m_baseTrait->getAdjustmentTime(),
+                m_candidatesOption.value_or(m_baseTrait->getBestCandidatesOption()),
+                m_baseTrait->getLoadingOption(),
+                m_baseTrait->getRestPeriodOption(),
+                m_baseTrait->getSteadyStateTargetOption(),
+                m_baseTrait->getTargetExtractionOption(),
+                m_baseTrait->getFormulationAndRouteSelectionOption());
+}
+
+} // namespace Xpert
+} // namespace Tucuxi
@@ -0,0 +1,79 @@
+#ifndef ADJUSTMENTTRAITVIEW_H
+#define ADJUSTMENTTRAITVIEW_H
+
+#include <memory>
+#include <optional>
+
+#include "tucucommon/datetime.h"
+#include "tucucore/computingservice/computingtrait.h"
+
+namespace Tucuxi {
+namespace Xpert {
+
+/// \brief This class is a lightweight view of an adjustment trait with overridden fields.
+///
+///        The adjustment trait of an XpertRequestResult is shared immutably. The flow steps that need
+///        a variant of it (other end time, number of points per hour, prediction parameters type or best
+///        candidates option) record the overrides in a view instead of copying the whole trait.
+///        Tucuxi core takes the ownership of the trait of each computing request, then the view only
+///        materializes a trait when a request is submitted.
+/// \date 19/10/2026
+/// \author Herzig Melvyn
+class AdjustmentTraitView
+{
+public:
+
+    /// \brief Constructor.
+    /// \param _baseTrait Shared adjustment trait whose fields are used when they are not overridden.
+    explicit AdjustmentTraitView(std::shared_ptr<const Core::ComputingTraitAdjustment> _baseTrait);
+
+    /// \brief Get a view of the same trait with a different end time.
+    /// \param _end End time to use.
+    /// \return The new view.
+    AdjustmentTraitView withEnd(const Common::DateTime& _end) const;
+
+    /// \brief Get a view of the same trait with a different number of points per hour.
+    /// \param _nbPointsPerHour Number of points per hour to use.
+    /// \return The new view.
+    AdjustmentTraitView withNbPointsPerHour(double _nbPointsPerHour) const;
+
+    /// \brief Get a view of the same trait with a different prediction parameters type.
+    /// \param _parametersType Prediction parameters type to use.
+    /// \return The new view.
+    AdjustmentTraitView withParametersType(Core::PredictionParameterType _parametersType) const;
+
+    /// \brief Get a view of the same trait with a different best candidates option.
+    /// \param _candidatesOption Best candidates option to use.
+    /// \return The new view.
+    AdjustmentTraitView withCandidatesOption(Core::BestCandidatesOption _candidatesOption) const;
+
+    /// \brief Get the shared adjustment trait of the view.
+    /// \return The base adjustment trait.
+    const Core::ComputingTraitAdjustment& getBaseTrait() const;
+
+    /// \brief Build the adjustment trait described by the view, to give it to Tucuxi core.
+    /// \return A new adjustment trait with the overridden fields.
+    std::unique_ptr<Core::ComputingTraitAdjustment> materialize() const;
+
+protected:
+
+    /// \brief Shared adjustment trait.
+    std::shared_ptr<const Core::ComputingTraitAdjustment> m_baseTrait;
+
+    /// \brief Overridden end time.
+    std::optional<Common::DateTime> m_end;
+
+    /// \brief Overridden number of points per hour.
+    std::optional<double> m_nbPointsPerHour;
+
+    /// \brief Overridden prediction parameters type.
+    std::optional<Core::PredictionParameterType> m_parametersType;
+
+    /// \brief Overridden best candidates option.
+    std::optional<Core::BestCandidatesOption> m_candidatesOption;
+};
+
+} // namespace Xpert
+} // namespace Tucuxi
+
+#endif // ADJUSTMENTTRAITVIEW_H
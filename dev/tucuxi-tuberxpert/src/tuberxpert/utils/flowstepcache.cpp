@@ -0,0 +1,346 @@
+#include "flowstepcache.h"
+
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <random>
+#include <sstream>
+
+#include "tucucommon/unit.h"
+
+using namespace std;
+
+namespace Tucuxi {
+namespace Xpert {
+
+/// \brief Separator written after each input of a key.
+static const char s_separator = '\x1f';
+
+/// \brief Extension of the files that store the outputs.
+static const string s_entryExtension = ".entry";
+
+/// \brief Compute the 64 bits FNV-1a digest of a content.
+/// \param _content Content to digest.
+/// \return The digest written in hexadecimal.
+static string computeDigest(const string& _content)
+{
+    uint64_t digest = 14695981039346656037ULL;
+    for (unsigned char c : _content) {
+        digest ^= c;
+        digest *= 1099511628211ULL;
+    }
+
+    ostringstream stream;
+    stream << hex << setw(16) << setfill('0') << digest;
+    return stream.str();
+}
+
+FlowStepCacheKey::FlowStepCacheKey(const string& _outputName) :
+    m_content(),
+    m_isValid(true)
+{
+    add(_outputName);
+}
+
+FlowStepCacheKey& FlowStepCacheKey::add(const string& _value)
+{
+    // The length prefix keeps the key canonical whatever characters the value contains.
+    m_content += to_string(_value.size());
+    m_content += ':';
+    m_content += _value;
+    m_content += s_separator;
+    return *this;
+}
+
+FlowStepCacheKey& FlowStepCacheKey::add(double _value)
+{
+    // The hexadecimal notation writes the exact value of the double.
+    ostringstream stream;
+    stream << hexfloat << _value;
+    m_content += stream.str();
+    m_content += s_separator;
+    return *this;
+}
+
+FlowStepCacheKey& FlowStepCacheKey::add(const Common::DateTime& _value)
+{
+    if (_value.isUndefined()) {
+        return add(string("undefined"));
+    }
+    return add(_value.toSeconds());
+}
+
+FlowStepCacheKey& FlowStepCacheKey::addDrugModel(const string& _drugModelId)
+{
+    string digest = FlowStepCache::getInstance().getDrugModelDigest(_drugModelId);
+    if (digest.empty()) {
+        m_isValid = false;
+        return *this;
+    }
+
+    return add(_drugModelId).add(digest);
+}
+
+FlowStepCacheKey& FlowStepCacheKey::addCovariates(const Core::PatientVariates& _patientCovariates)
+{
+    add(double(_patientCovariates.size()));
+
+    for (const unique_ptr<Core::PatientCovariate>& patientCovariate : _patientCovariates) {
+        add(patientCovariate->getId());
+        add(patientCovariate->getValue());
+        add(patientCovariate->getUnit().toString());
+        add(double(static_cast<int>(patientCovariate->getDataType())));
+        add(patientCovariate->getEventTime());
+    }
+
+    return *this;
+}
+
+FlowStepCacheKey& FlowStepCacheKey::addFormulationsAndRoutes(const Core::DosageHistory& _dosageHistory)
+{
+    vector<Core::FormulationAndRoute> formulationsAndRoutes = _dosageHistory.getFormulationAndRouteList();
+    add(double(formulationsAndRoutes.size()));
+
+    for (const Core::FormulationAndRoute& formulationAndRoute : formulationsAndRoutes) {
+        add(double(static_cast<int>(formulationAndRoute.getFormulation())));
+        add(double(static_cast<int>(formulationAndRoute.getAdministrationRoute())));
+        add(double(static_cast<int>(formulationAndRoute.getAbsorptionModel())));
+        add(formulationAndRoute.getAdministrationName());
+    }
+
+    return *this;
+}
+
+FlowStepCacheKey& FlowStepCacheKey::addIntakes(const Core::IntakeSeries* _intakes, const Common::DateTime& _until)
+{
+    if (_intakes == nullptr) {
+        m_isValid = false;
+        return *this;
+    }
+
+    // The intakes are sorted by date, the ones after the date are not read.
+    size_t nbIntakes = 0;
+    while (nbIntakes < _intakes->size() && (*_intakes)[nbIntakes].getEventTime() <= _until) {
+        ++nbIntakes;
+    }
+
+    add(double(nbIntakes));
+
+    for (size_t i = 0; i < nbIntakes; ++i) {
+        const Core::IntakeEvent& intake = (*_intakes)[i];
+        add(intake.getEventTime());
+        add(intake.getDose());
+        add(intake.getInterval().toHours());
+        add(intake.getInfusionTime().toHours());
+        add(double(static_cast<int>(intake.getRoute())));
+    }
+
+    return *this;
+}
+
+const string& FlowStepCacheKey::getContent() const
+{
+    return m_content;
+}
+
+bool FlowStepCacheKey::isValid() const
+{
+    return m_isValid;
+}
+
+FlowStepCache::FlowStepCache() :
+    m_nbHits(0),
+    m_nbMisses(0)
+{}
+
+FlowStepCache& FlowStepCache::getInstance()
+{
+    static FlowStepCache instance;
+    return instance;
+}
+
+bool FlowStepCache::setDirectory(const string& _directory)
+{
+    unique_lock<shared_mutex> lock(m_cacheMutex);
+    m_directory.clear();
+
+    if (_directory.empty()) {
+        return true;
+    }
+
+    error_code error;
+    filesystem::create_directories(_directory, error);
+    if (error || !filesystem::is_directory(_directory, error)) {
+        return false;
+    }
+
+    m_directory = _directory;
+    return true;
+}
+
+bool FlowStepCache::isEnabled() const
+{
+    shared_lock<shared_mutex> lock(m_cacheMutex);
+    return !m_directory.empty();
+}
+
+bool FlowStepCache::registerDrugModel(const string& _drugModelContent)
+{
+    static const string openingTag = "<drugModelId>";
+    static const string closingTag = "</drugModelId>";
+
+    size_t idStart = _drugModelContent.find(openingTag);
+    if (idStart == string::npos) {
+        return false;
+    }
+    idStart += openingTag.size();
+
+    size_t idEnd = _drugModelContent.find(closingTag, idStart);
+    if (idEnd == string::npos) {
+        return false;
+    }
+
+    // The identifier may be surrounded by blanks in the drug file.
+    string drugModelId = _drugModelContent.substr(idStart, idEnd - idStart);
+    drugModelId.erase(0, drugModelId.find_first_not_of(" \t\r\n"));
+    drugModelId.erase(drugModelId.find_last_not_of(" \t\r\n") + 1);
+    if (drugModelId.empty()) {
+        return false;
+    }
+
+    string digest = computeDigest(_drugModelContent);
+
+    unique_lock<shared_mutex> lock(m_cacheMutex);
+    m_drugModelDigests[drugModelId] = digest;
+    return true;
+}
+
+void FlowStepCache::registerDrugModelFolder(const string& _folderPath)
+{
+    error_code error;
+    for (const filesystem::directory_entry& entry : filesystem::directory_iterator(_folderPath, error)) {
+        if (!entry.is_regular_file(error) || entry.path().extension() != ".tdd") {
+            continue;
+        }
+
+        ifstream file(entry.path(), ios::binary);
+        if (file.is_open()) {
+            registerDrugModel(string((istreambuf_iterator<char>(file)), istreambuf_iterator<char>()));
+        }
+    }
+}
+
+string FlowStepCache::getDrugModelDigest(const string& _drugModelId) const
+{
+    shared_lock<shared_mutex> lock(m_cacheMutex);
+
+    auto digestIt = m_drugModelDigests.find(_drugModelId);
+    if (digestIt == m_drugModelDigests.end()) {
+        return "";
+    }
+
+    return digestIt->second;
+}
+
+bool FlowStepCache::find(const FlowStepCacheKey& _key, string& _output)
+{
+    if (!_key.isValid()) {
+        return false;
+    }
+
+    string entryPath;
+    {
+        shared_lock<shared_mutex> lock(m_cacheMutex);
+        if (m_directory.empty()) {
+            return false;
+        }
+        entryPath = getEntryPath(_key.getContent());
+    }
+
+    // The file starts with the size of the key content and the key content itself.
+    ifstream file(entryPath, ios::binary);
+    size_t contentSize = 0;
+    if (file.is_open() && file >> contentSize && file.get() == '\n') {
+
+        string content(contentSize, '\0');
+        if (file.read(content.data(), contentSize) && content == _key.getContent()) {
+            _output.assign(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+            ++m_nbHits;
+            return true;
+        }
+    }
+
+    ++m_nbMisses;
+    return false;
+}
+
+void FlowStepCache::insert(const FlowStepCacheKey& _key, const string& _output)
+{
+    if (!_key.isValid()) {
+        return;
+    }
+
+    string entryPath;
+    {
+        shared_lock<shared_mutex> lock(m_cacheMutex);
+        if (m_directory.empty()) {
+            return;
+        }
+        entryPath = getEntryPath(_key.getContent());
+    }
+
+    // Each writer has its own temporary file, the rename replaces the entry at once.
+    string temporaryPath = entryPath + "." + to_string(random_device{}()) + ".tmp";
+    {
+        ofstream file(temporaryPath, ios::binary | ios::trunc);
+        file << _key.getContent().size() << '\n' << _key.getContent() << _output;
+        if (!file.good()) {
+            file.close();
+            error_code error;
+            filesystem::remove(temporaryPath, error);
+            return;
+        }
+    }
+
+    error_code error;
+    filesystem::rename(temporaryPath, entryPath, error);
+    if (error) {
+        filesystem::remove(temporaryPath, error);
+    }
+}
+
+uint64_t FlowStepCache::getNbHits() const
+{
+    return m_nbHits.load();
+}
+
+uint64_t FlowStepCache::getNbMisses() const
+{
+    return m_nbMisses.load();
+}
+
+void FlowStepCache::clear()
+{
+    unique_lock<shared_mutex> lock(m_cacheMutex);
+
+    if (!m_directory.empty()) {
+        error_code error;
+        for (const filesystem::directory_entry& entry : filesystem::directory_iterator(m_directory, error)) {
+            if (entry.path().extension() == s_entryExtension) {
+                filesystem::remove(entry.path(), error);
+            }
+        }
+    }
+
+    m_nbHits = 0;
+    m_nbMisses = 0;
+}
+
+string FlowStepCache::getEntryPath(const string& _content) const
+{
+    return (filesystem::path(m_directory) / (computeDigest(_content) + s_entryExtension)).string();
+}
+
+} // namespace Xpert
+} // namespace Tucuxi
@@ -0,0 +1,201 @@
+#ifndef FLOWSTEPCACHE_H
+#define FLOWSTEPCACHE_H
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <shared_mutex>
+#include <string>
+
+#include "tucucommon/datetime.h"
+#include "tucucore/dosage.h"
+#include "tucucore/intakeevent.h"
+#include "tucucore/drugtreatment/patientcovariate.h"
+
+namespace Tucuxi {
+namespace Xpert {
+
+/// \brief This class builds the key of a flow step output from the inputs the step depends on.
+///
+///        The key is the canonical content of these inputs: the name of the step output followed by
+///        each input, field by field. Two keys are equal only if the step got the same inputs, whatever the
+///        query or the run they come from. The drug models are written with the digest of their content, so
+///        that a modified drug file invalidates the outputs computed with the previous version. If an input
+///        cannot be written (for example, the content of the drug model is unknown), the key becomes invalid
+///        and the cache ignores it.
+/// \date 19/10/2026
+/// \author Herzig Melvyn
+class FlowStepCacheKey
+{
+public:
+
+    /// \brief Constructor.
+    /// \param _outputName Name of the cached output. It identifies the step and the type of the output.
+    explicit FlowStepCacheKey(const std::string& _outputName);
+
+    /// \brief Add a string input.
+    /// \param _value Value to add.
+    /// \return The key, to chain the additions.
+    FlowStepCacheKey& add(const std::string& _value);
+
+    /// \brief Add a numerical input.
+    /// \param _value Value to add.
+    /// \return The key, to chain the additions.
+    FlowStepCacheKey& add(double _value);
+
+    /// \brief Add a date input.
+    /// \param _value Value to add.
+    /// \return The key, to chain the additions.
+    FlowStepCacheKey& add(const Common::DateTime& _value);
+
+    /// \brief Add a drug model: its identifier and the digest of its content registered in the FlowStepCache.
+    ///        The key becomes invalid if the content of the drug model is not registered.
+    /// \param _drugModelId Identifier of the drug model.
+    /// \return The key, to chain the additions.
+    FlowStepCacheKey& addDrugModel(const std::string& _drugModelId);
+
+    /// \brief Add the patient covariates: identifier, value, unit, data type and time of each.
+    /// \param _patientCovariates Patient covariates to add.
+    /// \return The key, to chain the additions.
+    FlowStepCacheKey& addCovariates(const Core::PatientVariates& _patientCovariates);
+
+    /// \brief Add the formulations and routes of a dosage history.
+    /// \param _dosageHistory Dosage history whose formulations and routes are added.
+    /// \return The key, to chain the additions.
+    FlowStepCacheKey& addFormulationsAndRoutes(const Core::DosageHistory& _dosageHistory);
+
+    /// \brief Add the intakes of a series up to a date: time, dose, interval, infusion time and route of each.
+    ///        The key becomes invalid if there is no series.
+    /// \param _intakes Intake series sorted by date. May be nullptr.
+    /// \param _until Date after which the intakes are not added.
+    /// \return The key, to chain the additions.
+    FlowStepCacheKey& addIntakes(const Core::IntakeSeries* _intakes, const Common::DateTime& _until);
+
+    /// \brief Get the content of the key.
+    /// \return The canonical content of the inputs.
+    const std::string& getContent() const;
+
+    /// \brief Tell whether all the inputs could be added.
+    /// \return True if the key can be used, otherwise false.
+    bool isValid() const;
+
+protected:
+
+    /// \brief Canonical content of the inputs.
+    std::string m_content;
+
+    /// \brief Whether all the inputs could be added.
+    bool m_isValid;
+};
+
+/// \brief The flow step cache is a singleton that memorizes the outputs of the flow steps
+///        by the content of their inputs (see FlowStepCacheKey).
+///
+///        The outputs are stored in a directory, one file per output, so that they survive between
+///        the runs of tuberxpert. When a query is resubmitted with small changes, a flow step finds its
+///        unchanged outputs in the directory and only computes what the change invalidated. Each file holds
+///        the whole key content, which is compared when the output is read, so that two keys with the same
+///        file name are never confused. The outputs are written to a temporary file and then renamed, so that
+///        a concurrent run never reads a partial output.
+///
+///        The digests of the drug models contents must be registered before the flow steps run. A key with
+///        a drug model whose content is unknown is ignored.
+///
+///        Without directory, the cache is disabled: nothing is found and nothing is stored.
+///        The cache is shared by all the flow steps and can be used from several threads at the same time.
+/// \date 19/10/2026
+/// \author Herzig Melvyn
+class FlowStepCache
+{
+public:
+
+    /// \brief Get the unique instance of FlowStepCache.
+    /// \return The flow step cache unique instance.
+    static FlowStepCache& getInstance();
+
+    /// \brief Set the directory where the outputs are stored. It is created if needed.
+    /// \param _directory Path of the directory. An empty path disables the cache.
+    /// \return True if the directory can be used (or if the cache is disabled), otherwise false and the cache is disabled.
+    bool setDirectory(const std::string& _directory);
+
+    /// \brief Tell whether the outputs are looked up and stored.
+    /// \return True if a directory is set, otherwise false.
+    bool isEnabled() const;
+
+    /// \brief Register the content of a drug model. The drug model identifier is read from the content.
+    /// \param _drugModelContent Content of the drug file.
+    /// \return True if a drug model identifier was found, otherwise false.
+    bool registerDrugModel(const std::string& _drugModelContent);
+
+    /// \brief Register the content of each drug file (.tdd) of a folder.
+    /// \param _folderPath Path of the folder that contains the drug files.
+    void registerDrugModelFolder(const std::string& _folderPath);
+
+    /// \brief Get the digest of the content of a drug model.
+    /// \param _drugModelId Identifier of the drug model.
+    /// \return The digest or an empty string if the content of the drug model is not registered.
+    std::string getDrugModelDigest(const std::string& _drugModelId) const;
+
+    /// \brief Find the output stored for a key.
+    /// \param _key Key of the output.
+    /// \param _output Where to store the output if found.
+    /// \return True if the output is found, false if the cache is disabled, the key is invalid or the output is not stored.
+    bool find(const FlowStepCacheKey& _key, std::string& _output);
+
+    /// \brief Store the output of a key. Nothing is stored if the cache is disabled or if the key is invalid.
+    /// \param _key Key of the output.
+    /// \param _output Output to store.
+    void insert(const FlowStepCacheKey& _key, const std::string& _output);
+
+    /// \brief Get the number of outputs found in the cache.
+    /// \return The number of hits.
+    std::uint64_t getNbHits() const;
+
+    /// \brief Get the number of outputs that were not in the cache.
+    /// \return The number of misses.
+    std::uint64_t getNbMisses() const;
+
+    /// \brief Remove the outputs stored in the directory and reset the counters.
+    ///        The registered drug models are kept.
+    void clear();
+
+private:
+
+    /// \brief Constructor. Used internally to create the singleton instance.
+    FlowStepCache();
+
+    /// \brief Singleton should not be clonable.
+    FlowStepCache(FlowStepCache& _other) = delete;
+
+    /// \brief Singleton should not be assignable.
+    void operator=(const FlowStepCache& _other) = delete;
+
+    /// \brief Get the path of the file that stores the output of a key content.
+    ///        Must be called with a lock held.
+    /// \param _content Content of the key.
+    /// \return The path of the file.
+    std::string getEntryPath(const std::string& _content) const;
+
+private:
+
+    /// \brief Protects the directory and the drug model digests. Lookups share the lock,
+    ///        modifications are exclusive.
+    mutable std::shared_mutex m_cacheMutex;
+
+    /// \brief Directory where the outputs are stored. Empty if the cache is disabled.
+    std::string m_directory;
+
+    /// \brief Map of the drug model identifiers to the digest of their content.
+    std::map<std::string, std::string> m_drugModelDigests;
+
+    /// \brief Number of outputs found in the cache.
+    std::atomic<std::uint64_t> m_nbHits;
+
+    /// \brief Number of outputs that were not in the cache.
+    std::atomic<std::uint64_t> m_nbMisses;
+};
+
+} // namespace Xpert
+} // namespace Tucuxi
+
+#endif // FLOWSTEPCACHE_H
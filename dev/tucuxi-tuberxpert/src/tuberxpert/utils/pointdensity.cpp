@@ -0,0 +1,98 @@
+#include "pointdensity.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "tucucommon/unit.h"
+
+#include "tuberxpert/utils/unitconversioncache.h"
+
+using namespace std;
+
+namespace Tucuxi {
+namespace Xpert {
+
+PointDensity::PointDensity(double _nbPointsPerHour) :
+    m_mode(PointDensityMode::FIXED),
+    m_nbPoints(_nbPointsPerHour),
+    m_minNbPointsPerHour(_nbPointsPerHour),
+    m_maxNbPointsPerHour(_nbPointsPerHour),
+    m_nbPointsPerCycle(0)
+{
+    if (!(_nbPointsPerHour > 0)) {
+        throw invalid_argument("The number of points per hour must be positive.");
+    }
+}
+
+PointDensity::PointDensity(double _nbPointsPerHalfLife,
+                           double _minNbPointsPerHour,
+                           double _maxNbPointsPerHour,
+                           double _nbPointsPerCycle) :
+    m_mode(PointDensityMode::ADAPTIVE),
+    m_nbPoints(_nbPointsPerHalfLife),
+    m_minNbPointsPerHour(_minNbPointsPerHour),
+    m_maxNbPointsPerHour(_maxNbPointsPerHour),
+    m_nbPointsPerCycle(_nbPointsPerCycle)
+{
+    // The negated comparisons also reject NaN values.
+    if (!(_nbPointsPerHalfLife > 0)) {
+        throw invalid_argument("The number of points per half-life must be positive.");
+    }
+
+    if (!(_minNbPointsPerHour > 0) || !(_minNbPointsPerHour <= _maxNbPointsPerHour)) {
+        throw invalid_argument("The minimum number of points per hour must be positive and not greater than the maximum.");
+    }
+
+    if (!(_nbPointsPerCycle >= 0)) {
+        throw invalid_argument("The number of points per cycle must not be negative.");
+    }
+}
+
+double PointDensity::getNbPointsPerHour(const Core::DrugModel& _drugModel) const
+{
+    if (m_mode == PointDensityMode::FIXED) {
+        return m_nbPoints;
+    }
+
+    // Number of points per half-life divided by the half-life in hours.
+    const Core::HalfLife& halfLife = _drugModel.getTimeConsiderations().getHalfLife();
+    double halfLifeInHours = UnitConversionCache::getInstance().convert(halfLife.getValue(), halfLife.getUnit(), Common::TucuUnit("h"));
+
+    // If the half-life is not usable, use the maximum density to stay on the safe side.
+    if (halfLifeInHours <= 0) {
+        return m_maxNbPointsPerHour;
+    }
+
+    return clamp(m_nbPoints / halfLifeInHours, m_minNbPointsPerHour, m_maxNbPointsPerHour);
+}
+
+double PointDensity::getNbPointsPerHour(const Core::DrugModel& _drugModel, const Common::Duration& _cycleDuration) const
+{
+    double nbPointsPerHour = getNbPointsPerHour(_drugModel);
+
+    if (m_mode == PointDensityMode::FIXED || m_nbPointsPerCycle == 0) {
+        return nbPointsPerHour;
+    }
+
+    // A cycle without duration cannot be refined, the absorption peak would not be bounded.
+    double cycleInHours = _cycleDuration.toHours();
+    if (cycleInHours <= 0) {
+        return nbPointsPerHour;
+    }
+
+    // The half-life density is already clamped, only the cycle density may raise it up to the maximum.
+    return max(nbPointsPerHour, min(m_nbPointsPerCycle / cycleInHours, m_maxNbPointsPerHour));
+}
+
+bool PointDensity::dependsOnCycleDuration() const
+{
+    return m_mode == PointDensityMode::ADAPTIVE && m_nbPointsPerCycle > 0;
+}
+
+PointDensityMode PointDensity::getMode() const
+{
+    return m_mode;
+}
+
+} // namespace Xpert
+} // namespace Tucuxi
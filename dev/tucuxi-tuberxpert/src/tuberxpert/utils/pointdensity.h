@@ -0,0 +1,103 @@
+#ifndef POINTDENSITY_H
+#define POINTDENSITY_H
+
+#include "tucucommon/duration.h"
+#include "tucucore/drugmodel/drugmodel.h"
+
+namespace Tucuxi {
+namespace Xpert {
+
+/// \brief The point density mode.
+///        - FIXED: the same number of points per hour is used whatever the drug.
+///        - ADAPTIVE: the number of points per hour is derived from the drug half-life and, for the traits
+///                    that only cover one cycle, from the duration of that cycle.
+enum class PointDensityMode
+{
+    FIXED,
+    ADAPTIVE
+};
+
+/// \brief This class defines the number of points per hour that a flow step
+///        uses for the traits it submits to Tucuxi core.
+///
+///        Tucuxi core applies one number of points per hour to a whole trait. Then, the adaptive
+///        mode works at the drug level: it targets a number of points per half-life, so that drugs
+///        with short half-lives (sharp absorption peaks) get dense curves and drugs with long half-lives
+///        (long elimination tails) get sparse ones. The result is clamped between a minimum and a maximum
+///        number of points per hour to keep the peaks and troughs accurate.
+///
+///        The traits that only cover one cycle (the cycle around a sample, the steady state cycle) are the
+///        ones where the absorption peak and the sample neighbourhood matter. For them, the adaptive mode
+///        is locally refined: it also targets a number of points per cycle, so that short dosing intervals,
+///        whose peaks are sharp, get denser curves than the whole period traits.
+///
+///        Each flow step receives its density from its flow step provider, which makes it configurable
+///        per step and per drug.
+/// \date 19/10/2026
+/// \author Herzig Melvyn
+class PointDensity
+{
+public:
+
+    /// \brief Constructor of a fixed point density.
+    /// \param _nbPointsPerHour Number of points per hour to use. Must be positive.
+    /// \throw invalid_argument If the number of points per hour is not positive.
+    explicit PointDensity(double _nbPointsPerHour);
+
+    /// \brief Constructor of an adaptive point density.
+    /// \param _nbPointsPerHalfLife Number of points targeted for one half-life of the drug. Must be positive.
+    /// \param _minNbPointsPerHour Minimum number of points per hour. Must be positive.
+    /// \param _maxNbPointsPerHour Maximum number of points per hour. Must not be lower than the minimum.
+    /// \param _nbPointsPerCycle Number of points targeted for one cycle by the single cycle traits.
+    ///                          Zero disables the local refinement. Must not be negative.
+    /// \throw invalid_argument If one of the values is out of its range.
+    PointDensity(double _nbPointsPerHalfLife,
+                 double _minNbPointsPerHour,
+                 double _maxNbPointsPerHour,
+                 double _nbPointsPerCycle = 0);
+
+    /// \brief Get the number of points per hour of a trait covering the whole period, for the given drug model.
+    /// \param _drugModel Drug model whose half-life is used by the adaptive mode.
+    /// \return The number of points per hour.
+    double getNbPointsPerHour(const Core::DrugModel& _drugModel) const;
+
+    /// \brief Get the number of points per hour of a trait covering a single cycle, for the given drug model.
+    ///        In adaptive mode, the density is the highest of the half-life density and the
+    ///        number of points per cycle divided by the cycle duration, clamped between the minimum
+    ///        and the maximum.
+    /// \param _drugModel Drug model whose half-life is used by the adaptive mode.
+    /// \param _cycleDuration Duration of the cycle covered by the trait (dosing interval).
+    /// \return The number of points per hour.
+    double getNbPointsPerHour(const Core::DrugModel& _drugModel, const Common::Duration& _cycleDuration) const;
+
+    /// \brief Tell whether the density of the single cycle traits depends on the cycle duration, so that the
+    ///        flow steps only look for the cycle of a trait when it changes the density.
+    /// \return True in adaptive mode with a number of points per cycle, otherwise false.
+    bool dependsOnCycleDuration() const;
+
+    /// \brief Get the point density mode.
+    /// \return The point density mode.
+    PointDensityMode getMode() const;
+
+protected:
+
+    /// \brief Point density mode.
+    PointDensityMode m_mode;
+
+    /// \brief Fixed mode: number of points per hour. Adaptive mode: number of points per half-life.
+    double m_nbPoints;
+
+    /// \brief Minimum number of points per hour in adaptive mode.
+    double m_minNbPointsPerHour;
+
+    /// \brief Maximum number of points per hour in adaptive mode.
+    double m_maxNbPointsPerHour;
+
+    /// \brief Number of points per cycle of the single cycle traits in adaptive mode. Zero if not refined.
+    double m_nbPointsPerCycle;
+};
+
+} // namespace Xpert
+} // namespace Tucuxi
+
+#endif // POINTDENSITY_H
@@ -0,0 +1,154 @@
+#ifndef REQUESTRESULT_H
+#define REQUESTRESULT_H
+
+#include <memory>
+#include <stdexcept>
+
+#include "tucucore/computingservice/computingresponse.h"
+#include "tucucore/computingservice/computingresult.h"
+#include "tucucore/computingservice/computingtrait.h"
+
+namespace Tucuxi {
+namespace Xpert {
+
+/// \brief Error of a request executed by Tucuxi core.
+///        - NONE: the request succeeded.
+///        - COMPUTATION_FAILED: the computing service returned a status other than Ok.
+///        - NO_DATA: the computing service succeeded but the response holds no data of the type expected by the trait.
+enum class RequestError
+{
+    NONE,
+    COMPUTATION_FAILED,
+    NO_DATA
+};
+
+/// \brief Type of the data computed by Tucuxi core for a computing trait.
+///        Each trait always produces the same data type, so the data of a response
+///        is converted at compile time, without a RTTI cast.
+template<typename T>
+struct TraitData;
+
+/// \brief An adjustment trait produces adjustment data.
+template<>
+struct TraitData<Core::ComputingTraitAdjustment>
+{
+    using type = Core::AdjustmentData;
+};
+
+/// \brief A concentration trait produces single prediction data.
+template<>
+struct TraitData<Core::ComputingTraitConcentration>
+{
+    using type = Core::SinglePredictionData;
+};
+
+/// \brief A percentiles trait produces percentiles data.
+template<>
+struct TraitData<Core::ComputingTraitPercentiles>
+{
+    using type = Core::PercentilesData;
+};
+
+/// \brief This class holds the typed result of a request executed by Tucuxi core:
+///        either the data of type U or the error that occurred.
+///
+///        It is move-only. The data is handed back as it is released from the computing
+///        response, the flow steps take it with takeData or read it in place with getData.
+/// \date 19/10/2026
+/// \author Herzig Melvyn
+template<typename U>
+class RequestResult
+{
+public:
+
+    /// \brief Make the result of a successful request.
+    /// \param _data Data computed by the request. If nullptr, the error is NO_DATA.
+    /// \return The resulting request result.
+    static RequestResult success(std::unique_ptr<U> _data)
+    {
+        RequestError error = _data == nullptr ? RequestError::NO_DATA : RequestError::NONE;
+        return RequestResult(std::move(_data), error, Core::ComputingStatus::Ok);
+    }
+
+    /// \brief Make the result of a failed request.
+    /// \param _status Status returned by the computing service.
+    /// \return The resulting request result.
+    static RequestResult failure(Core::ComputingStatus _status)
+    {
+        return RequestResult(nullptr, RequestError::COMPUTATION_FAILED, _status);
+    }
+
+    RequestResult(RequestResult&& _other) = default;
+    RequestResult& operator=(RequestResult&& _other) = default;
+    RequestResult(const RequestResult& _other) = delete;
+    RequestResult& operator=(const RequestResult& _other) = delete;
+
+    /// \brief Tell whether the request succeeded and the data is available.
+    /// \return True if the data is available, otherwise false.
+    bool isOk() const
+    {
+        return m_error == RequestError::NONE && m_data != nullptr;
+    }
+
+    /// \brief Get the error of the request.
+    /// \return The error, NONE if the request succeeded.
+    RequestError getError() const
+    {
+        return m_error;
+    }
+
+    /// \brief Get the status returned by the computing service.
+    /// \return The computing status.
+    Core::ComputingStatus getComputingStatus() const
+    {
+        return m_computingStatus;
+    }
+
+    /// \brief Get the data computed by the request.
+    /// \return A reference to the data.
+    /// \throw logic_error If the request failed.
+    const U& getData() const
+    {
+        if (!isOk()) {
+            throw std::logic_error("The request has no data.");
+        }
+        return *m_data;
+    }
+
+    /// \brief Take the ownership of the data computed by the request.
+    ///        The result has no more data afterwards.
+    /// \return The data, nullptr if the request failed or if the data has already been taken.
+    std::unique_ptr<U> takeData()
+    {
+        if (m_error == RequestError::NONE) {
+            m_error = RequestError::NO_DATA;
+        }
+        return std::move(m_data);
+    }
+
+protected:
+
+    /// \brief Constructor.
+    /// \param _data Data computed by the request.
+    /// \param _error Error of the request.
+    /// \param _computingStatus Status returned by the computing service.
+    RequestResult(std::unique_ptr<U> _data, RequestError _error, Core::ComputingStatus _computingStatus) :
+        m_data(std::move(_data)), m_error(_error), m_computingStatus(_computingStatus)
+    {}
+
+protected:
+
+    /// \brief Data computed by the request.
+    std::unique_ptr<U> m_data;
+
+    /// \brief Error of the request.
+    RequestError m_error;
+
+    /// \brief Status returned by the computing service.
+    Core::ComputingStatus m_computingStatus;
+};
+
+} // namespace Xpert
+} // namespace Tucuxi
+
+#endif // REQUESTRESULT_H
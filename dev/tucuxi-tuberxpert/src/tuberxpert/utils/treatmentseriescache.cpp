@@ -0,0 +1,56 @@
+#include "treatmentseriescache.h"
+
+#include <cstdint>
+
+#include "tucucore/intakeextractor.h"
+
+using namespace std;
+
+namespace Tucuxi {
+namespace Xpert {
+
+TreatmentSeriesCache::TreatmentSeriesCache(const Core::DrugTreatment* _drugTreatment) :
+    m_drugTreatment(_drugTreatment)
+{}
+
+const Core::IntakeSeries* TreatmentSeriesCache::getIntakes(const Common::TucuUnit& _doseUnit,
+                                                           const Common::DateTime& _start,
+                                                           const Common::DateTime& _end) const
+{
+    if (m_drugTreatment == nullptr) {
+        return nullptr;
+    }
+
+    // The dates are written to the second, as the dosage history.
+    auto windowBound = [](const Common::DateTime& _date) {
+        return _date.isUndefined() ? string("undefined") : to_string(int64_t(_date.toSeconds()));
+    };
+    auto key = make_tuple(_doseUnit.toString(), windowBound(_start), windowBound(_end));
+
+    auto intakesIt = m_intakes.find(key);
+    if (intakesIt != m_intakes.end()) {
+        return intakesIt->second.get();
+    }
+
+    unique_ptr<Core::IntakeSeries> intakes = make_unique<Core::IntakeSeries>();
+
+    // Without start, there is no dosage to extract.
+    if (!_start.isUndefined()) {
+        Core::IntakeExtractor intakeExtractor;
+        Core::ComputingStatus cs = intakeExtractor.extract(m_drugTreatment->getDosageHistory(),
+                                                           _start,
+                                                           _end,
+                                                           1,
+                                                           _doseUnit,
+                                                           *intakes);
+
+        if (cs != Core::ComputingStatus::Ok) {
+            intakes = nullptr;
+        }
+    }
+
+    return m_intakes.emplace(move(key), move(intakes)).first->second.get();
+}
+
+} // namespace Xpert
+} // namespace Tucuxi
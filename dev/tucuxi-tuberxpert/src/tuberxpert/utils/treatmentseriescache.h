@@ -0,0 +1,61 @@
+#ifndef TREATMENTSERIESCACHE_H
+#define TREATMENTSERIESCACHE_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+
+#include "tucucommon/datetime.h"
+#include "tucucommon/unit.h"
+#include "tucucore/drugtreatment/drugtreatment.h"
+#include "tucucore/intakeevent.h"
+
+namespace Tucuxi {
+namespace Xpert {
+
+/// \brief This class memorizes the intake series extracted from the dosage history of a request treatment.
+///
+///        A series is extracted lazily, the first time a flow step asks for it, and then shared by all the
+///        flow steps of the request. The series are keyed by dose unit and time window: a flow step that asks
+///        for the same unit and window reuses the extraction, another window gets its own extraction. The flow
+///        steps receive the cache by const reference from the XpertRequestResult and read the series in place,
+///        without copying them.
+///
+///        The covariate series are not stored: the covariates are extracted inside the core (constraints evaluation,
+///        computing requests), which does not accept pre-extracted series, and the flow steps read the patient
+///        covariates directly.
+/// \date 19/10/2026
+/// \author Herzig Melvyn
+class TreatmentSeriesCache
+{
+public:
+
+    /// \brief Constructor.
+    /// \param _drugTreatment Treatment whose dosage history is extracted. May be nullptr. Must survive as long as
+    ///                       this object is alive (stored pointer).
+    explicit TreatmentSeriesCache(const Core::DrugTreatment* _drugTreatment);
+
+    /// \brief Get the intakes of the dosage history within a time window, sorted by date. They are extracted
+    ///        on the first call for the unit and the window.
+    /// \param _doseUnit Unit of the doses of the extracted intakes.
+    /// \param _start Start of the window. If undefined, the series is empty.
+    /// \param _end End of the window. If undefined, the intakes are extracted up to the end of the dosage history.
+    /// \return The intake series or nullptr if there is no treatment or if the extraction failed.
+    const Core::IntakeSeries* getIntakes(const Common::TucuUnit& _doseUnit,
+                                         const Common::DateTime& _start,
+                                         const Common::DateTime& _end) const;
+
+protected:
+
+    /// \brief Treatment whose dosage history is extracted.
+    const Core::DrugTreatment* m_drugTreatment;
+
+    /// \brief Extracted intake series by dose unit, start and end of the window. The failed extractions are stored as nullptr.
+    mutable std::map<std::tuple<std::string, std::string, std::string>, std::unique_ptr<const Core::IntakeSeries>> m_intakes;
+};
+
+} // namespace Xpert
+} // namespace Tucuxi
+
+#endif // TREATMENTSERIESCACHE_H
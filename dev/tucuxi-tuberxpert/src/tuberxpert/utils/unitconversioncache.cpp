@@ -0,0 +1,113 @@
+#include "unitconversioncache.h"
+
+using namespace std;
+
+namespace Tucuxi {
+namespace Xpert {
+
+UnitConversionCache::UnitConversionCache() :
+    m_nbHits(0),
+    m_nbMisses(0)
+{}
+
+UnitConversionCache& UnitConversionCache::getInstance()
+{
+    // The initialization of a local static is thread-safe, so the flow steps that
+    // convert each value do not serialize on a lock to get the instance.
+    static UnitConversionCache instance;
+    return instance;
+}
+
+double UnitConversionCache::convert(double _value, const Common::TucuUnit& _from, const Common::TucuUnit& _to)
+{
+    ConversionFactor factor = getFactor(_from, _to);
+    return _value * factor.m_scale + factor.m_offset;
+}
+
+void UnitConversionCache::convert(vector<double>& _values, const Common::TucuUnit& _from, const Common::TucuUnit& _to)
+{
+    // The factor is resolved once, whatever the number of values.
+    ConversionFactor factor = getFactor(_from, _to);
+    for (double& value : _values) {
+        value = value * factor.m_scale + factor.m_offset;
+    }
+}
+
+uint64_t UnitConversionCache::getNbHits() const
+{
+    return m_nbHits.load();
+}
+
+uint64_t UnitConversionCache::getNbMisses() const
+{
+    return m_nbMisses.load();
+}
+
+void UnitConversionCache::clear()
+{
+    unique_lock<shared_mutex> lock(m_cacheMutex);
+    m_factors.clear();
+    m_unitToId.clear();
+    m_nbHits = 0;
+    m_nbMisses = 0;
+}
+
+UnitConversionCache::ConversionFactor UnitConversionCache::getFactor(const Common::TucuUnit& _from, const Common::TucuUnit& _to)
+{
+    string fromString = _from.toString();
+    string toString = _to.toString();
+
+    // First try with the shared lock, this is the path taken by almost every conversion.
+    {
+        shared_lock<shared_mutex> lock(m_cacheMutex);
+
+        size_t fromId;
+        size_t toId;
+        if (findInterned(fromString, fromId) && findInterned(toString, toId)) {
+            auto factorIt = m_factors.find(make_pair(fromId, toId));
+            if (factorIt != m_factors.end()) {
+                ++m_nbHits;
+                return factorIt->second;
+            }
+        }
+    }
+
+    // Resolve the factor with the unit manager outside of any lock.
+    // It throws invalid_argument if the units are incompatible, in which case nothing is stored.
+    // The values at 0 and 1 give the offset and the scale of the conversion.
+    double offset = Common::UnitManager::convertToUnit(0.0, _from, _to);
+    double scale = Common::UnitManager::convertToUnit(1.0, _from, _to) - offset;
+    ConversionFactor factor{scale, offset};
+
+    unique_lock<shared_mutex> lock(m_cacheMutex);
+    m_factors.emplace(make_pair(intern(fromString), intern(toString)), factor);
+    ++m_nbMisses;
+
+    return factor;
+}
+
+size_t UnitConversionCache::intern(const string& _unit)
+{
+    auto unitIt = m_unitToId.find(_unit);
+    if (unitIt != m_unitToId.end()) {
+        return unitIt->second;
+    }
+
+    size_t id = m_unitToId.size();
+    m_unitToId.emplace(_unit, id);
+    return id;
+}
+
+bool UnitConversionCache::findInterned(const string& _unit, size_t& _id) const
+{
+    auto unitIt = m_unitToId.find(_unit);
+    if (unitIt == m_unitToId.end()) {
+        return false;
+    }
+
+    _id = unitIt->second;
+    return true;
+}
+
+} // namespace Xpert
+} // namespace Tucuxi
@@ -0,0 +1,128 @@
+#ifndef UNITCONVERSIONCACHE_H
+#define UNITCONVERSIONCACHE_H
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <shared_mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "tucucommon/unit.h"
+
+namespace Tucuxi {
+namespace Xpert {
+
+/// \brief The unit conversion cache is a singleton that memorizes the conversion
+///        factors between two units so that the string based unit resolution of
+///        Common::UnitManager is only done once per pair of units.
+///
+///        The units are interned: each distinct unit string receives an identifier
+///        and the conversions are stored by pair of identifiers. A conversion is stored
+///        as an affine transformation (value * scale + offset) computed with the UnitManager,
+///        which makes the cache exact for linear units (mg, g, mg/l, kg, h...) as well
+///        as for units with an offset.
+///
+///        The cache is shared by all the flow steps and can be used from several
+///        threads at the same time.
+/// \date 19/10/2026
+/// \author Herzig Melvyn
+class UnitConversionCache
+{
+public:
+
+    /// \brief Get the unique instance of UnitConversionCache.
+    /// \return The unit conversion cache unique instance.
+    static UnitConversionCache& getInstance();
+
+    /// \brief Convert a value from a unit to another one.
+    /// \param _value Value to convert.
+    /// \param _from Unit of the value.
+    /// \param _to Unit in which the value must be converted.
+    /// \return The converted value.
+    /// \throw invalid_argument If the units are not compatible (same as Common::UnitManager).
+    double convert(double _value, const Common::TucuUnit& _from, const Common::TucuUnit& _to);
+
+    /// \brief Convert, in place, a series of values from a unit to another one.
+    ///        The conversion factor is resolved once for the whole series.
+    /// \param _values Values to convert.
+    /// \param _from Unit of the values.
+    /// \param _to Unit in which the values must be converted.
+    /// \throw invalid_argument If the units are not compatible (same as Common::UnitManager).
+    void convert(std::vector<double>& _values, const Common::TucuUnit& _from, const Common::TucuUnit& _to);
+
+    /// \brief Get the number of conversions whose factor was already in the cache.
+    /// \return The number of hits.
+    std::uint64_t getNbHits() const;
+
+    /// \brief Get the number of conversions whose factor had to be resolved by the UnitManager.
+    /// \return The number of misses.
+    std::uint64_t getNbMisses() const;
+
+    /// \brief Remove all the factors and interned units and reset the counters.
+    void clear();
+
+private:
+
+    /// \brief Affine conversion between two units: converted = value * m_scale + m_offset.
+    struct ConversionFactor
+    {
+        /// \brief Multiplicative part of the conversion.
+        double m_scale;
+
+        /// \brief Additive part of the conversion.
+        double m_offset;
+    };
+
+    /// \brief Constructor. Used internally to create the singleton instance.
+    UnitConversionCache();
+
+    /// \brief Singleton should not be clonable.
+    UnitConversionCache(UnitConversionCache& _other) = delete;
+
+    /// \brief Singleton should not be assignable.
+    void operator=(const UnitConversionCache& _other) = delete;
+
+    /// \brief Get the conversion factor between two units. Resolve it with the UnitManager
+    ///        and store it if it is not known yet.
+    /// \param _from Source unit.
+    /// \param _to Target unit.
+    /// \return The conversion factor.
+    /// \throw invalid_argument If the units are not compatible.
+    ConversionFactor getFactor(const Common::TucuUnit& _from, const Common::TucuUnit& _to);
+
+    /// \brief Get the identifier of a unit string. Must be called with the write lock held.
+    /// \param _unit Unit string to intern.
+    /// \return The identifier of the unit.
+    std::size_t intern(const std::string& _unit);
+
+    /// \brief Try to get the identifier of a unit string. Must be called with a lock held.
+    /// \param _unit Unit string to look for.
+    /// \param _id Where to store the identifier if found.
+    /// \return True if the unit is already interned, otherwise false.
+    bool findInterned(const std::string& _unit, std::size_t& _id) const;
+
+private:
+
+    /// \brief Protects the interned units and the factors. Lookups share the lock,
+    ///        insertions are exclusive.
+    mutable std::shared_mutex m_cacheMutex;
+
+    /// \brief Map of the unit strings to their interned identifier.
+    std::map<std::string, std::size_t> m_unitToId;
+
+    /// \brief Map of the pairs of interned identifiers (source, target) to their conversion factor.
+    std::map<std::pair<std::size_t, std::size_t>, ConversionFactor> m_factors;
+
+    /// \brief Number of conversions that found their factor in the cache.
+    std::atomic<std::uint64_t> m_nbHits;
+
+    /// \brief Number of conversions that had to resolve their factor.
+    std::atomic<std::uint64_t> m_nbMisses;
+};
+
+} // namespace Xpert
+} // namespace Tucuxi
+
+#endif // UNITCONVERSIONCACHE_H
@@ -12,6 +12,7 @@
 
 #include "tuberxpert/language/languagemanager.h"
 #include "tuberxpert/result/xpertrequestresult.h"
+#include "tuberxpert/utils/requestresult.h"
 
 namespace Tucuxi {
 namespace Xpert {
@@ -112,34 +113,54 @@ std::string computeFileName(const XpertRequestResult& _xpertRequestResult,
                             bool _addOutputPath = true,
                             bool _addExtension = true);
 
-/// \brief For the given trait T, make a request and execute it. Then convert the response to U and
-///        place it in the response pointer.
-///        The response pointer is set to nullptr if the computation fails.
+/// \brief For the given trait T, make a request on the given treatment and execute it.
+///        The data of the response is handed back typed, as the computing service computed it.
+///        The ComputingResponse is only the holder the computing service requires to return the data.
 /// \param _trait Computing trait to be used for request.
-/// \param _xpertRequestResult XpertRequestResult to retrieve the treatment and drug model.
-/// \param _responsePointer Pointer where to put the response.
-template<typename T, typename U>
-void executeRequestAndGetResult(std::unique_ptr<T> _trait,
-                                const XpertRequestResult& _xpertRequestResult,
-                                std::unique_ptr<U>& _responsePointer)
+/// \param _xpertRequestResult XpertRequestResult to retrieve the drug model.
+/// \param _drugTreatment Drug treatment to use for the request.
+/// \return The result holding the data of the type produced by T, the NO_DATA error if the response holds
+///         no data of this type, or the error if the computation failed.
+template<typename T>
+RequestResult<typename TraitData<T>::type> executeRequest(std::unique_ptr<T> _trait,
+                                                         const XpertRequestResult& _xpertRequestResult,
+                                                         const Core::DrugTreatment& _drugTreatment)
 {
+    using U = typename TraitData<T>::type;
+
     // Make the computing request and response.
-    Core::ComputingRequest computingRequest { "", *_xpertRequestResult.getDrugModel(), *_xpertRequestResult.getTreatment(), move(_trait)};
+    Core::ComputingRequest computingRequest { "", *_xpertRequestResult.getDrugModel(), _drugTreatment, std::move(_trait)};
     std::unique_ptr<Core::ComputingResponse> computingResponse = std::make_unique<Core::ComputingResponse>("");
 
     // Start the computation in tucuxi-core.
     Core::IComputingService* computingComponent = dynamic_cast<Core::IComputingService*>(Core::ComputingComponent::createComponent());
     Core::ComputingStatus result = computingComponent->compute(computingRequest, computingResponse);
 
-    // If the computation failed, set to nullptr and leave.
+    // If the computation failed, report its status.
     if (result != Core::ComputingStatus::Ok) {
-        _responsePointer = nullptr;
-        return;
+        return RequestResult<U>::failure(result);
     }
 
-    // Acquire the data and put it in the unique pointer as the response.
-    U* dataPointer = dynamic_cast<U*>(computingResponse->getUniquePointerData().release());
-    _responsePointer = std::unique_ptr<U>(dataPointer);
+    // Take the data out of the response. If it is not of the type of the trait, it is freed here.
+    std::unique_ptr<Core::ComputedData> data = std::move(computingResponse->getUniquePointerData());
+    U* typedData = dynamic_cast<U*>(data.get());
+    if (typedData == nullptr) {
+        return RequestResult<U>::success(nullptr);
+    }
+
+    data.release();
+    return RequestResult<U>::success(std::unique_ptr<U>(typedData));
+}
+
+/// \brief For the given trait T, make a request on the treatment of the XpertRequestResult and execute it.
+/// \param _trait Computing trait to be used for request.
+/// \param _xpertRequestResult XpertRequestResult to retrieve the treatment and drug model.
+/// \return The result holding the data of the type produced by T, or the error if the computation failed.
+template<typename T>
+RequestResult<typename TraitData<T>::type> executeRequest(std::unique_ptr<T> _trait,
+                                                         const XpertRequestResult& _xpertRequestResult)
+{
+    return executeRequest(std::move(_trait), _xpertRequestResult, *_xpertRequestResult.getTreatment());
 }
 
 /// \brief Convert a camel case key to a phrase.
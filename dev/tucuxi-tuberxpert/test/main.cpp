@@ -44,6 +44,38 @@
 #include "tests/test_requestexecutor.h"
 #endif
 
+#if defined(test_unitconversioncache)
+#include "tests/test_unitconversioncache.h"
+#endif
+
+#if defined(test_pointdensity)
+#include "tests/test_pointdensity.h"
+#endif
+
+#if defined(test_adjustmenttraitview)
+#include "tests/test_adjustmenttraitview.h"
+#endif
+
+#if defined(test_treatmentseriescache)
+#include "tests/test_treatmentseriescache.h"
+#endif
+
+#if defined(test_flowstepcache)
+#include "tests/test_flowstepcache.h"
+#endif
+
+#if defined(test_xpertflowstepproviderregistry)
+#include "tests/test_xpertflowstepproviderregistry.h"
+#endif
+
+#if defined(test_svgchart)
+#include "tests/test_svgchart.h"
+#endif
+
+#if defined(test_xpertrequestresultxmlexport)
+#include "tests/test_xpertrequestresultxmlexport.h"
+#endif
+
 
 using namespace std;
 
@@ -76,7 +108,7 @@ int main(int argc, char** argv)
     xpertUtilsTests.add_test("Get oldest dosageTimeRange start behaves correctly.", &TestXpertUtils::getOldestDosageTimeRangeStart_behavesCorrectly);
     xpertUtilsTests.add_test("Get latest dosageTimeRange start behaves correctly.", &TestXpertUtils::getLatestDosageTimeRangeStart_behavesCorrectly);
     xpertUtilsTests.add_test("Compute file name behaves correctly.", &TestXpertUtils::computeFileName_behavesCorrectly);
-    xpertUtilsTests.add_test("Execute request and get result behaves correctly.", &TestXpertUtils::executeRequestAndGetResult_behavesCorrectly);
+    xpertUtilsTests.add_test("Execute request behaves correctly.", &TestXpertUtils::executeRequest_behavesCorrectly);
     xpertUtilsTests.add_test("Key to phrase behaves correctly.", &TestXpertUtils::keyToPhrase_behavesCorrectly);
     xpertUtilsTests.add_test("Get age in behaves correctly.", &TestXpertUtils::getAgeIn_behavesCorrectly);
 
@@ -267,6 +299,9 @@ int main(int argc, char** argv)
     testSampleValidator.add_test("findGroupPositionOver99Percentiles throw invalid argument when sample unit conversion failure.", &TestSampleValidator::findGroupPositionOver99Percentiles_throwInvalidArgument_whenSampleUnitConversionFailure);
     testSampleValidator.add_test("findGroupPositionOver99Percentiles throw invalid argument when sample date not found in CycleData.", &TestSampleValidator::findGroupPositionOver99Percentiles_throwInvalidArgument_whenSampleDateNotFoundInCycleData);
     testSampleValidator.add_test("getSampleValidationResult is sorted when not empty.", &TestSampleValidator::getSampleValidationResult_isSorted_whenNotEmpty);
+    testSampleValidator.add_test("keepSelectedRanks keeps only selected ranks with given PercentilesData.", &TestSampleValidator::keepSelectedRanks_keepsOnlySelectedRanks_withGivenPercentilesData);
+    testSampleValidator.add_test("readClassification reads back written classification.", &TestSampleValidator::readClassification_readsBackWrittenClassification);
+    testSampleValidator.add_test("sampleValidator reuses classifications when query resubmitted.", &TestSampleValidator::sampleValidator_reusesClassifications_whenQueryResubmitted);
 
     res = testSampleValidator.run(argc, argv);
     if (res != 0) {
@@ -362,6 +397,8 @@ int main(int argc, char** argv)
     testRequestExecutor.add_test("requestExecutor gets the statistics when request execution succeed.", &TestRequestExecutor::requestExecutor_getsTheStatistics_whenRequestExecutionSucceed);
     testRequestExecutor.add_test("requestExecutor gets typical apriori aposteriori parameters when aposteriori trait.", &TestRequestExecutor::requestExecutor_getsTypicalAprioriAposterioriParameters_whenAposterioriTrait);
     testRequestExecutor.add_test("requestExecutor gets typical apriori parameters when apriori trait.", &TestRequestExecutor::requestExecutor_getsTypicalAprioriParameters_whenAprioriTrait);
+    testRequestExecutor.add_test("requestExecutor limits candidates with candidates limits.", &TestRequestExecutor::requestExecutor_limitsCandidates_withCandidatesLimits);
+    testRequestExecutor.add_test("requestExecutor computes steady state statistics on one cycle at steady state.", &TestRequestExecutor::requestExecutor_computesSteadyStateStatistics_onOneCycleAtSteadyState);
 
     res = testRequestExecutor.run(argc, argv);
     if (res != 0) {
@@ -373,5 +410,173 @@ int main(int argc, char** argv)
 #endif
 
 
+    /***********************************************************
+     *                   UnitConversionCache                   *
+     ***********************************************************/
+
+#if defined(test_unitconversioncache)
+    TestUnitConversionCache testUnitConversionCache;
+
+    testUnitConversionCache.add_test("convert gives same values as unit manager.", &TestUnitConversionCache::convert_givesSameValuesAsUnitManager);
+    testUnitConversionCache.add_test("convert reuses factor with same pair of units.", &TestUnitConversionCache::convert_reusesFactor_withSamePairOfUnits);
+    testUnitConversionCache.add_test("convert series behaves correctly.", &TestUnitConversionCache::convertSeries_behavesCorrectly);
+    testUnitConversionCache.add_test("convert throws with incompatible units.", &TestUnitConversionCache::convert_throws_withIncompatibleUnits);
+
+    res = testUnitConversionCache.run(argc, argv);
+    if (res != 0) {
+        std::cout << "Unit conversion cache tests failed" << std::endl << std::endl;
+        exit(1);
+    } else {
+        std::cout << "Unit conversion cache tests succeeded" << std::endl << std::endl;
+    }
+#endif
+
+
+    /***********************************************************
+     *                       PointDensity                      *
+     ***********************************************************/
+
+#if defined(test_pointdensity)
+    TestPointDensity testPointDensity;
+
+    testPointDensity.add_test("getNbPointsPerHour returns the value with fixed density.", &TestPointDensity::getNbPointsPerHour_returnsTheValue_withFixedDensity);
+    testPointDensity.add_test("getNbPointsPerHour follows half-life with adaptive density.", &TestPointDensity::getNbPointsPerHour_followsHalfLife_withAdaptiveDensity);
+    testPointDensity.add_test("getNbPointsPerHour refines single cycles with points per cycle.", &TestPointDensity::getNbPointsPerHour_refinesSingleCycles_withPointsPerCycle);
+    testPointDensity.add_test("constructor throws with invalid values.", &TestPointDensity::constructor_throws_withInvalidValues);
+
+    res = testPointDensity.run(argc, argv);
+    if (res != 0) {
+        std::cout << "Point density tests failed" << std::endl << std::endl;
+        exit(1);
+    } else {
+        std::cout << "Point density tests succeeded" << std::endl << std::endl;
+    }
+#endif
+
+
+    /***********************************************************
+     *                   AdjustmentTraitView                   *
+     ***********************************************************/
+
+#if defined(test_adjustmenttraitview)
+    TestAdjustmentTraitView testAdjustmentTraitView;
+
+    testAdjustmentTraitView.add_test("materialize returns base trait without override.", &TestAdjustmentTraitView::materialize_returnsBaseTrait_withoutOverride);
+    testAdjustmentTraitView.add_test("materialize applies overrides with overrides.", &TestAdjustmentTraitView::materialize_appliesOverrides_withOverrides);
+
+    res = testAdjustmentTraitView.run(argc, argv);
+    if (res != 0) {
+        std::cout << "Adjustment trait view tests failed" << std::endl << std::endl;
+        exit(1);
+    } else {
+        std::cout << "Adjustment trait view tests succeeded" << std::endl << std::endl;
+    }
+#endif
+
+
+    /***********************************************************
+     *                   TreatmentSeriesCache                  *
+     ***********************************************************/
+
+#if defined(test_treatmentseriescache)
+    TestTreatmentSeriesCache testTreatmentSeriesCache;
+
+    testTreatmentSeriesCache.add_test("getIntakes returns same series with same unit and window.", &TestTreatmentSeriesCache::getIntakes_returnsSameSeries_withSameUnitAndWindow);
+    testTreatmentSeriesCache.add_test("getIntakes returns no intake without dosage.", &TestTreatmentSeriesCache::getIntakes_returnsNoIntake_withoutDosage);
+
+    res = testTreatmentSeriesCache.run(argc, argv);
+    if (res != 0) {
+        std::cout << "Treatment series cache tests failed" << std::endl << std::endl;
+        exit(1);
+    } else {
+        std::cout << "Treatment series cache tests succeeded" << std::endl << std::endl;
+    }
+#endif
+
+
+    /***********************************************************
+     *                      FlowStepCache                      *
+     ***********************************************************/
+
+#if defined(test_flowstepcache)
+    TestFlowStepCache testFlowStepCache;
+
+    testFlowStepCache.add_test("key depends on inputs with different inputs.", &TestFlowStepCache::key_dependsOnInputs_withDifferentInputs);
+    testFlowStepCache.add_test("key depends on drug model content with same identifier.", &TestFlowStepCache::key_dependsOnDrugModelContent_withSameIdentifier);
+    testFlowStepCache.add_test("find returns stored output after reopening the directory.", &TestFlowStepCache::find_returnsStoredOutput_afterReopeningTheDirectory);
+    testFlowStepCache.add_test("find returns nothing when disabled.", &TestFlowStepCache::find_returnsNothing_whenDisabled);
+
+    res = testFlowStepCache.run(argc, argv);
+    if (res != 0) {
+        std::cout << "Flow step cache tests failed" << std::endl << std::endl;
+        exit(1);
+    } else {
+        std::cout << "Flow step cache tests succeeded" << std::endl << std::endl;
+    }
+#endif
+
+
+    /***********************************************************
+     *               XpertFlowStepProviderRegistry             *
+     ***********************************************************/
+
+#if defined(test_xpertflowstepproviderregistry)
+    TestXpertFlowStepProviderRegistry testXpertFlowStepProviderRegistry;
+
+    testXpertFlowStepProviderRegistry.add_test("getProvider returns general provider with unknown drug.", &TestXpertFlowStepProviderRegistry::getProvider_returnsGeneralProvider_withUnknownDrug);
+    testXpertFlowStepProviderRegistry.add_test("getProvider returns registered provider with registered drug.", &TestXpertFlowStepProviderRegistry::getProvider_returnsRegisteredProvider_withRegisteredDrug);
+    testXpertFlowStepProviderRegistry.add_test("getProvider keeps provider alive when replaced.", &TestXpertFlowStepProviderRegistry::getProvider_keepsProviderAlive_whenReplaced);
+
+    res = testXpertFlowStepProviderRegistry.run(argc, argv);
+    if (res != 0) {
+        std::cout << "Xpert flow step provider registry tests failed" << std::endl << std::endl;
+        exit(1);
+    } else {
+        std::cout << "Xpert flow step provider registry tests succeeded" << std::endl << std::endl;
+    }
+#endif
+
+
+    /***********************************************************
+     *                         SvgChart                        *
+     ***********************************************************/
+
+#if defined(test_svgchart)
+    TestSvgChart testSvgChart;
+
+    testSvgChart.add_test("render draws the elements with adjustments, targets and samples.", &TestSvgChart::render_drawsTheElements_withAdjustmentsTargetsAndSamples);
+    testSvgChart.add_test("render draws only the axes with empty data.", &TestSvgChart::render_drawsOnlyTheAxes_withEmptyData);
+    testSvgChart.add_test("render writes distinct y labels with small values.", &TestSvgChart::render_writesDistinctYLabels_withSmallValues);
+    testSvgChart.add_test("render draws the percentile bands with sample percentiles.", &TestSvgChart::render_drawsThePercentileBands_withSamplePercentiles);
+
+    res = testSvgChart.run(argc, argv);
+    if (res != 0) {
+        std::cout << "Svg chart tests failed" << std::endl << std::endl;
+        exit(1);
+    } else {
+        std::cout << "Svg chart tests succeeded" << std::endl << std::endl;
+    }
+#endif
+
+
+    /***********************************************************
+     *              XpertRequestResultXmlExport                *
+     ***********************************************************/
+
+#if defined(test_xpertrequestresultxmlexport)
+    TestXpertRequestResultXmlExport testXpertRequestResultXmlExport;
+
+    testXpertRequestResultXmlExport.add_test("makeXmlString produces valid xml with listed only candidates.", &TestXpertRequestResultXmlExport::makeXmlString_producesValidXml_withListedOnlyCandidates);
+
+    res = testXpertRequestResultXmlExport.run(argc, argv);
+    if (res != 0) {
+        std::cout << "Xpert request result xml export tests failed" << std::endl << std::endl;
+        exit(1);
+    } else {
+        std::cout << "Xpert request result xml export tests succeeded" << std::endl << std::endl;
+    }
+#endif
+
+
     return 0;
 }
@@ -20,15 +20,23 @@ include(../src/tuberxpert/tuberxpert.pri)
 SOURCES += \
         main.cpp \
         tests/test_adjustmenttraitcreator.cpp \
+        tests/test_adjustmenttraitview.cpp \
         tests/test_covariatevalidatorandmodelselector.cpp \
         tests/test_dosevalidator.cpp \
+        tests/test_flowstepcache.cpp \
         tests/test_languagemanager.cpp \
+        tests/test_pointdensity.cpp \
         tests/test_requestexecutor.cpp \
         tests/test_samplevalidator.cpp \
+        tests/test_svgchart.cpp \
         tests/test_targetvalidator.cpp \
+        tests/test_treatmentseriescache.cpp \
+        tests/test_unitconversioncache.cpp \
         tests/test_xpertqueryimport.cpp \
         tests/test_xpertqueryresultcreation.cpp \
         tests/test_xpertquerytocoreextractor.cpp \
+        tests/test_xpertflowstepproviderregistry.cpp \
+        tests/test_xpertrequestresultxmlexport.cpp \
         tests/test_xpertutils.cpp \
         testutils.cpp
 
@@ -42,28 +50,47 @@ SOURCES += \
 
 DEFINES+= \
     test_adjustmenttraitcreator \
+    test_adjustmenttraitview \
     test_covariatevalidatorandmodelselector \
     test_dosevalidator \
+    test_flowstepcache \
     test_xpertqueryresultcreation \
     test_languagemanager \
+    test_pointdensity \
     test_requestexecutor \
     test_samplevalidator \
+    test_svgchart \
     test_targetvalidator \
+    test_treatmentseriescache \
+    test_unitconversioncache \
     test_xpertqueryimport \
     test_xpertquerytocoreextractor \
+    test_xpertflowstepproviderregistry \
+    test_xpertrequestresultxmlexport \
     test_xpertutils \
 
+# The xml export tests read the example queries and validate against the response XSD.
+DEFINES += TUBERXPERT_XML_DIR=\\\"$$PWD/../xml\\\"
+
 HEADERS += \
     tests/test_adjustmenttraitcreator.h \
+    tests/test_adjustmenttraitview.h \
     tests/test_covariatevalidatorandmodelselector.h \
     tests/test_dosevalidator.h \
+    tests/test_flowstepcache.h \
     tests/test_xpertqueryresultcreation.h \
     tests/test_languagemanager.h \
+    tests/test_pointdensity.h \
     tests/test_requestexecutor.h \
     tests/test_samplevalidator.h \
+    tests/test_svgchart.h \
     tests/test_targetvalidator.h \
+    tests/test_treatmentseriescache.h \
+    tests/test_unitconversioncache.h \
     tests/test_xpertqueryimport.h \
     tests/test_xpertquerytocoreextractor.h \
+    tests/test_xpertflowstepproviderregistry.h \
+    tests/test_xpertrequestresultxmlexport.h \
     tests/test_xpertutils.h \
     testutils.h
 
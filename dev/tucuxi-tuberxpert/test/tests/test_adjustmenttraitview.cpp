@@ -0,0 +1,86 @@
+#include "test_adjustmenttraitview.h"
+
+using namespace std;
+using namespace Tucuxi;
+
+/// \brief Make the base adjustment trait of the tests.
+/// \return A shared a posteriori adjustment trait for all dosages.
+static shared_ptr<const Core::ComputingTraitAdjustment> makeBaseTrait()
+{
+    Core::ComputingOption computingOption{
+        Core::PredictionParameterType::Aposteriori,
+        Core::CompartmentsOption::AllActiveMoieties,
+        Core::RetrieveStatisticsOption::RetrieveStatistics,
+        Core::RetrieveParametersOption::RetrieveParameters,
+        Core::RetrieveCovariatesOption::RetrieveCovariates
+    };
+
+    return make_shared<const Core::ComputingTraitAdjustment>(
+                "",
+                Common::DateTime("2022-06-20T10:00:00", TestUtils::date_format),
+                Common::DateTime("2022-06-27T10:00:00", TestUtils::date_format),
+                20,
+                computingOption,
+                Common::DateTime("2022-06-21T08:00:00", TestUtils::date_format),
+                Core::BestCandidatesOption::BestDosagePerInterval,
+                Core::LoadingOption::LoadingDoseAllowed,
+                Core::RestPeriodOption::RestPeriodAllowed,
+                Core::SteadyStateTargetOption::AtSteadyState,
+                Core::TargetExtractionOption::DefinitionIfNoIndividualTarget,
+                Core::FormulationAndRouteSelectionOption::LastFormulationAndRoute);
+}
+
+void TestAdjustmentTraitView::materialize_returnsBaseTrait_withoutOverride(const string& _testName)
+{
+    cout << _testName << endl;
+
+    shared_ptr<const Core::ComputingTraitAdjustment> baseTrait = makeBaseTrait();
+    unique_ptr<Core::ComputingTraitAdjustment> trait = Xpert::AdjustmentTraitView(baseTrait).materialize();
+
+    fructose_assert_ne(trait.get(), baseTrait.get());
+    fructose_assert_eq(trait->getStart(), baseTrait->getStart());
+    fructose_assert_eq(trait->getEnd(), baseTrait->getEnd());
+    fructose_assert_eq(trait->getNbPointsPerHour(), baseTrait->getNbPointsPerHour());
+    fructose_assert_eq(trait->getAdjustmentTime(), baseTrait->getAdjustmentTime());
+    fructose_assert_eq(trait->getComputingOption().getParametersType() == Core::PredictionParameterType::Aposteriori, true);
+    fructose_assert_eq(trait->getBestCandidatesOption() == Core::BestCandidatesOption::BestDosagePerInterval, true);
+    fructose_assert_eq(trait->getLoadingOption() == Core::LoadingOption::LoadingDoseAllowed, true);
+    fructose_assert_eq(trait->getRestPeriodOption() == Core::RestPeriodOption::RestPeriodAllowed, true);
+}
+
+void TestAdjustmentTraitView::materialize_appliesOverrides_withOverrides(const string& _testName)
+{
+    cout << _testName << endl;
+
+    shared_ptr<const Core::ComputingTraitAdjustment> baseTrait = makeBaseTrait();
+    Common::DateTime newEnd("2022-07-04T10:00:00", TestUtils::date_format);
+
+    Xpert::AdjustmentTraitView view = Xpert::AdjustmentTraitView(baseTrait)
+            .withEnd(newEnd)
+            .withNbPointsPerHour(1)
+            .withParametersType(Core::PredictionParameterType::Population)
+            .withCandidatesOption(Core::BestCandidatesOption::BestDosage);
+    unique_ptr<Core::ComputingTraitAdjustment> trait = view.materialize();
+
+    // Overridden fields.
+    fructose_assert_eq(trait->getEnd(), newEnd);
+    fructose_assert_eq(trait->getNbPointsPerHour(), 1);
+    fructose_assert_eq(trait->getComputingOption().getParametersType() == Core::PredictionParameterType::Population, true);
+    fructose_assert_eq(trait->getBestCandidatesOption() == Core::BestCandidatesOption::BestDosage, true);
+
+    // Base fields.
+    fructose_assert_eq(trait->getStart(), baseTrait->getStart());
+    fructose_assert_eq(trait->getAdjustmentTime(), baseTrait->getAdjustmentTime());
+    fructose_assert_eq(trait->getComputingOption().getCompartmentsOption() == Core::CompartmentsOption::AllActiveMoieties, true);
+    fructose_assert_eq(trait->getLoadingOption() == Core::LoadingOption::LoadingDoseAllowed, true);
+    fructose_assert_eq(trait->getRestPeriodOption() == Core::RestPeriodOption::RestPeriodAllowed, true);
+    fructose_assert_eq(trait->getSteadyStateTargetOption() == Core::SteadyStateTargetOption::AtSteadyState, true);
+    fructose_assert_eq(trait->getTargetExtractionOption() == Core::TargetExtractionOption::DefinitionIfNoIndividualTarget, true);
+    fructose_assert_eq(trait->getFormulationAndRouteSelectionOption() == Core::FormulationAndRouteSelectionOption::LastFormulationAndRoute, true);
+
+    // The base trait is shared, not modified.
+    fructose_assert_eq(&view.getBaseTrait(), baseTrait.get());
+    fructose_assert_eq(baseTrait->getEnd(), Common::DateTime("2022-06-27T10:00:00", TestUtils::date_format));
+    fructose_assert_eq(baseTrait->getNbPointsPerHour(), 20);
+    fructose_assert_eq(baseTrait->getComputingOption().getParametersType() == Core::PredictionParameterType::Aposteriori, true);
+}
@@ -0,0 +1,26 @@
+#ifndef TEST_ADJUSTMENTTRAITVIEW_H
+#define TEST_ADJUSTMENTTRAITVIEW_H
+
+#include "testutils.h"
+
+#include "tuberxpert/utils/adjustmenttraitview.h"
+
+#include "fructose/fructose.h"
+
+/// \brief Tests for the AdjustmentTraitView.
+/// \date 19/10/2026
+/// \author Herzig Melvyn
+struct TestAdjustmentTraitView : public fructose::test_base<TestAdjustmentTraitView>
+{
+
+    /// \brief Materialize a view without override. The trait must be equal to the base trait.
+    /// \param _testName Name of the test.
+    void materialize_returnsBaseTrait_withoutOverride(const std::string& _testName);
+
+    /// \brief Materialize a view with all the overrides. The overridden fields must have the new values,
+    ///        the others the base values. The base trait must not change.
+    /// \param _testName Name of the test.
+    void materialize_appliesOverrides_withOverrides(const std::string& _testName);
+};
+
+#endif // TEST_ADJUSTMENTTRAITVIEW_H
@@ -11120,7 +11120,7 @@ void TestCovariateValidatorAndModelSelector::getCovariateValidationResults_retur
     fructose_assert_eq(xpertRequestResult.getErrorMessage(), "");
     fructose_assert_eq(xpertRequestResult.getDrugModel()->getDrugModelId() ,"ch.tucuxi.imatinib.gotta2012");
 
-    const vector<Xpert::CovariateValidationResult>& results = xpertRequestResult.getCovariateValidationResults();
+    const pmr::vector<Xpert::CovariateValidationResult>& results = xpertRequestResult.getCovariateValidationResults();
     fructose_assert_eq(results.size(), 5); // 3 covariates ( 2 weights + 1 birthdate) + Gist definition + Sex definition
 
     fructose_assert_eq(results[0].getSource()->getId(), "age");
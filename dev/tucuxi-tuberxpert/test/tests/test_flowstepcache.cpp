@@ -0,0 +1,133 @@
+#include "test_flowstepcache.h"
+
+#include <filesystem>
+
+using namespace std;
+using namespace Tucuxi;
+
+string TestFlowStepCache::getTestDirectory() const
+{
+    return (filesystem::temp_directory_path() / "tuberxpert_test_flowstepcache").string();
+}
+
+void TestFlowStepCache::key_dependsOnInputs_withDifferentInputs(const string& _testName)
+{
+    cout << _testName << endl;
+
+    Common::DateTime date("2022-06-20T10:00:00", TestUtils::date_format);
+
+    Xpert::FlowStepCacheKey key1("output");
+    key1.add("imatinib").add(1.5).add(date);
+
+    Xpert::FlowStepCacheKey key2("output");
+    key2.add("imatinib").add(1.5).add(date);
+
+    Xpert::FlowStepCacheKey key3("output");
+    key3.add("imatinib").add(1.5000001).add(date);
+
+    Xpert::FlowStepCacheKey key4("otherOutput");
+    key4.add("imatinib").add(1.5).add(date);
+
+    // The fields must not be confused when concatenated.
+    Xpert::FlowStepCacheKey key5("output");
+    key5.add("ab").add("c");
+
+    Xpert::FlowStepCacheKey key6("output");
+    key6.add("a").add("bc");
+
+    // Without intake series, the key cannot be used.
+    Xpert::FlowStepCacheKey key7("output");
+    key7.addIntakes(nullptr, date);
+
+    fructose_assert_eq(key1.isValid(), true);
+    fructose_assert_eq(key1.getContent(), key2.getContent());
+    fructose_assert_ne(key1.getContent(), key3.getContent());
+    fructose_assert_ne(key1.getContent(), key4.getContent());
+    fructose_assert_ne(key5.getContent(), key6.getContent());
+    fructose_assert_eq(key7.isValid(), false);
+}
+
+void TestFlowStepCache::key_dependsOnDrugModelContent_withSameIdentifier(const string& _testName)
+{
+    cout << _testName << endl;
+
+    Xpert::FlowStepCache& cache = Xpert::FlowStepCache::getInstance();
+
+    fructose_assert_eq(cache.registerDrugModel("<model><drugModelId> ch.tucuxi.test.content </drugModelId><a>1</a></model>"), true);
+    Xpert::FlowStepCacheKey key1("output");
+    key1.addDrugModel("ch.tucuxi.test.content");
+
+    // Same identifier, modified content.
+    fructose_assert_eq(cache.registerDrugModel("<model><drugModelId>ch.tucuxi.test.content</drugModelId><a>2</a></model>"), true);
+    Xpert::FlowStepCacheKey key2("output");
+    key2.addDrugModel("ch.tucuxi.test.content");
+
+    Xpert::FlowStepCacheKey key3("output");
+    key3.addDrugModel("ch.tucuxi.test.unknown");
+
+    fructose_assert_eq(key1.isValid(), true);
+    fructose_assert_eq(key2.isValid(), true);
+    fructose_assert_ne(key1.getContent(), key2.getContent());
+    fructose_assert_eq(key3.isValid(), false);
+
+    // A content without identifier is not registered.
+    fructose_assert_eq(cache.registerDrugModel("<model><a>1</a></model>"), false);
+}
+
+void TestFlowStepCache::find_returnsStoredOutput_afterReopeningTheDirectory(const string& _testName)
+{
+    cout << _testName << endl;
+
+    Xpert::FlowStepCache& cache = Xpert::FlowStepCache::getInstance();
+    fructose_assert_eq(cache.setDirectory(getTestDirectory()), true);
+    cache.clear();
+
+    Xpert::FlowStepCacheKey key("output");
+    key.add("imatinib");
+
+    Xpert::FlowStepCacheKey otherKey("output");
+    otherKey.add("busulfan");
+
+    string output;
+    fructose_assert_eq(cache.find(key, output), false);
+    fructose_assert_eq(cache.getNbMisses(), 1);
+
+    cache.insert(key, "ch.tucuxi.imatinib.gotta2012\nwith a second line");
+
+    // A new run opens the same directory.
+    cache.setDirectory("");
+    fructose_assert_eq(cache.setDirectory(getTestDirectory()), true);
+
+    fructose_assert_eq(cache.find(key, output), true);
+    fructose_assert_eq(output, "ch.tucuxi.imatinib.gotta2012\nwith a second line");
+    fructose_assert_eq(cache.find(otherKey, output), false);
+    fructose_assert_eq(cache.getNbHits(), 1);
+    fructose_assert_eq(cache.getNbMisses(), 2);
+
+    cache.clear();
+    fructose_assert_eq(cache.find(key, output), false);
+    fructose_assert_eq(cache.getNbHits(), 0);
+
+    cache.setDirectory("");
+    filesystem::remove_all(getTestDirectory());
+}
+
+void TestFlowStepCache::find_returnsNothing_whenDisabled(const string& _testName)
+{
+    cout << _testName << endl;
+
+    Xpert::FlowStepCache& cache = Xpert::FlowStepCache::getInstance();
+    cache.setDirectory("");
+    cache.clear();
+
+    Xpert::FlowStepCacheKey key("output");
+    key.add("imatinib");
+
+    cache.insert(key, "ch.tucuxi.imatinib.gotta2012");
+
+    string output;
+    fructose_assert_eq(cache.isEnabled(), false);
+    fructose_assert_eq(cache.find(key, output), false);
+    fructose_assert_eq(cache.getNbHits(), 0);
+    fructose_assert_eq(cache.getNbMisses(), 0);
+}
@@ -0,0 +1,41 @@
+#ifndef TEST_FLOWSTEPCACHE_H
+#define TEST_FLOWSTEPCACHE_H
+
+#include <string>
+
+#include "testutils.h"
+
+#include "tuberxpert/utils/flowstepcache.h"
+
+#include "fructose/fructose.h"
+
+/// \brief Tests for the FlowStepCache and its keys.
+/// \date 19/10/2026
+/// \author Herzig Melvyn
+struct TestFlowStepCache : public fructose::test_base<TestFlowStepCache>
+{
+    /// \brief Get a directory for the cache of the tests, in the temporary directory.
+    /// \return The path of the directory.
+    std::string getTestDirectory() const;
+
+    /// \brief Build keys from the same and from different inputs. The keys of the same inputs
+    ///        must be equal, the others must differ.
+    /// \param _testName Name of the test.
+    void key_dependsOnInputs_withDifferentInputs(const std::string& _testName);
+
+    /// \brief Register two contents for the same drug model identifier. The keys must differ and
+    ///        a key with an unregistered drug model must be invalid.
+    /// \param _testName Name of the test.
+    void key_dependsOnDrugModelContent_withSameIdentifier(const std::string& _testName);
+
+    /// \brief Store an output, disable the cache and enable it again on the same directory, as a
+    ///        new run would. The output must be found back and the hits and misses must be counted.
+    /// \param _testName Name of the test.
+    void find_returnsStoredOutput_afterReopeningTheDirectory(const std::string& _testName);
+
+    /// \brief Store outputs while the cache is disabled. Nothing must be stored nor found.
+    /// \param _testName Name of the test.
+    void find_returnsNothing_whenDisabled(const std::string& _testName);
+};
+
+#endif // TEST_FLOWSTEPCACHE_H
@@ -0,0 +1,132 @@
+#include "test_pointdensity.h"
+
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+
+using namespace std;
+using namespace Tucuxi;
+
+/// \brief Minimal query used to load the imatinib drug model in the XpertRequestResult.
+static const string s_imatinibQueryString = R"(<?xml version="1.0" encoding="UTF-8" standalone="no"?>
+                                    <query version="1.0"
+                                        xmlns:xsi="http://www.w3.org/2001/XMLSchema-instance"
+                                        xsi:noNamespaceSchemaLocation="tuberxpert_computing_query.xsd">
+
+                                        <date>2018-07-11T13:45:30</date> <!-- Date the xml has been sent -->
+
+                                        <drugTreatment>
+                                            <!-- All the information regarding the patient -->
+                                            <patient>
+                                                <covariates>
+                                                </covariates>
+                                            </patient>
+                                            <!-- List of the drugs informations we have concerning the patient -->
+                                            <drugs>
+                                                <!-- All the information regarding the drug -->
+                                                <drug>
+                                                    <drugId>imatinib</drugId>
+                                                    <activePrinciple>something</activePrinciple>
+                                                    <brandName>somebrand</brandName>
+                                                    <atc>something</atc>
+                                                    <!-- All the information regarding the treatment -->
+                                                    <treatment>
+                                                        <dosageHistory>
+                                                        </dosageHistory>
+                                                    </treatment>
+                                                    <!-- Samples history -->
+                                                    <samples>
+                                                    </samples>
+                                                    <!-- Personalised targets -->
+                                                    <targets>
+                                                    </targets>
+                                                </drug>
+                                            </drugs>
+                                        </drugTreatment>
+                                        <!-- List of the requests we want the server to take care of -->
+                                        <requests>
+                                            <xpertRequest>
+                                                <drugId>imatinib</drugId>
+                                                <output>
+                                                    <format>xml</format>
+                                                    <language>en</language>
+                                                </output>
+                                            </xpertRequest>
+                                        </requests>
+                                    </query>)";
+
+void TestPointDensity::getNbPointsPerHour_returnsTheValue_withFixedDensity(const string& _testName)
+{
+    cout << _testName << endl;
+
+    unique_ptr<Xpert::XpertQueryResult> xpertQueryResult;
+    TestUtils::setupEnv(s_imatinibQueryString, TestUtils::originalImatinibModelString, xpertQueryResult);
+    const Core::DrugModel& drugModel = *xpertQueryResult->getXpertRequestResults()[0].getDrugModel();
+
+    Xpert::PointDensity pointDensity(20);
+
+    fructose_assert_eq(pointDensity.getMode() == Xpert::PointDensityMode::FIXED, true);
+    fructose_assert_eq(pointDensity.getNbPointsPerHour(drugModel), 20);
+}
+
+void TestPointDensity::getNbPointsPerHour_followsHalfLife_withAdaptiveDensity(const string& _testName)
+{
+    cout << _testName << endl;
+
+    unique_ptr<Xpert::XpertQueryResult> xpertQueryResult;
+    TestUtils::setupEnv(s_imatinibQueryString, TestUtils::originalImatinibModelString, xpertQueryResult);
+    const Core::DrugModel& drugModel = *xpertQueryResult->getXpertRequestResults()[0].getDrugModel();
+
+    Xpert::PointDensity inRange(60, 1, 20);
+    Xpert::PointDensity overMax(600, 1, 20);
+    Xpert::PointDensity underMin(6, 2, 20);
+
+    fructose_assert_eq(inRange.getMode() == Xpert::PointDensityMode::ADAPTIVE, true);
+    fructose_assert(fabs(inRange.getNbPointsPerHour(drugModel) - 5) < 1e-9);
+    fructose_assert(fabs(overMax.getNbPointsPerHour(drugModel) - 20) < 1e-9);
+    fructose_assert(fabs(underMin.getNbPointsPerHour(drugModel) - 2) < 1e-9);
+}
+
+void TestPointDensity::getNbPointsPerHour_refinesSingleCycles_withPointsPerCycle(const string& _testName)
+{
+    cout << _testName << endl;
+
+    unique_ptr<Xpert::XpertQueryResult> xpertQueryResult;
+    TestUtils::setupEnv(s_imatinibQueryString, TestUtils::originalImatinibModelString, xpertQueryResult);
+    const Core::DrugModel& drugModel = *xpertQueryResult->getXpertRequestResults()[0].getDrugModel();
+
+    Xpert::PointDensity refined(60, 1, 20, 48);
+    Xpert::PointDensity notRefined(60, 1, 20);
+    Xpert::PointDensity fixed(20);
+
+    // The whole period density only depends on the half-life.
+    fructose_assert(fabs(refined.getNbPointsPerHour(drugModel) - 5) < 1e-9);
+
+    fructose_assert(fabs(refined.getNbPointsPerHour(drugModel, Common::Duration(chrono::hours(24))) - 5) < 1e-9);
+    fructose_assert(fabs(refined.getNbPointsPerHour(drugModel, Common::Duration(chrono::hours(4))) - 12) < 1e-9);
+    fructose_assert(fabs(refined.getNbPointsPerHour(drugModel, Common::Duration(chrono::hours(1))) - 20) < 1e-9);
+    fructose_assert(fabs(refined.getNbPointsPerHour(drugModel, Common::Duration()) - 5) < 1e-9);
+
+    fructose_assert(fabs(notRefined.getNbPointsPerHour(drugModel, Common::Duration(chrono::hours(1))) - 5) < 1e-9);
+    fructose_assert_eq(fixed.getNbPointsPerHour(drugModel, Common::Duration(chrono::hours(1))), 20);
+
+    // Only the refined density needs the cycle duration.
+    fructose_assert_eq(refined.dependsOnCycleDuration(), true);
+    fructose_assert_eq(notRefined.dependsOnCycleDuration(), false);
+    fructose_assert_eq(fixed.dependsOnCycleDuration(), false);
+}
+
+void TestPointDensity::constructor_throws_withInvalidValues(const string& _testName)
+{
+    cout << _testName << endl;
+
+    fructose_assert_exception(Xpert::PointDensity(0), invalid_argument);
+    fructose_assert_exception(Xpert::PointDensity(-20), invalid_argument);
+    fructose_assert_exception(Xpert::PointDensity(0, 1, 20), invalid_argument);
+    fructose_assert_exception(Xpert::PointDensity(60, 0, 20), invalid_argument);
+    fructose_assert_exception(Xpert::PointDensity(60, 20, 1), invalid_argument);
+    fructose_assert_exception(Xpert::PointDensity(60, 1, 20, -1), invalid_argument);
+
+    // The minimum may be equal to the maximum.
+    fructose_assert_no_exception(Xpert::PointDensity(60, 20, 20));
+}
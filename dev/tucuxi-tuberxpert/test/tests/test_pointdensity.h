@@ -0,0 +1,48 @@
+#ifndef TEST_POINTDENSITY_H
+#define TEST_POINTDENSITY_H
+
+#include "testutils.h"
+
+#include "tuberxpert/utils/pointdensity.h"
+
+#include "fructose/fructose.h"
+
+/// \brief Tests for the PointDensity.
+///        The tests use the imatinib drug model whose half-life is 12 hours.
+/// \date 19/10/2026
+/// \author Herzig Melvyn
+struct TestPointDensity : public fructose::test_base<TestPointDensity>
+{
+
+    /// \brief Get the number of points per hour of a fixed density. It must be the given one.
+    /// \param _testName Name of the test.
+    void getNbPointsPerHour_returnsTheValue_withFixedDensity(const std::string& _testName);
+
+    /// \brief Get the number of points per hour of adaptive densities:
+    ///        - 60 points per half-life, min 1 max 20 -> 5
+    ///        - 600 points per half-life, min 1 max 20 -> 20 (max)
+    ///        - 6 points per half-life, min 2 max 20 -> 2 (min)
+    /// \param _testName Name of the test.
+    void getNbPointsPerHour_followsHalfLife_withAdaptiveDensity(const std::string& _testName);
+
+    /// \brief Get the number of points per hour of single cycle traits with 60 points per half-life,
+    ///        min 1, max 20 and 48 points per cycle:
+    ///        - 24 hours cycle -> 5 (half-life density is higher)
+    ///        - 4 hours cycle -> 12
+    ///        - 1 hour cycle -> 20 (max)
+    ///        - empty cycle -> 5 (not refined)
+    ///        Without points per cycle or with a fixed density, the cycle does not change the density.
+    /// \param _testName Name of the test.
+    void getNbPointsPerHour_refinesSingleCycles_withPointsPerCycle(const std::string& _testName);
+
+    /// \brief Construct point densities with invalid values. An invalid_argument must be thrown for:
+    ///        - a fixed density that is not positive
+    ///        - a number of points per half-life that is not positive
+    ///        - a minimum that is not positive
+    ///        - a minimum greater than the maximum
+    ///        - a negative number of points per cycle
+    /// \param _testName Name of the test.
+    void constructor_throws_withInvalidValues(const std::string& _testName);
+};
+
+#endif // TEST_POINTDENSITY_H
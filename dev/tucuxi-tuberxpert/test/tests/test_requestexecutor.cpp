@@ -1,8 +1,19 @@
 #include "test_requestexecutor.h"
 
+#include <cmath>
+
 using namespace std;
 using namespace Tucuxi;
 
+/// \brief Tell whether two statistics are equal within a relative tolerance of 2%.
+/// \param _value Value to compare.
+/// \param _expected Expected value.
+/// \return True if the values are close, otherwise false.
+static bool areClose(double _value, double _expected)
+{
+    return abs(_value - _expected) <= 0.02 * abs(_expected);
+}
+
 void TestRequestExecutor::requestExecutor_failure_whenAdjustmentTraitNullptr(const string& _testName)
 {
     string queryString = R"(<?xml version="1.0" encoding="UTF-8" standalone="no"?>
@@ -216,7 +227,7 @@ void TestRequestExecutor::requestExecutor_failure_whenRequestExecutionFailed(con
                 baseTrait->getFormulationAndRouteSelectionOption()
                 );
 
-    xpertRequestResult.setAdjustmentTrait(*newInvalidTrait);
+    xpertRequestResult.setAdjustmentTrait(move(newInvalidTrait));
 
     TestUtils::flowStepProvider.getRequestExecutor()->perform(xpertRequestResult);
 
@@ -538,3 +549,203 @@ void TestRequestExecutor::requestExecutor_getsTypicalAprioriParameters_whenAprio
     fructose_assert_eq(xpertRequestResult.getParameters()[0].empty(), false);
     fructose_assert_eq(xpertRequestResult.getParameters()[0].size(), xpertRequestResult.getParameters()[1].size());;
 }
+
+void TestRequestExecutor::requestExecutor_limitsCandidates_withCandidatesLimits(const string& _testName)
+{
+
+    string queryString = R"(<?xml version="1.0" encoding="UTF-8" standalone="no"?>
+                                    <query version="1.0"
+                                        xmlns:xsi="http://www.w3.org/2001/XMLSchema-instance"
+                                        xsi:noNamespaceSchemaLocation="tuberxpert_computing_query.xsd">
+
+                                        <date>2018-07-07T13:00:00</date> <!-- Date the xml has been sent -->
+
+                                        <drugTreatment>
+                                            <!-- All the information regarding the patient -->
+                                            <patient>
+                                                <covariates>
+                                                </covariates>
+                                            </patient>
+                                            <!-- List of the drugs informations we have concerning the patient -->
+                                            <drugs>
+                                                <!-- All the information regarding the drug -->
+                                                <drug>
+                                                    <drugId>imatinib</drugId>
+                                                    <activePrinciple>something</activePrinciple>
+                                                    <brandName>somebrand</brandName>
+                                                    <atc>something</atc>
+                                                    <!-- All the information regarding the treatment -->
+                                                    <treatment>
+                                                        <dosageHistory>
+                                                        </dosageHistory>
+                                                    </treatment>
+                                                    <!-- Samples history -->
+                                                    <samples>
+                                                    </samples>
+                                                    <!-- Personalised targets -->
+                                                    <targets>
+                                                    </targets>
+                                                </drug>
+                                            </drugs>
+                                        </drugTreatment>
+                                        <!-- List of the requests we want the server to take care of -->
+                                        <requests>
+                                            <xpertRequest>
+                                                <drugId>imatinib</drugId>
+                                                <output>
+                                                    <format>xml</format>
+                                                    <language>en</language>
+                                                </output>
+                                            </xpertRequest>
+                                        </requests>
+                                    </query>)";
+
+    cout << _testName << endl;
+
+    // Prepare the XpertRequestResult
+    unique_ptr<Xpert::XpertQueryResult> xpertQueryResult;
+    TestUtils::setupEnv(queryString, TestUtils::originalImatinibModelString, xpertQueryResult);
+
+    Xpert::XpertRequestResult& xpertRequestResult = xpertQueryResult->getXpertRequestResults()[0];
+
+    // Execute with at most 2 candidates, only the best one with its curves
+    Xpert::RequestExecutor requestExecutor(Xpert::PointDensity(6), 2, 1);
+    TestUtils::flowStepProvider.getAdjustmentTraitCreator()->perform(xpertRequestResult);
+    requestExecutor.perform(xpertRequestResult);
+
+    // Compare
+    fructose_assert_eq(xpertRequestResult.shouldContinueProcessing(), true);
+
+    const vector<Core::DosageAdjustment>& adjustments = xpertRequestResult.getAdjustmentData()->getAdjustments();
+    fructose_assert_eq(adjustments.empty(), false);
+    fructose_assert_eq(adjustments.size() <= 2, true);
+    fructose_assert_eq(adjustments[0].getData().empty(), false);
+    if (adjustments.size() == 2) {
+        fructose_assert_eq(adjustments[1].getData().empty(), true);
+    }
+}
+
+void TestRequestExecutor::requestExecutor_computesSteadyStateStatistics_onOneCycleAtSteadyState(const string& _testName)
+{
+
+    string queryString = R"(<?xml version="1.0" encoding="UTF-8" standalone="no"?>
+                                    <query version="1.0"
+                                        xmlns:xsi="http://www.w3.org/2001/XMLSchema-instance"
+                                        xsi:noNamespaceSchemaLocation="tuberxpert_computing_query.xsd">
+
+                                        <date>2018-07-07T13:00:00</date> <!-- Date the xml has been sent -->
+
+                                        <drugTreatment>
+                                            <!-- All the information regarding the patient -->
+                                            <patient>
+                                                <covariates>
+                                                </covariates>
+                                            </patient>
+                                            <!-- List of the drugs informations we have concerning the patient -->
+                                            <drugs>
+                                                <!-- All the information regarding the drug -->
+                                                <drug>
+                                                    <drugId>imatinib</drugId>
+                                                    <activePrinciple>something</activePrinciple>
+                                                    <brandName>somebrand</brandName>
+                                                    <atc>something</atc>
+                                                    <!-- All the information regarding the treatment -->
+                                                    <treatment>
+                                                    </treatment>
+                                                    <!-- Samples history -->
+                                                    <samples>
+                                                    </samples>
+                                                    <!-- Personalised targets -->
+                                                    <targets>
+                                                    </targets>
+                                                </drug>
+                                            </drugs>
+                                        </drugTreatment>
+                                        <!-- List of the requests we want the server to take care of -->
+                                        <requests>
+                                            <xpertRequest>
+                                                <drugId>imatinib</drugId>
+                                                <output>
+                                                    <format>xml</format>
+                                                    <language>en</language>
+                                                </output>
+                                                <adjustmentDate>2018-07-06T08:00:00</adjustmentDate>
+                                                <options>
+                                                    <loadingOption>noLoadingDose</loadingOption>
+                                                    <restPeriodOption>noRestPeriod</restPeriodOption>
+                                                    <targetExtractionOption>populationValues</targetExtractionOption>
+                                                    <formulationAndRouteSelectionOption>allFormulationAndRoutes</formulationAndRouteSelectionOption>
+                                                </options>
+                                            </xpertRequest>
+                                        </requests>
+                                    </query>)";
+
+    cout << _testName << endl;
+
+    // Prepare the XpertRequestResult
+    unique_ptr<Xpert::XpertQueryResult> xpertQueryResult;
+    TestUtils::setupEnv(queryString, TestUtils::originalImatinibModelString, xpertQueryResult);
+
+    Xpert::XpertRequestResult& xpertRequestResult = xpertQueryResult->getXpertRequestResults()[0];
+
+    // Execute
+    TestUtils::flowStepProvider.getAdjustmentTraitCreator()->perform(xpertRequestResult);
+    TestUtils::flowStepProvider.getRequestExecutor()->perform(xpertRequestResult);
+
+    fructose_assert_eq(xpertRequestResult.shouldContinueProcessing(), true);
+
+    // The steady state is approximated at adjustment time + multiplier * half life.
+    const Core::HalfLife& halfLife = xpertRequestResult.getDrugModel()->getTimeConsiderations().getHalfLife();
+    double halfLifeInHours = Xpert::UnitConversionCache::getInstance().convert(halfLife.getValue(), halfLife.getUnit(), Common::TucuUnit("h"));
+    Common::DateTime adjustmentTime = xpertRequestResult.getAdjustmentTrait()->getAdjustmentTime();
+    Common::DateTime steadyStateTime = adjustmentTime + Common::Duration(chrono::hours(int(halfLife.getMultiplier() * halfLifeInHours)));
+
+    Common::DateTime residualDate;
+    Common::DateTime peakDate;
+    Common::DateTime auc24Date;
+    double residual = 0;
+    double peak = 0;
+    double auc24 = 0;
+
+    const Core::CycleStats& cycleStats = xpertRequestResult.getCycleStats();
+    fructose_assert_eq(cycleStats.getStatistic(0, Core::CycleStatisticType::Residual).getValue(residualDate, residual), true);
+    fructose_assert_eq(cycleStats.getStatistic(0, Core::CycleStatisticType::Peak).getValue(peakDate, peak), true);
+    fructose_assert_eq(cycleStats.getStatistic(0, Core::CycleStatisticType::AUC24).getValue(auc24Date, auc24), true);
+
+    fructose_assert_eq(residual > 0, true);
+    fructose_assert_eq(peak >= residual, true);
+    fructose_assert_eq(auc24 > 0, true);
+
+    // The statistics must be those of the last cycle of the adjustment extended up to the steady state time.
+    Xpert::RequestResult<Core::AdjustmentData> extendedResult = Xpert::executeRequest(Xpert::AdjustmentTraitView(xpertRequestResult.getAdjustmentTrait())
+                                                                                      .withEnd(steadyStateTime)
+                                                                                      .withNbPointsPerHour(20)
+                                                                                      .materialize(),
+                                                                                      xpertRequestResult);
+    fructose_assert_eq(extendedResult.isOk(), true);
+
+    const Core::CycleStats& extendedCycleStats = extendedResult.getData().getAdjustments().front().getData().back().m_statistics;
+
+    Common::DateTime extendedDate;
+    double extendedResidual = 0;
+    double extendedPeak = 0;
+    double extendedAuc24 = 0;
+
+    fructose_assert_eq(extendedCycleStats.getStatistic(0, Core::CycleStatisticType::Residual).getValue(extendedDate, extendedResidual), true);
+    fructose_assert_eq(extendedCycleStats.getStatistic(0, Core::CycleStatisticType::Peak).getValue(extendedDate, extendedPeak), true);
+    fructose_assert_eq(extendedCycleStats.getStatistic(0, Core::CycleStatisticType::AUC24).getValue(extendedDate, extendedAuc24), true);
+
+    // The point densities differ, the values must only be close.
+    fructose_assert_eq(areClose(residual, extendedResidual), true);
+    fructose_assert_eq(areClose(peak, extendedPeak), true);
+    fructose_assert_eq(areClose(auc24, extendedAuc24), true);
+
+    // Without loading dose, the drug accumulates: the residual at steady state is not below
+    // the residual of the first cycle of the best dosage.
+    const Core::DosageAdjustment& bestAdjustment = xpertRequestResult.getAdjustmentData()->getAdjustments().front();
+    Common::DateTime firstCycleDate;
+    double firstCycleResidual = 0;
+    bestAdjustment.m_data.front().m_statistics.getStatistic(0, Core::CycleStatisticType::Residual).getValue(firstCycleDate, firstCycleResidual);
+
+    fructose_assert_eq(residual >= firstCycleResidual, true);
+}
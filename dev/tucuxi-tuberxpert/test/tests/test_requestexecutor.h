@@ -2,7 +2,11 @@
 #define TEST_REQUESTEXECUTOR_H
 
 #include "tuberxpert/flow/general/generalxpertflowstepprovider.h"
+#include "tuberxpert/flow/general/requestexecutor.h"
 #include "tuberxpert/result/xpertqueryresult.h"
+#include "tuberxpert/utils/adjustmenttraitview.h"
+#include "tuberxpert/utils/unitconversioncache.h"
+#include "tuberxpert/utils/xpertutils.h"
 
 #include "testutils.h"
 
@@ -61,6 +65,21 @@ struct TestRequestExecutor : public fructose::test_base<TestRequestExecutor>
     ///        The method shouldContinueProcessing must return true.
     /// \param _testName Name of the test
     void requestExecutor_getsTypicalAprioriParameters_whenAprioriTrait(const std::string& _testName);
+
+    /// \brief This method checks that a RequestExecutor limited to 2 candidates, with the curves
+    ///        of the best one only, keeps at most 2 adjustments. The first adjustment must have
+    ///        its cycle data and the second one must not.
+    ///        The method shouldContinueProcessing must return true.
+    /// \param _testName Name of the test
+    void requestExecutor_limitsCandidates_withCandidatesLimits(const std::string& _testName);
+
+    /// \brief This method checks the statistics at steady state computed on the single cycle of the
+    ///        best dosage before adjustment time + multiplier * half life. The residual, peak and
+    ///        auc24 must be defined, consistent and close to those of the last cycle of the adjustment
+    ///        extended up to the steady state time. The residual must not be below the one of the first cycle.
+    ///        The method shouldContinueProcessing must return true.
+    /// \param _testName Name of the test
+    void requestExecutor_computesSteadyStateStatistics_onOneCycleAtSteadyState(const std::string& _testName);
 };
 
 #endif // TEST_REQUESTEXECUTOR_H
@@ -1,5 +1,7 @@
 #include "test_samplevalidator.h"
 
+#include <filesystem>
+
 using namespace std;
 using namespace Tucuxi;
 
@@ -473,7 +475,7 @@ void TestSampleValidator::getSampleValidationResult_isSorted_whenNotEmpty(const
     // Execute
     TestUtils::flowStepProvider.getSampleValidator()->perform(xpertRequestResult);
 
-    const vector<Xpert::SampleValidationResult>& sampleValidationResults = xpertRequestResult.getSampleValidationResults();
+    const pmr::vector<Xpert::SampleValidationResult>& sampleValidationResults = xpertRequestResult.getSampleValidationResults();
 
     // Compare
     fructose_assert_eq(sampleValidationResults.size(), xpertRequestResult.getTreatment()->getSamples().size());
@@ -482,3 +484,220 @@ void TestSampleValidator::getSampleValidationResult_isSorted_whenNotEmpty(const
             fructose_assert_eq(sampleValidationResults[1].getSource()->getDate(), Common::DateTime("2018-07-07T06:00:30", TestUtils::date_format))
             fructose_assert_eq(sampleValidationResults[2].getSource()->getDate(), Common::DateTime("2018-07-08T07:00:00", TestUtils::date_format))
 }
+
+void TestSampleValidator::keepSelectedRanks_keepsOnlySelectedRanks_withGivenPercentilesData(const string& _testName)
+{
+    cout << _testName << endl;
+
+    Core::PercentilesData percentilesData{""};
+    createPercentilesData(percentilesData);
+
+    // Prepare the SampleValidator with unsorted and invalid ranks.
+    Xpert::SampleValidator sampleValidator{Xpert::PointDensity(20), {95, 5, 50, 0, 100, 2.5}};
+
+    // Execute
+    Xpert::SamplePercentiles samplePercentiles = sampleValidator.keepSelectedRanks(percentilesData);
+
+    // Compare the ranks
+    fructose_assert_eq(samplePercentiles.getRanks().size(), 3);
+    fructose_assert_eq(samplePercentiles.getRanks()[0], 5);
+    fructose_assert_eq(samplePercentiles.getRanks()[1], 50);
+    fructose_assert_eq(samplePercentiles.getRanks()[2], 95);
+
+    // Compare the values, the first value of the percentile p is p * 10.
+    fructose_assert_eq(samplePercentiles.getPercentileData(0).size(), 2);
+    fructose_assert_eq(samplePercentiles.getPercentileData(0)[0].m_concentrations[0][0], 50);
+    fructose_assert_eq(samplePercentiles.getPercentileData(1)[1].m_concentrations[0][2], 502);
+    fructose_assert_eq(samplePercentiles.getPercentileData(2)[0].m_concentrations[0][0], 950);
+
+    // Find by rank
+    fructose_assert_ne(samplePercentiles.findPercentileData(95), nullptr);
+    fructose_assert_eq(samplePercentiles.findPercentileData(25), nullptr);
+}
+
+void TestSampleValidator::readClassification_readsBackWrittenClassification(const string& _testName)
+{
+    cout << _testName << endl;
+
+    Core::PercentilesData percentilesData{""};
+    createPercentilesData(percentilesData);
+
+    Xpert::SampleValidator sampleValidator{Xpert::PointDensity(20), {5, 50, 95}};
+    Xpert::SamplePercentiles samplePercentiles = sampleValidator.keepSelectedRanks(percentilesData);
+
+    // Execute
+    string classification = sampleValidator.writeClassification(42, samplePercentiles);
+
+    unsigned group = 0;
+    unique_ptr<Xpert::SamplePercentiles> readPercentiles;
+    bool isRead = sampleValidator.readClassification(classification, group, readPercentiles);
+
+    // Compare
+    fructose_assert_eq(isRead, true);
+    fructose_assert_eq(group, 42);
+    fructose_assert(readPercentiles != nullptr);
+    fructose_assert_eq(readPercentiles->getRanks().size(), 3);
+    fructose_assert_eq(readPercentiles->getRanks()[2], 95);
+
+    for (size_t rankIndex = 0; rankIndex < 3; ++rankIndex) {
+        const vector<Core::CycleData>& expectedCycles = samplePercentiles.getPercentileData(rankIndex);
+        const vector<Core::CycleData>& readCycles = readPercentiles->getPercentileData(rankIndex);
+        fructose_assert_eq(readCycles.size(), expectedCycles.size());
+
+        for (size_t cycleIndex = 0; cycleIndex < readCycles.size(); ++cycleIndex) {
+            fructose_assert_eq(readCycles[cycleIndex].m_start, expectedCycles[cycleIndex].m_start);
+            fructose_assert_eq(readCycles[cycleIndex].m_end, expectedCycles[cycleIndex].m_end);
+            fructose_assert_eq(readCycles[cycleIndex].m_unit.toString(), unit.toString());
+            fructose_assert(readCycles[cycleIndex].m_times[0] == expectedCycles[cycleIndex].m_times[0]);
+            fructose_assert(readCycles[cycleIndex].m_concentrations[0] == expectedCycles[cycleIndex].m_concentrations[0]);
+        }
+    }
+
+    // A truncated classification is not read.
+    fructose_assert_eq(sampleValidator.readClassification(classification.substr(0, classification.size() / 2), group, readPercentiles), false);
+}
+
+void TestSampleValidator::sampleValidator_reusesClassifications_whenQueryResubmitted(const string& _testName)
+{
+
+    string queryString = R"(<?xml version="1.0" encoding="UTF-8" standalone="no"?>
+                                    <query version="1.0"
+                                        xmlns:xsi="http://www.w3.org/2001/XMLSchema-instance"
+                                        xsi:noNamespaceSchemaLocation="tuberxpert_computing_query.xsd">
+
+                                        <date>2018-07-11T13:45:30</date> <!-- Date the xml has been sent -->
+
+                                        <drugTreatment>
+                                            <!-- All the information regarding the patient -->
+                                            <patient>
+                                                <covariates>
+                                                </covariates>
+                                            </patient>
+                                            <!-- List of the drugs informations we have concerning the patient -->
+                                            <drugs>
+                                                <!-- All the information regarding the drug -->
+                                                <drug>
+                                                    <drugId>imatinib</drugId>
+                                                    <activePrinciple>something</activePrinciple>
+                                                    <brandName>somebrand</brandName>
+                                                    <atc>something</atc>
+                                                    <!-- All the information regarding the treatment -->
+                                                    <treatment>
+                                                        <dosageHistory>
+                                                            <dosageTimeRange>
+                                                                <start>2018-07-06T08:00:00</start>
+                                                                <end>2018-07-08T08:00:00</end>
+                                                                <dosage>
+                                                                    <dosageLoop>
+                                                                        <lastingDosage>
+                                                                            <interval>12:00:00</interval>
+                                                                            <dose>
+                                                                                <value>400</value>
+                                                                                <unit>mg</unit>
+                                                                                <infusionTimeInMinutes>60</infusionTimeInMinutes>
+                                                                            </dose>
+                                                                            <formulationAndRoute>
+                                                                                <formulation>parenteralSolution</formulation>
+                                                                                <administrationName>foo bar</administrationName>
+                                                                                <administrationRoute>oral</administrationRoute>
+                                                                                <absorptionModel>extravascular</absorptionModel>
+                                                                            </formulationAndRoute>
+                                                                        </lastingDosage>
+                                                                    </dosageLoop>
+                                                                </dosage>
+                                                            </dosageTimeRange>
+                                                        </dosageHistory>
+                                                    </treatment>
+                                                    <!-- Samples history -->
+                                                    <samples>
+                                                        <sample>
+                                                            <sampleId>123456</sampleId>
+                                                            <sampleDate>2018-07-07T06:00:30</sampleDate>
+                                                            <concentrations>
+                                                                <concentration>
+                                                                    <analyteId>imatinib</analyteId>
+                                                                    <value>0.7</value>
+                                                                    <unit>mg/l</unit>
+                                                                </concentration>
+                                                            </concentrations>
+                                                        </sample>
+                                                        <sample>
+                                                            <sampleId>123456</sampleId>
+                                                            <sampleDate>2018-07-06T13:00:00</sampleDate>
+                                                            <concentrations>
+                                                                <concentration>
+                                                                    <analyteId>imatinib</analyteId>
+                                                                    <value>0.8</value>
+                                                                    <unit>mg/l</unit>
+                                                                </concentration>
+                                                            </concentrations>
+                                                        </sample>
+                                                    </samples>
+                                                    <!-- Personalised targets -->
+                                                    <targets>
+                                                    </targets>
+                                                </drug>
+                                            </drugs>
+                                        </drugTreatment>
+                                        <!-- List of the requests we want the server to take care of -->
+                                        <requests>
+                                            <xpertRequest>
+                                                <drugId>imatinib</drugId>
+                                                <output>
+                                                    <format>xml</format>
+                                                    <language>en</language>
+                                                </output>
+                                            </xpertRequest>
+                                        </requests>
+                                    </query>)";
+
+
+    cout << _testName << endl;
+
+    // Enable the cache in an empty directory.
+    string cacheDirectory = (filesystem::temp_directory_path() / "tuberxpert_test_samplevalidator").string();
+    Xpert::FlowStepCache& cache = Xpert::FlowStepCache::getInstance();
+    fructose_assert_eq(cache.setDirectory(cacheDirectory), true);
+    cache.clear();
+
+    // First run.
+    unique_ptr<Xpert::XpertQueryResult> firstQueryResult;
+    TestUtils::setupEnv(queryString, TestUtils::originalImatinibModelString, firstQueryResult);
+    Xpert::XpertRequestResult& firstRequestResult = firstQueryResult->getXpertRequestResults()[0];
+    TestUtils::flowStepProvider.getSampleValidator()->perform(firstRequestResult);
+
+    fructose_assert_eq(firstRequestResult.shouldContinueProcessing(), true);
+    fructose_assert_eq(cache.getNbHits(), 0);
+    fructose_assert_eq(cache.getNbMisses(), 2);
+
+    // Second run of the same query.
+    unique_ptr<Xpert::XpertQueryResult> secondQueryResult;
+    TestUtils::setupEnv(queryString, TestUtils::originalImatinibModelString, secondQueryResult);
+    Xpert::XpertRequestResult& secondRequestResult = secondQueryResult->getXpertRequestResults()[0];
+    TestUtils::flowStepProvider.getSampleValidator()->perform(secondRequestResult);
+
+    fructose_assert_eq(secondRequestResult.shouldContinueProcessing(), true);
+    fructose_assert_eq(cache.getNbHits(), 2);
+    fructose_assert_eq(cache.getNbMisses(), 2);
+
+    // Compare the results of both runs.
+    const pmr::vector<Xpert::SampleValidationResult>& firstResults = firstRequestResult.getSampleValidationResults();
+    const pmr::vector<Xpert::SampleValidationResult>& secondResults = secondRequestResult.getSampleValidationResults();
+    fructose_assert_eq(secondResults.size(), firstResults.size());
+
+    for (size_t i = 0; i < firstResults.size(); ++i) {
+        fructose_assert_eq(secondResults[i].getSource()->getDate(), firstResults[i].getSource()->getDate());
+        fructose_assert_eq(secondResults[i].getGroupNumberOver99Percentile(), firstResults[i].getGroupNumberOver99Percentile());
+
+        const Xpert::SamplePercentiles& firstPercentiles = firstRequestResult.getSamplePercentiles().at(firstResults[i].getSource());
+        const Xpert::SamplePercentiles& secondPercentiles = secondRequestResult.getSamplePercentiles().at(secondResults[i].getSource());
+        fructose_assert(secondPercentiles.getRanks() == firstPercentiles.getRanks());
+        fructose_assert_eq(secondPercentiles.getPercentileData(0).size(), firstPercentiles.getPercentileData(0).size());
+        fructose_assert(secondPercentiles.getPercentileData(0)[0].m_concentrations[0] ==
+                        firstPercentiles.getPercentileData(0)[0].m_concentrations[0]);
+    }
+
+    cache.clear();
+    cache.setDirectory("");
+    filesystem::remove_all(cacheDirectory);
+}
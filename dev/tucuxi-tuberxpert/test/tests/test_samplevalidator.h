@@ -13,6 +13,8 @@
 #include "tuberxpert/flow/general/samplevalidator.h"
 #include "tuberxpert/result/xpertqueryresult.h"
 #include "tuberxpert/result/samplevalidationresult.h"
+#include "tuberxpert/result/samplepercentiles.h"
+#include "tuberxpert/utils/flowstepcache.h"
 
 #include "testutils.h"
 
@@ -93,6 +95,25 @@ struct TestSampleValidator : public fructose::test_base<TestSampleValidator>
     ///        The smallest date comes first.
     /// \param _testName Name of the test
     void getSampleValidationResult_isSorted_whenNotEmpty(const std::string& _testName);
+
+    /// \brief This method checks that SampleValidator::keepSelectedRanks only keeps the percentiles
+    ///        of the selected ranks, in ascending order, and ignores the ranks that are not integers
+    ///        between 1 and 99. The SampleValidator is created with the ranks 95, 5, 50, 0, 100 and 2.5.
+    ///        Only the percentiles 5, 50 and 95 must be kept, with the values of the percentiles data.
+    /// \param _testName Name of the test
+    void keepSelectedRanks_keepsOnlySelectedRanks_withGivenPercentilesData(const std::string& _testName);
+
+    /// \brief This method checks that a classification written by SampleValidator::writeClassification
+    ///        is read back by SampleValidator::readClassification with the same group, ranks, cycles and values,
+    ///        and that a truncated classification is rejected.
+    /// \param _testName Name of the test
+    void readClassification_readsBackWrittenClassification(const std::string& _testName);
+
+    /// \brief This method performs a real sample validation twice with the FlowStepCache enabled, as two runs
+    ///        of the same query would. The first run must store the classifications, the second one must find them
+    ///        and get the same groups and percentiles.
+    /// \param _testName Name of the test
+    void sampleValidator_reusesClassifications_whenQueryResubmitted(const std::string& _testName);
 };
 
 #endif // TEST_SAMPLEVALIDATOR_H
@@ -0,0 +1,125 @@
+#include "test_svgchart.h"
+
+#include <cmath>
+
+using namespace std;
+using namespace Tucuxi;
+
+/// \brief Count the occurrences of a text in another one.
+/// \param _text Text where to search.
+/// \param _pattern Text to count.
+/// \return The number of occurrences.
+static size_t countOccurrences(const string& _text, const string& _pattern)
+{
+    size_t count = 0;
+    for (size_t pos = _text.find(_pattern); pos != string::npos; pos = _text.find(_pattern, pos + _pattern.size())) {
+        ++count;
+    }
+    return count;
+}
+
+void TestSvgChart::render_drawsTheElements_withAdjustmentsTargetsAndSamples(const string& _testName)
+{
+    cout << _testName << endl;
+
+    Xpert::GraphData graphData;
+    graphData.m_start = -24;
+    graphData.m_end = 72;
+    graphData.m_unit = "mg<l";
+
+    for (unsigned adjustment = 0; adjustment < 3; ++adjustment) {
+        Xpert::GraphData::Curve curve;
+        for (unsigned i = 0; i <= 72 * 10; ++i) {
+            curve.m_times.push_back(i / 10.0);
+            curve.m_values.push_back((adjustment + 1) * (1.5 + sin(i / 10.0)));
+        }
+        graphData.m_adjustments.push_back(curve);
+    }
+
+    graphData.m_targets.push_back({"residual", 0.75, 1, 1.5});
+    graphData.m_targets.push_back({"auc", 10, 20, 30});
+
+    graphData.m_samples.push_back({-20, 1.2});
+    graphData.m_samples.push_back({-8, 0.9});
+
+    Xpert::SvgChart chart;
+
+    string allAdjustments = chart.render(graphData, true);
+    fructose_assert_eq(allAdjustments.rfind("<svg", 0), 0);
+    fructose_assert_eq(allAdjustments.substr(allAdjustments.size() - 6), "</svg>");
+    fructose_assert_eq(countOccurrences(allAdjustments, "<polyline"), 3);
+    fructose_assert_eq(countOccurrences(allAdjustments, "fill-opacity"), 1);
+    fructose_assert_eq(countOccurrences(allAdjustments, "<circle"), 2);
+    fructose_assert_ne(allAdjustments.find("mg&lt;l"), string::npos);
+
+    string bestAdjustment = chart.render(graphData, false);
+    fructose_assert_eq(countOccurrences(bestAdjustment, "<polyline"), 1);
+    fructose_assert_eq(countOccurrences(bestAdjustment, "<circle"), 2);
+
+    // The two graphs can be in the same page.
+    fructose_assert_ne(allAdjustments.find("clipAllAdj"), string::npos);
+    fructose_assert_ne(bestAdjustment.find("clipBestAdj"), string::npos);
+}
+
+void TestSvgChart::render_drawsOnlyTheAxes_withEmptyData(const string& _testName)
+{
+    cout << _testName << endl;
+
+    Xpert::GraphData graphData;
+
+    string svg = Xpert::SvgChart().render(graphData, true);
+    fructose_assert_eq(svg.rfind("<svg", 0), 0);
+    fructose_assert_eq(svg.substr(svg.size() - 6), "</svg>");
+    fructose_assert_eq(countOccurrences(svg, "<polyline"), 0);
+    fructose_assert_eq(countOccurrences(svg, "<circle"), 0);
+}
+
+void TestSvgChart::render_writesDistinctYLabels_withSmallValues(const string& _testName)
+{
+    cout << _testName << endl;
+
+    Xpert::GraphData graphData;
+    graphData.m_start = 0;
+    graphData.m_end = 24;
+
+    Xpert::GraphData::Curve curve;
+    for (unsigned i = 0; i <= 24; ++i) {
+        curve.m_times.push_back(i);
+        curve.m_values.push_back(0.0004 * i / 24.0);
+    }
+    graphData.m_adjustments.push_back(curve);
+
+    string svg = Xpert::SvgChart().render(graphData, true);
+    fructose_assert_ne(svg.find("'>0.0001</text>"), string::npos);
+    fructose_assert_ne(svg.find("'>0.0004</text>"), string::npos);
+}
+
+void TestSvgChart::render_drawsThePercentileBands_withSamplePercentiles(const string& _testName)
+{
+    cout << _testName << endl;
+
+    Xpert::GraphData graphData;
+    graphData.m_start = -24;
+    graphData.m_end = 24;
+
+    Xpert::GraphData::Band outerBand;
+    Xpert::GraphData::Band innerBand;
+    for (unsigned i = 0; i <= 12; ++i) {
+        outerBand.m_times.push_back(-24.0 + i);
+        outerBand.m_lows.push_back(0.5);
+        outerBand.m_highs.push_back(3);
+        innerBand.m_times.push_back(-24.0 + i);
+        innerBand.m_lows.push_back(1);
+        innerBand.m_highs.push_back(2);
+    }
+    graphData.m_percentileBands.push_back(outerBand);
+    graphData.m_percentileBands.push_back(innerBand);
+    graphData.m_samples.push_back({-18, 1.5});
+
+    string svg = Xpert::SvgChart().render(graphData, true);
+    fructose_assert_eq(countOccurrences(svg, "<polygon"), 2);
+    fructose_assert_eq(countOccurrences(svg, "<circle"), 1);
+
+    // The bands are drawn behind the samples.
+    fructose_assert(svg.rfind("<polygon") < svg.find("<circle"));
+}
@@ -0,0 +1,37 @@
+#ifndef TEST_SVGCHART_H
+#define TEST_SVGCHART_H
+
+#include "tuberxpert/exporter/svgchart.h"
+
+#include "fructose/fructose.h"
+
+/// \brief Tests for the SvgChart.
+/// \date 19/10/2026
+/// \author Herzig Melvyn
+struct TestSvgChart : public fructose::test_base<TestSvgChart>
+{
+
+    /// \brief Render graph data with three adjustments, a residual and an auc target and two samples.
+    ///        - With all the adjustments, three polylines must be drawn.
+    ///        - With the best adjustment only, one polyline must be drawn.
+    ///        - Only the residual target is drawn (one band), the auc is not a concentration.
+    ///        - The two samples are drawn.
+    ///        - The unit is written and escaped.
+    /// \param _testName Name of the test.
+    void render_drawsTheElements_withAdjustmentsTargetsAndSamples(const std::string& _testName);
+
+    /// \brief Render empty graph data. The svg must be complete and contain no curve nor sample.
+    /// \param _testName Name of the test.
+    void render_drawsOnlyTheAxes_withEmptyData(const std::string& _testName);
+
+    /// \brief Render a curve whose values are below 0.001. The y tick labels must keep enough
+    ///        decimals to be distinct.
+    /// \param _testName Name of the test.
+    void render_writesDistinctYLabels_withSmallValues(const std::string& _testName);
+
+    /// \brief Render two percentile bands around a sample. Both bands must be drawn behind the sample.
+    /// \param _testName Name of the test.
+    void render_drawsThePercentileBands_withSamplePercentiles(const std::string& _testName);
+};
+
+#endif // TEST_SVGCHART_H
@@ -0,0 +1,143 @@
+#include "test_treatmentseriescache.h"
+
+using namespace std;
+using namespace Tucuxi;
+
+void TestTreatmentSeriesCache::getIntakes_returnsSameSeries_withSameUnitAndWindow(const string& _testName)
+{
+
+    string queryString = R"(<?xml version="1.0" encoding="UTF-8" standalone="no"?>
+                                    <query version="1.0"
+                                        xmlns:xsi="http://www.w3.org/2001/XMLSchema-instance"
+                                        xsi:noNamespaceSchemaLocation="tuberxpert_computing_query.xsd">
+
+                                        <date>2022-06-20T10:00:00</date> <!-- Date the xml has been sent -->
+
+                                        <drugTreatment>
+                                            <!-- All the information regarding the patient -->
+                                            <patient>
+                                                <covariates>
+                                                </covariates>
+                                            </patient>
+                                            <!-- List of the drugs informations we have concerning the patient -->
+                                            <drugs>
+                                                <!-- All the information regarding the drug -->
+                                                <drug>
+                                                    <drugId>imatinib</drugId>
+                                                    <activePrinciple>something</activePrinciple>
+                                                    <brandName>somebrand</brandName>
+                                                    <atc>something</atc>
+                                                    <!-- All the information regarding the treatment -->
+                                                    <treatment>
+                                                        <dosageHistory>
+                                                            <dosageTimeRange>
+                                                                <start>2018-07-06T08:00:00</start>
+                                                                <end>2018-07-08T08:00:00</end>
+                                                                <dosage>
+                                                                    <dosageLoop>
+                                                                        <lastingDosage>
+                                                                            <interval>12:00:00</interval>
+                                                                            <dose>
+                                                                                <value>400</value>
+                                                                                <unit>mg</unit>
+                                                                                <infusionTimeInMinutes>60</infusionTimeInMinutes>
+                                                                            </dose>
+                                                                            <formulationAndRoute>
+                                                                                <formulation>parenteralSolution</formulation>
+                                                                                <administrationName>foo bar</administrationName>
+                                                                                <administrationRoute>oral</administrationRoute>
+                                                                                <absorptionModel>extravascular</absorptionModel>
+                                                                            </formulationAndRoute>
+                                                                        </lastingDosage>
+                                                                    </dosageLoop>
+                                                                </dosage>
+                                                            </dosageTimeRange>
+                                                        </dosageHistory>
+                                                    </treatment>
+                                                    <!-- Samples history -->
+                                                    <samples>
+                                                    </samples>
+                                                    <!-- Personalised targets -->
+                                                    <targets>
+                                                    </targets>
+                                                </drug>
+                                            </drugs>
+                                        </drugTreatment>
+                                        <!-- List of the requests we want the server to take care of -->
+                                        <requests>
+                                            <xpertRequest>
+                                                <drugId>imatinib</drugId>
+                                                <output>
+                                                    <format>xml</format>
+                                                    <language>en</language>
+                                                </output>
+                                            </xpertRequest>
+                                        </requests>
+                                    </query>)";
+
+    cout << _testName << endl;
+
+    // Prepare the XpertRequestResult
+    unique_ptr<Xpert::XpertQueryResult> xpertQueryResult;
+    TestUtils::setupEnv(queryString, TestUtils::originalImatinibModelString, xpertQueryResult);
+
+    const Xpert::TreatmentSeriesCache& seriesCache = xpertQueryResult->getXpertRequestResults()[0].getSeriesCache();
+
+    Common::DateTime start("2018-07-06T08:00:00", TestUtils::date_format);
+    Common::DateTime secondDayStart("2018-07-07T08:00:00", TestUtils::date_format);
+    Common::DateTime lastIntakeTime("2018-07-07T20:00:00", TestUtils::date_format);
+    Common::DateTime undefinedEnd = Common::DateTime::undefinedDateTime();
+
+    // Execute
+    const Core::IntakeSeries* intakes = seriesCache.getIntakes(Common::TucuUnit("mg"), start, undefinedEnd);
+    const Core::IntakeSeries* sameIntakes = seriesCache.getIntakes(Common::TucuUnit("mg"), start, undefinedEnd);
+    const Core::IntakeSeries* otherUnitIntakes = seriesCache.getIntakes(Common::TucuUnit("g"), start, undefinedEnd);
+    const Core::IntakeSeries* otherWindowIntakes = seriesCache.getIntakes(Common::TucuUnit("mg"), secondDayStart, undefinedEnd);
+
+    // Compare, the whole dosage history is extracted.
+    fructose_assert_ne(intakes, nullptr);
+    fructose_assert_eq(intakes->size(), 4);
+    fructose_assert_eq(intakes->front().getEventTime(), start);
+    fructose_assert_eq(intakes->back().getEventTime(), lastIntakeTime);
+    fructose_assert_double_eq(intakes->front().getDose(), 400);
+
+    // The same unit and window share the extraction.
+    fructose_assert_eq(sameIntakes, intakes);
+
+    fructose_assert_ne(otherUnitIntakes, nullptr);
+    fructose_assert_ne(otherUnitIntakes, intakes);
+    fructose_assert_eq(otherUnitIntakes->size(), 4);
+    fructose_assert_double_eq(otherUnitIntakes->front().getDose(), 0.4);
+
+    // Another window gets its own extraction.
+    fructose_assert_ne(otherWindowIntakes, nullptr);
+    fructose_assert_ne(otherWindowIntakes, intakes);
+    fructose_assert_eq(otherWindowIntakes->size(), 2);
+    fructose_assert_eq(otherWindowIntakes->front().getEventTime(), secondDayStart);
+}
+
+void TestTreatmentSeriesCache::getIntakes_returnsNoIntake_withoutDosage(const string& _testName)
+{
+    cout << _testName << endl;
+
+    Common::DateTime start("2018-07-06T08:00:00", TestUtils::date_format);
+    Common::DateTime undefinedEnd = Common::DateTime::undefinedDateTime();
+
+    // Without treatment.
+    Xpert::TreatmentSeriesCache noTreatmentCache(nullptr);
+    fructose_assert_eq(noTreatmentCache.getIntakes(Common::TucuUnit("mg"), start, undefinedEnd), nullptr);
+
+    // Without dosage time range.
+    Core::DrugTreatment drugTreatment;
+    Xpert::TreatmentSeriesCache seriesCache(&drugTreatment);
+    const Core::IntakeSeries* intakes = seriesCache.getIntakes(Common::TucuUnit("mg"), start, undefinedEnd);
+
+    fructose_assert_ne(intakes, nullptr);
+    fructose_assert_eq(intakes->empty(), true);
+
+    // Without start.
+    const Core::IntakeSeries* noStartIntakes = seriesCache.getIntakes(Common::TucuUnit("mg"), Common::DateTime::undefinedDateTime(), undefinedEnd);
+
+    fructose_assert_ne(noStartIntakes, nullptr);
+    fructose_assert_eq(noStartIntakes->empty(), true);
+}
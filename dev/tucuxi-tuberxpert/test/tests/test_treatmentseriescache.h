@@ -0,0 +1,27 @@
+#ifndef TEST_TREATMENTSERIESCACHE_H
+#define TEST_TREATMENTSERIESCACHE_H
+
+#include "testutils.h"
+
+#include "tuberxpert/utils/treatmentseriescache.h"
+
+#include "fructose/fructose.h"
+
+/// \brief Tests for the TreatmentSeriesCache.
+/// \date 19/10/2026
+/// \author Herzig Melvyn
+struct TestTreatmentSeriesCache : public fructose::test_base<TestTreatmentSeriesCache>
+{
+
+    /// \brief Get the intakes of a unit and a window twice. They must be extracted once and shared,
+    ///        another unit or another window must get another series.
+    /// \param _testName Name of the test.
+    void getIntakes_returnsSameSeries_withSameUnitAndWindow(const std::string& _testName);
+
+    /// \brief Get the intakes without treatment, without dosage time range or without start.
+    ///        There must be no series, respectively an empty series.
+    /// \param _testName Name of the test.
+    void getIntakes_returnsNoIntake_withoutDosage(const std::string& _testName);
+};
+
+#endif // TEST_TREATMENTSERIESCACHE_H
@@ -0,0 +1,79 @@
+#include "test_unitconversioncache.h"
+
+#include <cmath>
+
+#include "tucucommon/unit.h"
+
+using namespace std;
+using namespace Tucuxi;
+
+void TestUnitConversionCache::convert_givesSameValuesAsUnitManager(const string& _testName)
+{
+    cout << _testName << endl;
+
+    Xpert::UnitConversionCache& cache = Xpert::UnitConversionCache::getInstance();
+    cache.clear();
+
+    fructose_assert(fabs(cache.convert(1500, Common::TucuUnit("mg"), Common::TucuUnit("g")) -
+                         Common::UnitManager::convertToUnit(1500, Common::TucuUnit("mg"), Common::TucuUnit("g"))) < 1e-9);
+    fructose_assert(fabs(cache.convert(1500, Common::TucuUnit("mg"), Common::TucuUnit("g")) - 1.5) < 1e-9);
+    fructose_assert(fabs(cache.convert(2, Common::TucuUnit("d"), Common::TucuUnit("h")) - 48) < 1e-9);
+    fructose_assert(fabs(cache.convert(3, Common::TucuUnit("mg/l"), Common::TucuUnit("ug/l")) - 3000) < 1e-9);
+}
+
+void TestUnitConversionCache::convert_reusesFactor_withSamePairOfUnits(const string& _testName)
+{
+    cout << _testName << endl;
+
+    Xpert::UnitConversionCache& cache = Xpert::UnitConversionCache::getInstance();
+    cache.clear();
+
+    cache.convert(10, Common::TucuUnit("kg"), Common::TucuUnit("g"));
+    fructose_assert_eq(cache.getNbMisses(), 1);
+    fructose_assert_eq(cache.getNbHits(), 0);
+
+    double value = cache.convert(20, Common::TucuUnit("kg"), Common::TucuUnit("g"));
+    fructose_assert(fabs(value - 20000) < 1e-9);
+    fructose_assert_eq(cache.getNbMisses(), 1);
+    fructose_assert_eq(cache.getNbHits(), 1);
+
+    // The reverse pair is another factor.
+    cache.convert(20, Common::TucuUnit("g"), Common::TucuUnit("kg"));
+    fructose_assert_eq(cache.getNbMisses(), 2);
+
+    cache.clear();
+    fructose_assert_eq(cache.getNbMisses(), 0);
+    fructose_assert_eq(cache.getNbHits(), 0);
+}
+
+void TestUnitConversionCache::convertSeries_behavesCorrectly(const string& _testName)
+{
+    cout << _testName << endl;
+
+    Xpert::UnitConversionCache& cache = Xpert::UnitConversionCache::getInstance();
+    cache.clear();
+
+    vector<double> values{1, 2.5, 10};
+    cache.convert(values, Common::TucuUnit("g"), Common::TucuUnit("mg"));
+
+    fructose_assert(fabs(values[0] - 1000) < 1e-9);
+    fructose_assert(fabs(values[1] - 2500) < 1e-9);
+    fructose_assert(fabs(values[2] - 10000) < 1e-9);
+    fructose_assert_eq(cache.getNbMisses(), 1);
+    fructose_assert_eq(cache.getNbHits(), 0);
+}
+
+void TestUnitConversionCache::convert_throws_withIncompatibleUnits(const string& _testName)
+{
+    cout << _testName << endl;
+
+    Xpert::UnitConversionCache& cache = Xpert::UnitConversionCache::getInstance();
+    cache.clear();
+
+    fructose_assert_exception(cache.convert(1, Common::TucuUnit("mg"), Common::TucuUnit("h")), invalid_argument);
+    fructose_assert_eq(cache.getNbMisses(), 0);
+
+    // Still throws the second time, nothing was stored.
+    fructose_assert_exception(cache.convert(1, Common::TucuUnit("mg"), Common::TucuUnit("h")), invalid_argument);
+    fructose_assert_eq(cache.getNbHits(), 0);
+}
@@ -0,0 +1,36 @@
+#ifndef TEST_UNITCONVERSIONCACHE_H
+#define TEST_UNITCONVERSIONCACHE_H
+
+#include "tuberxpert/utils/unitconversioncache.h"
+
+#include "fructose/fructose.h"
+
+/// \brief Tests for the UnitConversionCache.
+/// \date 19/10/2026
+/// \author Herzig Melvyn
+struct TestUnitConversionCache : public fructose::test_base<TestUnitConversionCache>
+{
+
+    /// \brief Convert some values and check that they are the same as the ones of the UnitManager.
+    ///        - 1500 mg to g must be 1.5
+    ///        - 2 d to h must be 48
+    ///        - 3 mg/l to ug/l must be 3000
+    /// \param _testName Name of the test.
+    void convert_givesSameValuesAsUnitManager(const std::string& _testName);
+
+    /// \brief Convert twice with the same pair of units. The first conversion must be a miss,
+    ///        the second a hit. Clear the cache and check that the counters are reset.
+    /// \param _testName Name of the test.
+    void convert_reusesFactor_withSamePairOfUnits(const std::string& _testName);
+
+    /// \brief Convert a vector of values in place and check the values. The factor must only be
+    ///        resolved once.
+    /// \param _testName Name of the test.
+    void convertSeries_behavesCorrectly(const std::string& _testName);
+
+    /// \brief Convert between incompatible units. An invalid_argument must be thrown and no factor stored.
+    /// \param _testName Name of the test.
+    void convert_throws_withIncompatibleUnits(const std::string& _testName);
+};
+
+#endif // TEST_UNITCONVERSIONCACHE_H
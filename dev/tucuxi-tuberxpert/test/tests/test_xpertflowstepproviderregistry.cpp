@@ -0,0 +1,56 @@
+#include "test_xpertflowstepproviderregistry.h"
+
+#include <memory>
+
+using namespace std;
+using namespace Tucuxi;
+
+void TestXpertFlowStepProviderRegistry::getProvider_returnsGeneralProvider_withUnknownDrug(const string& _testName)
+{
+    cout << _testName << endl;
+
+    Xpert::XpertFlowStepProviderRegistry& registry = Xpert::XpertFlowStepProviderRegistry::getInstance();
+
+    shared_ptr<const Xpert::AbstractXpertFlowStepProvider> first = registry.getProvider("unknownDrug");
+    shared_ptr<const Xpert::AbstractXpertFlowStepProvider> second = registry.getProvider("unknownDrug");
+
+    fructose_assert_eq(first, registry.getGeneralProvider());
+    fructose_assert_eq(first, second);
+    fructose_assert_eq(first->getRequestExecutor().get(), second->getRequestExecutor().get());
+}
+
+void TestXpertFlowStepProviderRegistry::getProvider_returnsRegisteredProvider_withRegisteredDrug(const string& _testName)
+{
+    cout << _testName << endl;
+
+    Xpert::XpertFlowStepProviderRegistry& registry = Xpert::XpertFlowStepProviderRegistry::getInstance();
+
+    shared_ptr<const Xpert::AbstractXpertFlowStepProvider> provider = make_shared<Xpert::GeneralXpertFlowStepProvider>();
+    registry.registerProvider("registeredDrug", provider);
+
+    fructose_assert_eq(registry.getProvider("registeredDrug"), provider);
+    fructose_assert_ne(registry.getProvider("registeredDrug"), registry.getGeneralProvider());
+    fructose_assert_eq(registry.getProvider("otherDrug"), registry.getGeneralProvider());
+}
+
+void TestXpertFlowStepProviderRegistry::getProvider_keepsProviderAlive_whenReplaced(const string& _testName)
+{
+    cout << _testName << endl;
+
+    Xpert::XpertFlowStepProviderRegistry& registry = Xpert::XpertFlowStepProviderRegistry::getInstance();
+
+    registry.registerProvider("replacedDrug", make_shared<Xpert::GeneralXpertFlowStepProvider>());
+    shared_ptr<const Xpert::AbstractXpertFlowStepProvider> inUseProvider = registry.getProvider("replacedDrug");
+    weak_ptr<const Xpert::AbstractXpertFlowStepProvider> weakProvider = inUseProvider;
+
+    registry.registerProvider("replacedDrug", make_shared<Xpert::GeneralXpertFlowStepProvider>());
+
+    // The request that got the old provider can still use its flow steps.
+    fructose_assert_ne(registry.getProvider("replacedDrug"), inUseProvider);
+    fructose_assert_eq(weakProvider.expired(), false);
+    fructose_assert_ne(inUseProvider->getRequestExecutor().get(), nullptr);
+
+    // Once released, the old provider is destroyed.
+    inUseProvider = nullptr;
+    fructose_assert_eq(weakProvider.expired(), true);
+}
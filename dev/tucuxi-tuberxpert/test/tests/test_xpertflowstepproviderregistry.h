@@ -0,0 +1,31 @@
+#ifndef TEST_XPERTFLOWSTEPPROVIDERREGISTRY_H
+#define TEST_XPERTFLOWSTEPPROVIDERREGISTRY_H
+
+#include "tuberxpert/flow/xpertflowstepproviderregistry.h"
+#include "tuberxpert/flow/general/generalxpertflowstepprovider.h"
+
+#include "fructose/fructose.h"
+
+/// \brief Tests for the XpertFlowStepProviderRegistry.
+/// \date 19/10/2026
+/// \author Herzig Melvyn
+struct TestXpertFlowStepProviderRegistry : public fructose::test_base<TestXpertFlowStepProviderRegistry>
+{
+
+    /// \brief Get the provider of a drug without specialized provider. It must be
+    ///        the general provider, and the same instance at each call.
+    /// \param _testName Name of the test.
+    void getProvider_returnsGeneralProvider_withUnknownDrug(const std::string& _testName);
+
+    /// \brief Register a provider for a drug and get it. The registered provider must be returned
+    ///        for the drug and the general provider for the others.
+    /// \param _testName Name of the test.
+    void getProvider_returnsRegisteredProvider_withRegisteredDrug(const std::string& _testName);
+
+    /// \brief Get the provider of a drug and replace it with another registration. The first provider
+    ///        must stay alive as long as it is used and be released afterwards.
+    /// \param _testName Name of the test.
+    void getProvider_keepsProviderAlive_whenReplaced(const std::string& _testName);
+};
+
+#endif // TEST_XPERTFLOWSTEPPROVIDERREGISTRY_H
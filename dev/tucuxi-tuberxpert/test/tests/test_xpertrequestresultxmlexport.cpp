@@ -0,0 +1,101 @@
+#include "test_xpertrequestresultxmlexport.h"
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+
+#include "tuberxpert/flow/general/requestexecutor.h"
+#include "tuberxpert/result/xpertqueryresult.h"
+
+using namespace std;
+using namespace Tucuxi;
+
+/// \brief Exposes the xml string of the export.
+class XmlStringExport : public Xpert::XpertRequestResultXmlExport
+{
+public:
+
+    /// \brief Transform the given XpertRequestResult into an XML string.
+    /// \param _xpertRequestResult Result of the xpertRequest to transform.
+    /// \param _xmlString The resulting xml string.
+    void exportToString(const Xpert::XpertRequestResult& _xpertRequestResult, string& _xmlString)
+    {
+        m_xpertRequestResultInUse = &_xpertRequestResult;
+        makeXmlString(_xpertRequestResult, _xmlString);
+    }
+};
+
+/// \brief Count the occurrences of a text in another one.
+/// \param _text Text where to search.
+/// \param _pattern Text to count.
+/// \return The number of occurrences.
+static size_t countOccurrences(const string& _text, const string& _pattern)
+{
+    size_t count = 0;
+    for (size_t pos = _text.find(_pattern); pos != string::npos; pos = _text.find(_pattern, pos + _pattern.size())) {
+        ++count;
+    }
+    return count;
+}
+
+void TestXpertRequestResultXmlExport::makeXmlString_producesValidXml_withListedOnlyCandidates(const string& _testName)
+{
+    cout << _testName << endl;
+
+    const string xmlDirectory = TUBERXPERT_XML_DIR;
+
+    // The query of the imatinib example, with dosages, samples and covariates.
+    ifstream queryFile(xmlDirectory + "/query/2_ch.tucuxi.imatinib.gotta2012.2.tqf");
+    fructose_assert_eq(queryFile.is_open(), true);
+    string queryString((istreambuf_iterator<char>(queryFile)), istreambuf_iterator<char>());
+
+    // Prepare the XpertRequestResult
+    unique_ptr<Xpert::XpertQueryResult> xpertQueryResult;
+    TestUtils::setupEnv(queryString, TestUtils::originalImatinibModelString, xpertQueryResult);
+
+    Xpert::XpertRequestResult& xpertRequestResult = xpertQueryResult->getXpertRequestResults()[0];
+
+    // Execute the flow, only the best candidate keeps its curves
+    TestUtils::flowStepProvider.getCovariateValidatorAndModelSelector()->perform(xpertRequestResult);
+    TestUtils::flowStepProvider.getDoseValidator()->perform(xpertRequestResult);
+    TestUtils::flowStepProvider.getSampleValidator()->perform(xpertRequestResult);
+    TestUtils::flowStepProvider.getTargetValidator()->perform(xpertRequestResult);
+    TestUtils::flowStepProvider.getAdjustmentTraitCreator()->perform(xpertRequestResult);
+
+    Xpert::RequestExecutor requestExecutor(Xpert::PointDensity(6), 10, 1);
+    requestExecutor.perform(xpertRequestResult);
+
+    fructose_assert_eq(xpertRequestResult.shouldContinueProcessing(), true);
+
+    const vector<Core::DosageAdjustment>& adjustments = xpertRequestResult.getAdjustmentData()->getAdjustments();
+    fructose_assert_eq(adjustments.size() > 1, true);
+
+    // Export
+    string xmlString;
+    XmlStringExport xmlExport;
+    xmlExport.exportToString(xpertRequestResult, xmlString);
+
+    // Compare
+    fructose_assert_eq(countOccurrences(xmlString, "<adjustment>"), adjustments.size());
+    fructose_assert_eq(countOccurrences(xmlString, "<cycleDatas>"), size_t(1));
+    fructose_assert_eq(countOccurrences(xmlString, "<cycleDatas/>"), size_t(0));
+
+    // Validate against the XSD when xmllint is available
+    if (system("xmllint --version > /dev/null 2>&1") != 0) {
+        cout << "xmllint is not available, the XSD validation is skipped." << endl;
+        return;
+    }
+
+    string xmlPath = (filesystem::temp_directory_path() / "tuberxpert_test_listed_candidates.xml").string();
+    {
+        ofstream xmlFile(xmlPath);
+        xmlFile << xmlString;
+    }
+
+    string command = "xmllint --noout --schema \"" + xmlDirectory + "/response/tuberxpert_computing_response.xsd\" \"" +
+            xmlPath + "\" > /dev/null 2>&1";
+    int validationResult = system(command.c_str());
+    filesystem::remove(xmlPath);
+
+    fructose_assert_eq(validationResult, 0);
+}
@@ -0,0 +1,23 @@
+#ifndef TEST_XPERTREQUESTRESULTXMLEXPORT_H
+#define TEST_XPERTREQUESTRESULTXMLEXPORT_H
+
+#include "testutils.h"
+
+#include "tuberxpert/exporter/xpertrequestresultxmlexport.h"
+
+#include "fructose/fructose.h"
+
+/// \brief Tests for the XpertRequestResultXmlExport.
+/// \date 19/10/2026
+/// \author Herzig Melvyn
+struct TestXpertRequestResultXmlExport : public fructose::test_base<TestXpertRequestResultXmlExport>
+{
+
+    /// \brief Export the result of the whole flow when only the best candidate keeps its curves.
+    ///        - Only the best candidate must have a cycleDatas node, there must be no empty one.
+    ///        - The xml must be valid against the response XSD (checked with xmllint when available).
+    /// \param _testName Name of the test.
+    void makeXmlString_producesValidXml_withListedOnlyCandidates(const std::string& _testName);
+};
+
+#endif // TEST_XPERTREQUESTRESULTXMLEXPORT_H
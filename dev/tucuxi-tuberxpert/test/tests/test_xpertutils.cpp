@@ -331,7 +331,7 @@ void TestXpertUtils::computeFileName_behavesCorrectly(const string& _testName)
     fructose_assert_eq(Xpert::computeFileName(xpertRequestresult, false, false), "imatinib_1_11-7-2018_13h45m30s");
 }
 
-void TestXpertUtils::executeRequestAndGetResult_behavesCorrectly(const string& _testName)
+void TestXpertUtils::executeRequest_behavesCorrectly(const string& _testName)
 {
 
     string queryString = R"(<?xml version="1.0" encoding="UTF-8" standalone="no"?>
@@ -466,25 +466,30 @@ void TestXpertUtils::executeRequestAndGetResult_behavesCorrectly(const string& _
     // Too long start/end (+ 1'000'000 hours)
     Common::DateTime tooFarEnd = start + chrono::hours(1000000);
 
-    // Making traits and response pointers
+    // Making traits
     unique_ptr<Core::ComputingTraitPercentiles> goodTrait =
             make_unique<Core::ComputingTraitPercentiles>(responseId, start, normalEnd, ranks, nbPointsPerHour, computingOption);
 
-    unique_ptr<Core::PercentilesData> goodResult = nullptr;
-
     unique_ptr<Core::ComputingTraitPercentiles> failTrait =
             make_unique<Core::ComputingTraitPercentiles>(responseId, start, tooFarEnd, ranks, nbPointsPerHour, computingOption);
 
-    unique_ptr<Core::PercentilesData> failResult = nullptr;
-
     // Execution
-    Xpert::executeRequestAndGetResult(move(goodTrait), xpertRequestResult, goodResult);
-    Xpert::executeRequestAndGetResult(move(failTrait), xpertRequestResult, failResult);
-
-    fructose_assert_eq(failResult.get(), nullptr);
-
-    fructose_assert_ne(goodResult.get(), nullptr);
-    fructose_assert_eq(goodResult->getNbRanks(), 3);
+    Xpert::RequestResult<Core::PercentilesData> goodResult = Xpert::executeRequest(move(goodTrait), xpertRequestResult);
+    Xpert::RequestResult<Core::PercentilesData> failResult = Xpert::executeRequest(move(failTrait), xpertRequestResult);
+
+    fructose_assert_eq(failResult.isOk(), false);
+    fructose_assert_eq(failResult.getError() == Xpert::RequestError::COMPUTATION_FAILED, true);
+    fructose_assert_eq(failResult.takeData().get(), nullptr);
+
+    fructose_assert_eq(goodResult.isOk(), true);
+    fructose_assert_eq(goodResult.getError() == Xpert::RequestError::NONE, true);
+    fructose_assert_eq(goodResult.getData().getNbRanks(), 3);
+
+    // Once taken, the data is not in the result anymore.
+    unique_ptr<Core::PercentilesData> goodData = goodResult.takeData();
+    fructose_assert_ne(goodData.get(), nullptr);
+    fructose_assert_eq(goodResult.isOk(), false);
+    fructose_assert_eq(goodResult.getError() == Xpert::RequestError::NO_DATA, true);
 }
 
 void TestXpertUtils::keyToPhrase_behavesCorrectly(const string& _testName)
@@ -127,15 +127,16 @@ struct TestXpertUtils : public fructose::test_base<TestXpertUtils>
     /// \param _testName Name of the test
     void computeFileName_behavesCorrectly(const std::string& _testName);
 
-    /// \brief Check that the method executeRequestAndGetResult sets the result to nullptr when
-    ///        the execution fails or that the resulting pointer is correctly retrieved. The test
-    ///        prepares two percentile traits, one that must fail and one that must succeed.
+    /// \brief Check that the method executeRequest reports the error when the execution fails
+    ///        or that the resulting data is correctly retrieved. The test prepares two percentile
+    ///        traits, one that must fail and one that must succeed.
     ///        One trait is prepared with a too large period which will fail.
     ///        The other is a valid trait like the ones used in samplevalidator.cpp.
-    ///        - The first response must be nullptr.
-    ///        - The second response must not be nullptr and must contain 3 percentiles.
+    ///        - The first result must have the COMPUTATION_FAILED error and no data.
+    ///        - The second result must be ok and contain 3 percentiles.
+    ///        - Once the data of the second result is taken, the result must have the NO_DATA error.
     /// \param _testName Name of the test
-    void executeRequestAndGetResult_behavesCorrectly(const std::string& _testName);
+    void executeRequest_behavesCorrectly(const std::string& _testName);
 
     /// \brief Test that a camel case key is correctly converted into a phrase.
     ///        - "" must be ""
@@ -9,6 +9,7 @@
 #include "tuberxpert/language/languagemanager.h"
 #include "tuberxpert/result/xpertqueryresult.h"
 #include "tuberxpert/result/xpertrequestresult.h"
+#include "tuberxpert/utils/flowstepcache.h"
 
 
 using namespace std;
@@ -1493,6 +1494,9 @@ void TestUtils::setupEnv(const string& _queryString,
                  throw std::runtime_error("A drug file has internal errors : " + checkerResult.m_errorMessage);
              }
              drugModelRepository->addDrugModel(drugModel.get());
+
+             // The flow step outputs kept between runs depend on the content of the drug model.
+             Tucuxi::Xpert::FlowStepCache::getInstance().registerDrugModel(modelString);
          }
          else {
              throw std::runtime_error("Failed to import drug file");
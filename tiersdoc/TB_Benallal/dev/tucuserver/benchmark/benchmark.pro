@@ -0,0 +1,61 @@
+TEMPLATE = app
+CONFIG -= app_bundle
+CONFIG -= qt
+CONFIG += console
+CONFIG += c++14
+
+TUCUXIROOTDIR = $$(TUCUXI_ROOT)
+
+include($${TUCUXIROOTDIR}/make/qtcreator/general.pri)
+include($${TUCUXIROOTDIR}/make/qtcreator/tucucommon.pri)
+include($${TUCUXIROOTDIR}/make/qtcreator/tucucore.pri)
+
+INCLUDEPATH += $$PWD/../src \
+               $$PWD/../../../../../dev/tucuxi-tuberxpert/libs
+
+HEADERS += \
+    ../src/communication/query.h \
+    ../src/communication/xmlreader.h \
+    ../src/communication/jsonreader.h \
+    ../src/communication/administrativedata.h \
+    ../src/communication/parametersdata.h \
+    ../src/communication/requestdata.h \
+    ../src/communication/apiresponse.h \
+    ../src/communication/apiresponsewriter.h \
+    ../src/communication/xmlstreamwriter.h \
+    ../src/communication/jsonstreamwriter.h \
+    ../src/computer.h \
+    ../src/predictioncomputer.h \
+    ../src/adjustmentcomputer.h \
+    ../src/firstdosagecomputer.h \
+    ../src/configuration.h \
+    ../src/configurationreader.h \
+    ../src/drugmodelstore.h
+
+SOURCES += \
+    main.cpp \
+    ../src/communication/query.cpp \
+    ../src/communication/xmlreader.cpp \
+    ../src/communication/jsonreader.cpp \
+    ../src/communication/administrativedata.cpp \
+    ../src/communication/parametersdata.cpp \
+    ../src/communication/requestdata.cpp \
+    ../src/communication/apiresponse.cpp \
+    ../src/communication/apiresponsewriter.cpp \
+    ../src/communication/xmlstreamwriter.cpp \
+    ../src/communication/jsonstreamwriter.cpp \
+    ../src/computer.cpp \
+    ../src/predictioncomputer.cpp \
+    ../src/adjustmentcomputer.cpp \
+    ../src/firstdosagecomputer.cpp \
+    ../src/configuration.cpp \
+    ../src/configurationreader.cpp \
+    ../src/drugmodelstore.cpp
+
+unix{
+
+LIBS += -lpthread
+
+LIBS += $${TUCUXIROOTDIR}/bin/tinyjs.a \
+        /usr/lib/x86_64-linux-gnu/libdl.so
+}
@@ -0,0 +1,163 @@
+// Compares the cost of the XML and JSON formats of the computation endpoint:
+// reading the sample queries into a Query, and serializing their responses.
+//
+// Usage: benchmark [communication directory] [iterations]
+// The communication directory holds the xml_query and json_query samples, like the
+// server the benchmark reads its configuration and the drug models from ../tucuserver.
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "communication/xmlreader.h"
+#include "communication/jsonreader.h"
+#include "communication/apiresponsewriter.h"
+#include "predictioncomputer.h"
+#include "adjustmentcomputer.h"
+#include "firstdosagecomputer.h"
+
+using namespace std;
+using namespace Tucuxi::Server;
+
+namespace {
+
+struct Sample
+{
+    string m_name;
+    string m_xmlFile;
+    string m_jsonFile;
+};
+
+bool readFile(const string& _filename, string& _content)
+{
+    ifstream file(_filename);
+    if (!file) {
+        return false;
+    }
+
+    stringstream content;
+    content << file.rdbuf();
+    _content = content.str();
+    return true;
+}
+
+// Mean duration of an iteration in microseconds.
+template<typename Function>
+double measure(size_t _nbIterations, Function _function)
+{
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (size_t i = 0; i < _nbIterations; i++) {
+        _function();
+    }
+    chrono::duration<double, micro> elapsed = chrono::steady_clock::now() - start;
+
+    return elapsed.count() / _nbIterations;
+}
+
+void printResult(const string& _sample, const string& _operation, const string& _format, double _microseconds, size_t _bytes)
+{
+    cout << left << setw(16) << _sample << setw(12) << _operation << setw(14) << _format
+         << right << setw(12) << fixed << setprecision(1) << _microseconds << " us"
+         << setw(12) << _bytes << " bytes" << endl;
+}
+
+// Computes the requests of the query like the computation endpoint does, the
+// requests of the types it does not support are left out.
+unique_ptr<ApiResponseWriter> computeResponses(const Query& _query)
+{
+    unique_ptr<ApiResponseWriter> apiResponseWriter = make_unique<ApiResponseAdjustmentWriter>();
+    shared_ptr<const DrugModelSnapshot> drugModels = DrugModelStore::getInstance()->getSnapshot();
+
+    for (size_t i = 0; i < _query.getRequests().size(); i++) {
+        string requestType = _query.getRequests().at(i)->getRequestType();
+
+        unique_ptr<Computer> computer;
+        if (requestType == "prediction") {
+            computer = make_unique<PredictionComputer>(_query, i, drugModels);
+        } else if (requestType == "dosageAdaptation") {
+            computer = make_unique<AdjustmentComputer>(_query, i, drugModels);
+        } else if (requestType == "firstDosage") {
+            computer = make_unique<FirstDosageComputer>(_query, i, drugModels);
+        } else {
+            continue;
+        }
+
+        try {
+            computer->compute();
+        } catch (std::exception& e) {
+            computer->getResult().addError("ComputationError", _query.getLanguage(), e.what());
+        }
+        apiResponseWriter->addApiResponse(computer->releaseResult());
+    }
+
+    return apiResponseWriter;
+}
+
+} // namespace
+
+int main(int _argc, char** _argv)
+{
+    string communicationDirectory = _argc > 1 ? _argv[1] : "../communication";
+    size_t nbIterations = _argc > 2 ? stoul(_argv[2]) : 1000;
+
+    vector<Sample> samples = {
+        {"query_v1", "xml_query/xml_query_v1.xml", "json_query/json_query_v1.json"},
+        {"query_examples", "xml_query/xml_query_examples.xml", "json_query/json_query_examples.json"}
+    };
+
+    cout << "Mean of " << nbIterations << " iterations" << endl;
+
+    for (const Sample& sample : samples) {
+        string xmlQuery;
+        string jsonQuery;
+        if (!readFile(communicationDirectory + "/" + sample.m_xmlFile, xmlQuery) ||
+                !readFile(communicationDirectory + "/" + sample.m_jsonFile, jsonQuery)) {
+            cerr << "Cannot read the files of the sample " << sample.m_name << endl;
+            return 1;
+        }
+
+        // Both formats must describe the same query, otherwise the comparison is meaningless.
+        XMLReader xmlReader(xmlQuery);
+        JSONReader jsonReader(jsonQuery);
+        if (xmlReader.getQuery().getQueryID() != jsonReader.getQuery().getQueryID() ||
+                xmlReader.getQuery().getRequests().size() != jsonReader.getQuery().getRequests().size() ||
+                xmlReader.getQuery().getpParameters().getDrugs().size() != jsonReader.getQuery().getpParameters().getDrugs().size()) {
+            cerr << "The XML and JSON queries of the sample " << sample.m_name << " differ" << endl;
+            return 1;
+        }
+
+        double xmlParse = measure(nbIterations, [&xmlQuery]() { XMLReader reader(xmlQuery); });
+        double jsonParse = measure(nbIterations, [&jsonQuery]() { JSONReader reader(jsonQuery); });
+        printResult(sample.m_name, "parse", "xml", xmlParse, xmlQuery.size());
+        printResult(sample.m_name, "parse", "json", jsonParse, jsonQuery.size());
+
+        // The responses are computed once, only their serialization is measured.
+        unique_ptr<ApiResponseWriter> apiResponseWriter = computeResponses(xmlReader.getQuery());
+
+        for (bool prettyPrint : {true, false}) {
+            string suffix = prettyPrint ? " pretty" : " compact";
+            size_t xmlSize = 0;
+            size_t jsonSize = 0;
+
+            double xmlSerialize = measure(nbIterations, [&apiResponseWriter, prettyPrint, &xmlSize]() {
+                ostringstream output;
+                apiResponseWriter->serialize(output, prettyPrint);
+                xmlSize = output.str().size();
+            });
+            double jsonSerialize = measure(nbIterations, [&apiResponseWriter, prettyPrint, &jsonSize]() {
+                ostringstream output;
+                apiResponseWriter->serializeJson(output, prettyPrint);
+                jsonSize = output.str().size();
+            });
+
+            printResult(sample.m_name, "serialize", "xml" + suffix, xmlSerialize, xmlSize);
+            printResult(sample.m_name, "serialize", "json" + suffix, jsonSerialize, jsonSize);
+        }
+    }
+
+    return 0;
+}
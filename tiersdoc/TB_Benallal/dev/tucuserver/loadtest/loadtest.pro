@@ -0,0 +1,13 @@
+TEMPLATE = app
+CONFIG -= app_bundle
+CONFIG -= qt
+CONFIG += console
+CONFIG += c++14
+
+SOURCES += \
+    main.cpp
+
+unix{
+
+LIBS += -lpthread
+}
@@ -0,0 +1,469 @@
+// Closed-loop load test of the computation endpoint, to find the throughput knee of a server.
+// For each number of connections, every connection sends the query again as soon as the previous
+// response is received, over a keep-alive socket. The step reports the throughput, the latency
+// percentiles and the share of 503 answers, the knee is the first step where adding connections
+// no longer raises the throughput noticeably.
+//
+// Usage: loadtest [-h host] [-p port] [-d seconds per step] [-c 1,2,4,8] [-u] [-a] query file
+//   -u  makes each query unique by numbering its queryID, so that the response cache is bypassed
+//   -a  posts the queries as asynchronous jobs (?async=true), to measure the admission only
+// The query is sent as JSON if the file name ends with .json, as XML otherwise.
+
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+struct Settings
+{
+    string m_host = "127.0.0.1";
+    string m_port = "9090";
+    unsigned int m_stepDuration = 10;
+    vector<size_t> m_connections = {1, 2, 4, 8, 16, 32, 64};
+    bool m_isUnique = false;
+    bool m_isAsync = false;
+    bool m_isJson = false;
+    string m_queryFile;
+};
+
+struct StepResult
+{
+    size_t m_nbConnections = 0;
+    size_t m_nbOk = 0;
+    size_t m_nbBusy = 0;
+    size_t m_nbOther = 0;
+    size_t m_nbErrors = 0;
+    double m_throughput = 0;
+    vector<double> m_latencies;
+};
+
+// Results of the requests sent over one connection.
+struct ConnectionResult
+{
+    size_t m_nbOk = 0;
+    size_t m_nbBusy = 0;
+    size_t m_nbOther = 0;
+    size_t m_nbErrors = 0;
+    vector<double> m_latencies;
+};
+
+bool readFile(const string& _filename, string& _content)
+{
+    ifstream file(_filename);
+    if (!file) {
+        return false;
+    }
+
+    stringstream content;
+    content << file.rdbuf();
+    _content = content.str();
+    return true;
+}
+
+int connectTo(const Settings& _settings)
+{
+    addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+
+    addrinfo* addresses = nullptr;
+    if (getaddrinfo(_settings.m_host.c_str(), _settings.m_port.c_str(), &hints, &addresses) != 0) {
+        return -1;
+    }
+
+    int fd = -1;
+    for (addrinfo* address = addresses; address != nullptr; address = address->ai_next) {
+        fd = socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+        if (fd < 0) {
+            continue;
+        }
+        if (connect(fd, address->ai_addr, address->ai_addrlen) == 0) {
+            break;
+        }
+        close(fd);
+        fd = -1;
+    }
+    freeaddrinfo(addresses);
+
+    if (fd >= 0) {
+        // A request is written at once, it must not wait for the acknowledgement of the previous one.
+        int noDelay = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+        // A stuck server must not hang the load test.
+        timeval timeout;
+        timeout.tv_sec = 60;
+        timeout.tv_usec = 0;
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    }
+
+    return fd;
+}
+
+bool sendAll(int _fd, const string& _data)
+{
+    size_t sent = 0;
+    while (sent < _data.size()) {
+        ssize_t result = send(_fd, _data.data() + sent, _data.size() - sent, MSG_NOSIGNAL);
+        if (result <= 0) {
+            return false;
+        }
+        sent += static_cast<size_t>(result);
+    }
+
+    return true;
+}
+
+// Buffered reader of the responses of a connection.
+class ResponseReader
+{
+public:
+    ResponseReader(int _fd) : m_fd(_fd) {}
+
+    // Reads a whole response, with a Content-Length or chunked body, and returns its status code.
+    // Returns 0 if the connection failed or the response is malformed.
+    int readResponse(bool& _isClosed)
+    {
+        string statusLine;
+        if (!readLine(statusLine) || statusLine.compare(0, 5, "HTTP/") != 0) {
+            return 0;
+        }
+
+        size_t space = statusLine.find(' ');
+        int code = space == string::npos ? 0 : atoi(statusLine.c_str() + space + 1);
+
+        size_t contentLength = 0;
+        bool isChunked = false;
+        _isClosed = false;
+
+        string header;
+        while (readLine(header) && !header.empty()) {
+            string name = header.substr(0, header.find(':'));
+            transform(name.begin(), name.end(), name.begin(), ::tolower);
+            string value = header.substr(min(header.size(), name.size() + 1));
+            value.erase(0, value.find_first_not_of(' '));
+
+            if (name == "content-length") {
+                contentLength = stoul(value);
+            } else if (name == "transfer-encoding") {
+                isChunked = value.find("chunked") != string::npos;
+            } else if (name == "connection") {
+                _isClosed = value.find("close") != string::npos;
+            }
+        }
+
+        if (!isChunked) {
+            return skip(contentLength) ? code : 0;
+        }
+
+        string chunkSize;
+        while (readLine(chunkSize)) {
+            size_t size = stoul(chunkSize, nullptr, 16);
+            string end;
+            if (!skip(size) || !readLine(end)) {
+                return 0;
+            }
+            if (size == 0) {
+                return code;
+            }
+        }
+
+        return 0;
+    }
+
+protected:
+    bool fill()
+    {
+        m_buffer.erase(0, m_position);
+        m_position = 0;
+
+        char data[16384];
+        ssize_t result = recv(m_fd, data, sizeof(data), 0);
+        if (result <= 0) {
+            return false;
+        }
+        m_buffer.append(data, static_cast<size_t>(result));
+
+        return true;
+    }
+
+    bool readLine(string& _line)
+    {
+        size_t end;
+        while ((end = m_buffer.find("\r\n", m_position)) == string::npos) {
+            if (!fill()) {
+                return false;
+            }
+        }
+
+        _line = m_buffer.substr(m_position, end - m_position);
+        m_position = end + 2;
+        return true;
+    }
+
+    bool skip(size_t _size)
+    {
+        while (m_buffer.size() - m_position < _size) {
+            _size -= m_buffer.size() - m_position;
+            m_position = m_buffer.size();
+            if (!fill()) {
+                return false;
+            }
+        }
+
+        m_position += _size;
+        return true;
+    }
+
+protected:
+    int m_fd;
+    string m_buffer;
+    size_t m_position = 0;
+};
+
+// Gives the query a new queryID, the queries differ only by it.
+string makeUnique(const string& _query, bool _isJson, size_t _number)
+{
+    string open = _isJson ? "\"queryID\"" : "<queryID>";
+    size_t start = _query.find(open);
+    if (start == string::npos) {
+        return _query;
+    }
+
+    size_t end;
+    if (_isJson) {
+        start = _query.find('"', start + open.size());
+        end = start == string::npos ? string::npos : _query.find('"', start + 1);
+        start++;
+    } else {
+        start += open.size();
+        end = _query.find("</queryID>", start);
+    }
+    if (end == string::npos) {
+        return _query;
+    }
+
+    return _query.substr(0, end) + "-" + to_string(_number) + _query.substr(end);
+}
+
+string makeRequest(const Settings& _settings, const string& _query)
+{
+    string request = "POST /computation";
+    request += _settings.m_isAsync ? "?async=true" : "";
+    request += " HTTP/1.1\r\n";
+    request += "Host: " + _settings.m_host + ":" + _settings.m_port + "\r\n";
+    request += _settings.m_isJson ? "Content-Type: application/json\r\n" : "Content-Type: application/xml\r\n";
+    request += "Content-Length: " + to_string(_query.size()) + "\r\n";
+    request += "\r\n";
+    request += _query;
+
+    return request;
+}
+
+void runConnection(const Settings& _settings, const string& _query, size_t _connection,
+                   chrono::steady_clock::time_point _end, ConnectionResult& _result)
+{
+    string request = makeRequest(_settings, _query);
+    size_t nbSent = 0;
+
+    int fd = -1;
+    unique_ptr<ResponseReader> reader;
+    while (chrono::steady_clock::now() < _end) {
+        if (fd < 0) {
+            fd = connectTo(_settings);
+            if (fd < 0) {
+                _result.m_nbErrors++;
+                this_thread::sleep_for(chrono::milliseconds(100));
+                continue;
+            }
+            reader = make_unique<ResponseReader>(fd);
+        }
+
+        if (_settings.m_isUnique) {
+            request = makeRequest(_settings, makeUnique(_query, _settings.m_isJson, _connection * 1000000000 + nbSent));
+        }
+        nbSent++;
+
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        bool isClosed = false;
+        int code = sendAll(fd, request) ? reader->readResponse(isClosed) : 0;
+        chrono::duration<double, milli> latency = chrono::steady_clock::now() - start;
+
+        if (code == 0) {
+            _result.m_nbErrors++;
+            isClosed = true;
+        } else {
+            _result.m_latencies.push_back(latency.count());
+            if (code == 200 || code == 202) {
+                _result.m_nbOk++;
+            } else if (code == 503) {
+                _result.m_nbBusy++;
+            } else {
+                _result.m_nbOther++;
+            }
+        }
+
+        if (isClosed) {
+            close(fd);
+            fd = -1;
+        }
+    }
+
+    if (fd >= 0) {
+        close(fd);
+    }
+}
+
+StepResult runStep(const Settings& _settings, const string& _query, size_t _nbConnections)
+{
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    chrono::steady_clock::time_point end = start + chrono::seconds(_settings.m_stepDuration);
+
+    vector<ConnectionResult> connectionResults(_nbConnections);
+    vector<thread> threads;
+    for (size_t i = 0; i < _nbConnections; i++) {
+        threads.emplace_back(runConnection, cref(_settings), cref(_query), i, end, ref(connectionResults[i]));
+    }
+    for (thread& t : threads) {
+        t.join();
+    }
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+    StepResult result;
+    result.m_nbConnections = _nbConnections;
+    for (const ConnectionResult& connectionResult : connectionResults) {
+        result.m_nbOk += connectionResult.m_nbOk;
+        result.m_nbBusy += connectionResult.m_nbBusy;
+        result.m_nbOther += connectionResult.m_nbOther;
+        result.m_nbErrors += connectionResult.m_nbErrors;
+        result.m_latencies.insert(result.m_latencies.end(), connectionResult.m_latencies.begin(), connectionResult.m_latencies.end());
+    }
+    result.m_throughput = result.m_nbOk / elapsed.count();
+    sort(result.m_latencies.begin(), result.m_latencies.end());
+
+    return result;
+}
+
+double percentile(const vector<double>& _sortedValues, double _percentile)
+{
+    if (_sortedValues.empty()) {
+        return 0;
+    }
+
+    size_t index = static_cast<size_t>(_percentile / 100 * (_sortedValues.size() - 1) + 0.5);
+    return _sortedValues[index];
+}
+
+bool parseArguments(int _argc, char** _argv, Settings& _settings)
+{
+    for (int i = 1; i < _argc; i++) {
+        string argument = _argv[i];
+        bool hasValue = i + 1 < _argc;
+
+        if (argument == "-h" && hasValue) {
+            _settings.m_host = _argv[++i];
+        } else if (argument == "-p" && hasValue) {
+            _settings.m_port = _argv[++i];
+        } else if (argument == "-d" && hasValue) {
+            _settings.m_stepDuration = stoul(_argv[++i]);
+        } else if (argument == "-c" && hasValue) {
+            _settings.m_connections.clear();
+            stringstream connections(_argv[++i]);
+            string connection;
+            while (getline(connections, connection, ',')) {
+                _settings.m_connections.push_back(stoul(connection));
+            }
+        } else if (argument == "-u") {
+            _settings.m_isUnique = true;
+        } else if (argument == "-a") {
+            _settings.m_isAsync = true;
+        } else if (argument[0] != '-' && _settings.m_queryFile.empty()) {
+            _settings.m_queryFile = argument;
+        } else {
+            return false;
+        }
+    }
+
+    const string JSON_EXTENSION = ".json";
+    _settings.m_isJson = _settings.m_queryFile.size() > JSON_EXTENSION.size() &&
+            _settings.m_queryFile.compare(_settings.m_queryFile.size() - JSON_EXTENSION.size(), JSON_EXTENSION.size(), JSON_EXTENSION) == 0;
+
+    return !_settings.m_queryFile.empty() && !_settings.m_connections.empty();
+}
+
+} // namespace
+
+int main(int _argc, char** _argv)
+{
+    Settings settings;
+    if (!parseArguments(_argc, _argv, settings)) {
+        cerr << "Usage: loadtest [-h host] [-p port] [-d seconds per step] [-c 1,2,4,8] [-u] [-a] query file" << endl;
+        return 1;
+    }
+
+    string query;
+    if (!readFile(settings.m_queryFile, query)) {
+        cerr << "Cannot read the query " << settings.m_queryFile << endl;
+        return 1;
+    }
+
+    cout << left << setw(12) << "connections" << right
+         << setw(12) << "req/s" << setw(10) << "p50 ms" << setw(10) << "p90 ms" << setw(10) << "p99 ms"
+         << setw(10) << "ok" << setw(10) << "503" << setw(10) << "other" << setw(10) << "errors" << endl;
+
+    // The knee is the last step before the throughput gains less than 5% for more connections.
+    const double KNEE_GAIN = 1.05;
+    const StepResult* pKnee = nullptr;
+    vector<StepResult> results;
+    results.reserve(settings.m_connections.size());
+
+    for (size_t nbConnections : settings.m_connections) {
+        results.push_back(runStep(settings, query, nbConnections));
+        const StepResult& result = results.back();
+
+        cout << left << setw(12) << result.m_nbConnections << right << fixed << setprecision(1)
+             << setw(12) << result.m_throughput
+             << setw(10) << percentile(result.m_latencies, 50)
+             << setw(10) << percentile(result.m_latencies, 90)
+             << setw(10) << percentile(result.m_latencies, 99)
+             << setw(10) << result.m_nbOk << setw(10) << result.m_nbBusy
+             << setw(10) << result.m_nbOther << setw(10) << result.m_nbErrors << endl;
+
+        if (pKnee == nullptr && results.size() > 1) {
+            const StepResult& previous = results[results.size() - 2];
+            if (result.m_throughput < previous.m_throughput * KNEE_GAIN) {
+                pKnee = &previous;
+            }
+        }
+    }
+
+    if (pKnee != nullptr) {
+        cout << "Throughput knee at " << pKnee->m_nbConnections << " connections, "
+             << pKnee->m_throughput << " req/s" << endl;
+    } else {
+        cout << "No knee found, the throughput still grows with the connections" << endl;
+    }
+
+    return 0;
+}
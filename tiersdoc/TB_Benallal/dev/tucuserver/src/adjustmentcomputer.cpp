@@ -6,33 +6,33 @@ using namespace Tucuxi::Core;
 namespace Tucuxi {
 namespace Server {
 
-AdjustmentComputer::AdjustmentComputer(const Query& _query)
-    : Computer(_query)
+AdjustmentComputer::AdjustmentComputer(const Query& _query, size_t _requestPosition, shared_ptr<const DrugModelSnapshot> _drugModels)
+    : Computer(_query, _requestPosition, move(_drugModels))
 {}
 
 void AdjustmentComputer::compute()
 {
     // Creating a response for the adjustments
-    unique_ptr<ApiResponseAdjustment> apiResponse = make_unique<ApiResponseAdjustment>(m_query.getQueryID(), "123");
+    unique_ptr<ApiResponseAdjustment> apiResponse = make_unique<ApiResponseAdjustment>(m_query.getQueryID(), getRequest().getRequestID());
 
     // Getting the drug related to the request
-    string drugID = m_query.getRequests().at(0)->getDrugID();
+    string drugID = getRequest().getDrugID();
     const vector< unique_ptr<DrugData> >& drugs = m_query.getpParameters().getDrugs();
-    size_t drugPosition = 0;
-    for (; drugPosition < drugs.size(); ++drugPosition) {
-        if (drugs.at(drugPosition)->getDrugID() == drugID) {
-            break;
-        }
+    size_t drugPosition = findDrugPosition();
+    if (drugPosition == drugs.size()) {
+        apiResponse->addError("UnknownDrug", m_query.getLanguage(), "No parameters for drug " + drugID + ".");
+        m_result = move(apiResponse);
+        return;
     }
 
     IComputingService* component = dynamic_cast<IComputingService*>(ComputingComponent::createComponent());
 
-    // Getting the drug model
-    DrugModel* drugModel;
-    DrugModelImport drugModelImport;
-    DrugModelImport::Result importResult = drugModelImport.importFromFile(drugModel, "../tucuserver/drugs/ch.tucuxi.busulfan_children.xml");
-    if (importResult != DrugModelImport::Result::Ok) {
-        apiResponse->addError("DrugImportError", m_query.getLanguage(), "Error while importing drug model.");
+    // Getting the drug model, the snapshot keeps it alive even if the store is reloaded meanwhile
+    shared_ptr<const DrugModel> drugModel = m_drugModels->getDrugModel(drugID);
+    if (drugModel == nullptr) {
+        apiResponse->addError("UnknownDrugModel", m_query.getLanguage(), "No drug model available for drug " + drugID + ".");
+        m_result = move(apiResponse);
+        delete component;
         return;
     }
 
@@ -40,7 +40,7 @@ void AdjustmentComputer::compute()
     DrugTreatment drugTreatment;
 
     // Getting the dosage history for the drug treatment
-    const DosageTimeRangeList& dosageTimeRangeList = drugs.at(0)
+    const DosageTimeRangeList& dosageTimeRangeList = drugs.at(drugPosition)
                                                         ->getpTreatment()
                                                         .getpDosageHistory()
                                                         .getDosageTimeRanges();
@@ -69,9 +69,9 @@ void AdjustmentComputer::compute()
     }
 
     // Creating the adjustment trait
-    RequestResponseId requestResponseID = 1; //m_query.getRequests().at(0)->getRequestID();
-    Common::DateTime start = m_query.getRequests().at(0)->getpDateInterval().getStart();
-    Common::DateTime end = m_query.getRequests().at(0)->getpDateInterval().getEnd();
+    RequestResponseId requestResponseID = 1; //getRequest().getRequestID();
+    Common::DateTime start = getRequest().getpDateInterval().getStart();
+    Common::DateTime end = getRequest().getpDateInterval().getEnd();
     Common::DateTime adjustmentTime("2018-07-10T08:00:00", "%Y-%m-%dT%H:%M:%S");
     //Common::DateTime adjustmentTime = computeAdjustmentTime(drugTreatment);
 
@@ -80,7 +80,7 @@ void AdjustmentComputer::compute()
         end = start + Common::Duration(chrono::hours(24) * Configuration::getInstance()->getMaxDateInterval());
     }
 
-    string predictionType = m_query.getRequests().at(0)->getPredictionType();
+    string predictionType = getRequest().getPredictionType();
     PredictionParameterType predictionParameterType = PredictionParameterType::Population;
     if (predictionType == "population") {
         predictionParameterType = PredictionParameterType::Population;
@@ -145,7 +145,6 @@ void AdjustmentComputer::compute()
     m_result = move(apiResponse);
 
     // Delete all dynamically allocated objects
-    delete drugModel;
     delete component;
 }
 
@@ -2,6 +2,7 @@
 #define TUCUXI_SERVER_ADJUSTMENTCOMPUTER_H
 
 #include "computer.h"
+#include "drugmodelstore.h"
 
 #include "tucucore/computingservice/computingrequest.h"
 #include "tucucore/computingservice/computingresponse.h"
@@ -16,7 +17,7 @@ namespace Server {
 class AdjustmentComputer : public Computer
 {
 public:
-    AdjustmentComputer(const Query& _query);
+    AdjustmentComputer(const Query& _query, size_t _requestPosition, std::shared_ptr<const DrugModelSnapshot> _drugModels);
 
     void compute();
 
@@ -0,0 +1,184 @@
+#include "ChunkedResponse.h"
+
+#include <sstream>
+
+namespace Tucuxi {
+namespace Server {
+namespace API {
+
+bool acceptsGzip(const Pistache::Rest::Request& _request) {
+    Pistache::Optional<Pistache::Http::Header::Raw> acceptEncoding = _request.headers().tryGetRaw("Accept-Encoding");
+    if (acceptEncoding.isEmpty()) {
+        return false;
+    }
+
+    // Accept-Encoding: deflate, gzip;q=0.8, *;q=0.1 -- a zero quality refuses the coding.
+    std::istringstream codings(acceptEncoding.get().value());
+    std::string coding;
+    while (std::getline(codings, coding, ',')) {
+        std::string name = coding.substr(0, coding.find(';'));
+        name.erase(0, name.find_first_not_of(" \t"));
+        name.erase(name.find_last_not_of(" \t") + 1);
+        if (name != "gzip" && name != "x-gzip" && name != "*") {
+            continue;
+        }
+
+        size_t quality = coding.find("q=");
+        if (quality == std::string::npos) {
+            return true;
+        }
+        try {
+            return std::stod(coding.substr(quality + 2)) > 0;
+        } catch (std::exception&) {
+            return false;
+        }
+    }
+
+    return false;
+}
+
+Pistache::Http::ResponseStream startChunkedResponse(Pistache::Http::ResponseWriter& _response,
+                                                    Pistache::Http::Code _code,
+                                                    const Pistache::Http::Mime::MediaType& _mime,
+                                                    bool _gzip) {
+    _response.headers().add<Pistache::Http::Header::ContentType>(_mime);
+    if (_gzip) {
+        _response.headers().add<Pistache::Http::Header::ContentEncoding>(Pistache::Http::Header::Encoding::Gzip);
+    }
+
+    // The stream buffer holds one chunk and its framing, or the status line and the headers.
+    return _response.stream(_code, ChunkedResponseBuffer::m_sChunkSize + 64);
+}
+
+const size_t ChunkedResponseBuffer::m_sChunkSize = 16 * 1024;
+
+ChunkedResponseBuffer::ChunkedResponseBuffer(Pistache::Http::ResponseStream& _stream, bool _gzip)
+    : m_stream(_stream), m_gzip(_gzip), m_zStream(),
+      m_buffer(m_sChunkSize), m_pCopy(nullptr), m_maxCopySize(0), m_isCopyComplete(false),
+      m_isBroken(false), m_isFinished(false)
+{
+    setp(m_buffer.data(), m_buffer.data() + m_buffer.size());
+
+    if (m_gzip) {
+        m_compressedBuffer.resize(m_sChunkSize);
+        // 16 added to the window bits gives a gzip header and trailer instead of the zlib ones.
+        if (deflateInit2(&m_zStream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+            throw std::runtime_error("Cannot initialize the gzip compression");
+        }
+    }
+}
+
+ChunkedResponseBuffer::~ChunkedResponseBuffer()
+{
+    if (m_gzip) {
+        deflateEnd(&m_zStream);
+    }
+}
+
+void ChunkedResponseBuffer::setCopy(std::string* _pCopy, size_t _maxSize)
+{
+    m_pCopy = _pCopy;
+    m_maxCopySize = _maxSize;
+    m_isCopyComplete = true;
+}
+
+bool ChunkedResponseBuffer::isCopyComplete() const
+{
+    return m_pCopy != nullptr && m_isCopyComplete;
+}
+
+bool ChunkedResponseBuffer::finish()
+{
+    if (m_isFinished) {
+        return !m_isBroken;
+    }
+    m_isFinished = true;
+
+    if (!sendBuffer(true)) {
+        return false;
+    }
+
+    try {
+        m_stream.ends();
+    } catch (std::exception&) {
+        m_isBroken = true;
+    }
+
+    return !m_isBroken;
+}
+
+ChunkedResponseBuffer::int_type ChunkedResponseBuffer::overflow(int_type _character)
+{
+    if (m_isFinished || !sendBuffer(false)) {
+        return traits_type::eof();
+    }
+
+    if (!traits_type::eq_int_type(_character, traits_type::eof())) {
+        *pptr() = traits_type::to_char_type(_character);
+        pbump(1);
+    }
+
+    return traits_type::not_eof(_character);
+}
+
+int ChunkedResponseBuffer::sync()
+{
+    // The data is sent by whole chunks, flushing the ostream does not send a partial one.
+    return m_isBroken ? -1 : 0;
+}
+
+bool ChunkedResponseBuffer::sendBuffer(bool _finish)
+{
+    if (m_isBroken) {
+        return false;
+    }
+
+    size_t size = static_cast<size_t>(pptr() - pbase());
+    setp(m_buffer.data(), m_buffer.data() + m_buffer.size());
+
+    if (m_pCopy != nullptr && m_isCopyComplete) {
+        if (m_pCopy->size() + size <= m_maxCopySize) {
+            m_pCopy->append(m_buffer.data(), size);
+        } else {
+            m_isCopyComplete = false;
+            m_pCopy->clear();
+        }
+    }
+
+    if (!m_gzip) {
+        return size == 0 || sendChunk(m_buffer.data(), size);
+    }
+
+    m_zStream.next_in = reinterpret_cast<Bytef*>(m_buffer.data());
+    m_zStream.avail_in = static_cast<uInt>(size);
+    int result;
+    do {
+        m_zStream.next_out = reinterpret_cast<Bytef*>(m_compressedBuffer.data());
+        m_zStream.avail_out = static_cast<uInt>(m_compressedBuffer.size());
+        result = deflate(&m_zStream, _finish ? Z_FINISH : Z_NO_FLUSH);
+
+        size_t compressedSize = m_compressedBuffer.size() - m_zStream.avail_out;
+        if (compressedSize > 0 && !sendChunk(m_compressedBuffer.data(), compressedSize)) {
+            return false;
+        }
+    } while (m_zStream.avail_out == 0 || (_finish && result == Z_OK));
+
+    return true;
+}
+
+bool ChunkedResponseBuffer::sendChunk(const char* _data, size_t _size)
+{
+    try {
+        m_stream.write(_data, static_cast<std::streamsize>(_size));
+        m_stream.flush();
+    } catch (std::exception&) {
+        // The peer is gone, the rest of the body is dropped.
+        m_isBroken = true;
+    }
+
+    return !m_isBroken;
+}
+
+} // namespace API
+} // namespace Server
+} // namespace Tucuxi
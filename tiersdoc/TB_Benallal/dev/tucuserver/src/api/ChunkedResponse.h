@@ -0,0 +1,76 @@
+#ifndef TUCUXI_SERVER_CHUNKED_RESPONSE_H_
+#define TUCUXI_SERVER_CHUNKED_RESPONSE_H_
+
+#include <streambuf>
+#include <string>
+#include <vector>
+
+#include <zlib.h>
+
+#include <pistache/http.h>
+#include <pistache/http_headers.h>
+#include <pistache/router.h>
+
+namespace Tucuxi {
+namespace Server {
+namespace API {
+
+// Returns true if the Accept-Encoding header of the request allows a gzip encoded body.
+bool acceptsGzip(const Pistache::Rest::Request& _request);
+
+// Sets the Content-Type and, for a gzip body, the Content-Encoding headers, then sends the
+// status line and the headers. The body must then be written through a ChunkedResponseBuffer.
+Pistache::Http::ResponseStream startChunkedResponse(Pistache::Http::ResponseWriter& _response,
+                                                    Pistache::Http::Code _code,
+                                                    const Pistache::Http::Mime::MediaType& _mime,
+                                                    bool _gzip);
+
+// Output buffer sending the body of a response as HTTP chunks of about m_sChunkSize bytes,
+// compressed on the fly if gzip is requested. A std::ostream writing to the buffer fails
+// once the client went away, so that the writer can stop early.
+class ChunkedResponseBuffer : public std::streambuf
+{
+public:
+    ChunkedResponseBuffer(Pistache::Http::ResponseStream& _stream, bool _gzip);
+    ChunkedResponseBuffer(ChunkedResponseBuffer& other) = delete;
+    ~ChunkedResponseBuffer();
+
+    // Keeps a copy of the uncompressed body in _pCopy, as long as it does not exceed _maxSize bytes.
+    void setCopy(std::string* _pCopy, size_t _maxSize);
+    bool isCopyComplete() const;
+
+    // Sends the remaining data and the last chunk.
+    // Returns false if the body could not be sent entirely.
+    bool finish();
+
+    static const size_t m_sChunkSize;
+
+protected:
+    int_type overflow(int_type _character) override;
+    int sync() override;
+
+    bool sendBuffer(bool _finish);
+    bool sendChunk(const char* _data, size_t _size);
+
+protected:
+    Pistache::Http::ResponseStream& m_stream;
+    const bool m_gzip;
+    z_stream m_zStream;
+
+    // Uncompressed data not yet sent, and the compressed data for gzip.
+    std::vector<char> m_buffer;
+    std::vector<char> m_compressedBuffer;
+
+    std::string* m_pCopy;
+    size_t m_maxCopySize;
+    bool m_isCopyComplete;
+
+    bool m_isBroken;
+    bool m_isFinished;
+};
+
+} // namespace API
+} // namespace Server
+} // namespace Tucuxi
+
+#endif /* TUCUXI_SERVER_CHUNKED_RESPONSE_H_ */
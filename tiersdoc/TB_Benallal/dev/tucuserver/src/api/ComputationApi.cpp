@@ -17,26 +17,173 @@ namespace Server {
 namespace API {
 
 ComputationApi::ComputationApi(std::shared_ptr<Pistache::Http::Endpoint> _pEndpoint, std::shared_ptr<Pistache::Rest::Router> _pRouter)
-    : m_httpEndpoint(_pEndpoint), m_router(_pRouter)
+    : m_pComputationMetrics(nullptr), m_httpEndpoint(_pEndpoint), m_router(_pRouter)
 { };
 
 void ComputationApi::setupRoutes() {
     using namespace Pistache::Rest;
 
     Routes::Post(*m_router, m_base + "/computation", Routes::bind(&ComputationApi::compute_requests_handler, this));
+    Routes::Get(*m_router, m_base + "/computation/cache", Routes::bind(&ComputationApi::get_cache_stats_handler, this));
+
+    m_pComputationMetrics = &Metrics::getInstance()->registerRoute("POST", "/computation");
+    Metrics::getInstance()->registerRoute("GET", "/computation/cache");
 }
 
 void ComputationApi::compute_requests_handler(const Pistache::Rest::Request& _request, Pistache::Http::ResponseWriter _response) {
-    
-    try {
-        XMLReader xmlReader(_request.body());
-        this->compute_requests(xmlReader.getQuery(), _response);
-    } catch (std::runtime_error& e) {
-      //send a 400 error
-      _response.send(Pistache::Http::Code::Bad_Request, e.what());
-      return;
+
+    // The parsing and the computation run on the worker pool, the reactor thread only hands the request over.
+    std::shared_ptr<RequestScope> pScope = std::make_shared<RequestScope>(*m_pComputationMetrics);
+    std::string body = _request.body();
+    ComputationFormat format = getComputationFormat(_request);
+
+    Pistache::Optional<std::string> async = _request.query().get("async");
+    if (!async.isEmpty() && async.get() == "true") {
+        submit_job(body, format, _response);
+        return;
+    }
+
+    dispatchToWorkers(std::move(_response), [this, body, format, pScope](Pistache::Http::ResponseWriter& _workerResponse) {
+
+        // The drug models are taken once, the cache key and all the requests of the query use the same ones.
+        std::shared_ptr<const DrugModelSnapshot> drugModels = DrugModelStore::getInstance()->getSnapshot();
+        ResponseCache* responseCache = ResponseCache::getInstance();
+
+        // The query is parsed once, the canonical form of the parsed document is its cache key.
+        // A JSON dump has sorted members, an XML document is written back without formatting.
+        std::chrono::steady_clock::time_point parseStart = std::chrono::steady_clock::now();
+        nlohmann::json jsonQuery;
+        Common::XmlDocument xmlQuery;
+        std::string canonicalQuery;
+        if (format.m_isJsonQuery) {
+            try {
+                jsonQuery = nlohmann::json::parse(body);
+            } catch (nlohmann::json::parse_error& e) {
+                _workerResponse.send(Pistache::Http::Code::Bad_Request, e.what());
+                return;
+            }
+            if (responseCache->isEnabled()) {
+                canonicalQuery = jsonQuery.dump();
+            }
+        } else {
+            if (!xmlQuery.fromString(body)) {
+                _workerResponse.send(Pistache::Http::Code::Bad_Request, "Invalid XML query");
+                return;
+            }
+            if (responseCache->isEnabled()) {
+                canonicalQuery = ResponseCache::canonicalizeXmlQuery(xmlQuery);
+            }
+        }
+
+        // A query already answered with the same drug models is served from the cache,
+        // without reading it into a Query nor computing it again.
+        const Pistache::Http::Mime::MediaType mime = format.m_isJsonResponse ? MIME(Application, Json) : MIME(Application, Xml);
+        std::string cacheKey;
+        if (!canonicalQuery.empty()) {
+            cacheKey = ResponseCache::makeKey(canonicalQuery, drugModels->getVersion(), mime.toString());
+
+            std::shared_ptr<const std::string> cachedResponse = responseCache->get(cacheKey);
+            if (cachedResponse != nullptr) {
+                Pistache::Http::ResponseStream stream = startChunkedResponse(_workerResponse, Pistache::Http::Code::Ok, mime, format.m_isGzip);
+                ChunkedResponseBuffer buffer(stream, format.m_isGzip);
+                buffer.sputn(cachedResponse->data(), static_cast<std::streamsize>(cachedResponse->size()));
+                buffer.finish();
+                return;
+            }
+        }
+
+        try {
+            if (format.m_isJsonQuery) {
+                JSONReader jsonReader(jsonQuery);
+                m_pComputationMetrics->observePhase(Phase::Parse, std::chrono::steady_clock::now() - parseStart);
+
+                this->compute_requests(jsonReader.getQuery(), drugModels, cacheKey, format, _workerResponse);
+            } else {
+                XMLReader xmlReader(xmlQuery);
+                m_pComputationMetrics->observePhase(Phase::Parse, std::chrono::steady_clock::now() - parseStart);
+
+                this->compute_requests(xmlReader.getQuery(), drugModels, cacheKey, format, _workerResponse);
+            }
+        } catch (std::runtime_error& e) {
+          //send a 400 error
+          _workerResponse.send(Pistache::Http::Code::Bad_Request, e.what());
+        }
+    });
+}
+
+void ComputationApi::submit_job(const std::string& _body, const ComputationFormat& _format, Pistache::Http::ResponseWriter& _response) {
+
+    std::shared_ptr<Job> pJob = JobStore::getInstance()->create(_format.m_isJsonResponse);
+    if (pJob == nullptr) {
+        sendBusy(_response, "Too many jobs, retry later.");
+        return;
+    }
+
+    // The job is answered by the client polling it, the task never touches the response.
+    bool accepted = WorkerPool::getInstance()->trySubmit([this, _body, _format, pJob]() {
+        if (!pJob->start()) {
+            return;
+        }
+
+        // All the requests of the job use the drug models of its start.
+        std::shared_ptr<const DrugModelSnapshot> drugModels = DrugModelStore::getInstance()->getSnapshot();
+
+        try {
+            std::chrono::steady_clock::time_point parseStart = std::chrono::steady_clock::now();
+            if (_format.m_isJsonQuery) {
+                JSONReader jsonReader(_body);
+                m_pComputationMetrics->observePhase(Phase::Parse, std::chrono::steady_clock::now() - parseStart);
+
+                this->compute_job(jsonReader.getQuery(), drugModels, _format, *pJob);
+            } else {
+                XMLReader xmlReader(_body);
+                m_pComputationMetrics->observePhase(Phase::Parse, std::chrono::steady_clock::now() - parseStart);
+
+                this->compute_job(xmlReader.getQuery(), drugModels, _format, *pJob);
+            }
+        } catch (std::exception& e) {
+            pJob->fail(e.what());
+        }
+    });
+
+    if (!accepted) {
+        JobStore::getInstance()->cancel(pJob->getId());
+        sendBusy(_response, "The server is busy, retry later.");
+        return;
+    }
+
+    _response.headers().addRaw(Pistache::Http::Header::Raw("Location", "/jobs/" + pJob->getId()));
+    sendJobStatus(*pJob, Pistache::Http::Code::Accepted, _response);
+}
+
+void ComputationApi::get_cache_stats_handler(const Pistache::Rest::Request& _request, Pistache::Http::ResponseWriter _response) {
+    UNUSED(_request);
+    RequestScope scope(Metrics::getInstance()->getRoute("GET", "/computation/cache"));
+    this->get_cache_stats(_response);
+}
+
+ComputationFormat ComputationApi::getComputationFormat(const Pistache::Rest::Request& _request) {
+    ComputationFormat format;
+
+    std::shared_ptr<const Pistache::Http::Header::ContentType> contentType = _request.headers().tryGet<Pistache::Http::Header::ContentType>();
+    format.m_isJsonQuery = contentType != nullptr && contentType->mime() == MIME(Application, Json);
+
+    // Without preference of the client, the response has the format of the query.
+    // The qualities are not weighted, the first of the two types listed in Accept wins.
+    format.m_isJsonResponse = format.m_isJsonQuery;
+    Pistache::Optional<Pistache::Http::Header::Raw> accept = _request.headers().tryGetRaw("Accept");
+    if (!accept.isEmpty()) {
+        const std::string& types = accept.get().value();
+        size_t json = types.find("application/json");
+        size_t xml = types.find("application/xml");
+        if (json != xml) {
+            format.m_isJsonResponse = json < xml;
+        }
     }
 
+    format.m_isGzip = acceptsGzip(_request);
+
+    return format;
 }
 
 void ComputationApi::computation_api_default_handler(const Pistache::Rest::Request& _request, Pistache::Http::ResponseWriter _response) {
@@ -26,11 +26,28 @@
 
 #include "../communication/query.h"
 #include "../communication/xmlreader.h"
+#include "../communication/jsonreader.h"
+#include "../drugmodelstore.h"
+#include "../metrics.h"
+#include "../responsecache.h"
+#include "../jobstore.h"
+#include "ChunkedResponse.h"
+#include "JobsApi.h"
+#include "WorkerDispatch.h"
 
 namespace Tucuxi {
 namespace Server {
 namespace API {
 
+// Formats of a computation query and of its response, negotiated from the Content-Type,
+// Accept and Accept-Encoding headers of the request.
+struct ComputationFormat
+{
+    bool m_isJsonQuery;
+    bool m_isJsonResponse;
+    bool m_isGzip;
+};
+
 class  ComputationApi {
 public:
     ComputationApi(std::shared_ptr<Pistache::Http::Endpoint> _pEndpoint, std::shared_ptr<Pistache::Rest::Router> _pRouter);
@@ -40,20 +57,55 @@ public:
 
 private:
     void compute_requests_handler(const Pistache::Rest::Request& _request, Pistache::Http::ResponseWriter _response);
+    void submit_job(const std::string& _body, const ComputationFormat& _format, Pistache::Http::ResponseWriter& _response);
+    void get_cache_stats_handler(const Pistache::Rest::Request& _request, Pistache::Http::ResponseWriter _response);
     void computation_api_default_handler(const Pistache::Rest::Request& _request, Pistache::Http::ResponseWriter _response);
 
+    static ComputationFormat getComputationFormat(const Pistache::Rest::Request& _request);
+
     /// <summary>
     /// Send requests to process
     /// </summary>
     /// <remarks>
-    /// Send a list of requests in XML format following the query.xsd definition.
+    /// Send a list of requests in XML format following the query.xsd definition,
+    /// or in JSON with the same structure. The response is in JSON if the client accepts it.
+    /// With ?async=true, the query is computed as a job and its identifier is returned at once.
     /// </remarks>
     /// <param name="body">Query object containing the list of requests</param>
-    virtual void compute_requests(const Query& _query, Pistache::Http::ResponseWriter& _response) = 0;
+    /// <param name="_drugModels">Drug models the cache key was built with, used for all the requests</param>
+    /// <param name="_cacheKey">Key under which the response is cached, empty if it must not be cached</param>
+    /// <param name="_format">Formats of the response negotiated with the client</param>
+    virtual void compute_requests(const Query& _query, std::shared_ptr<const DrugModelSnapshot> _drugModels, const std::string& _cacheKey, const ComputationFormat& _format, Pistache::Http::ResponseWriter& _response) = 0;
+
+    /// <summary>
+    /// Compute the requests of an asynchronous job
+    /// </summary>
+    /// <remarks>
+    /// Runs on a worker of the pool and stores the serialized response in the job,
+    /// unless the job is cancelled meanwhile.
+    /// </remarks>
+    /// <param name="body">Query object containing the list of requests</param>
+    /// <param name="_drugModels">Drug models used for all the requests</param>
+    /// <param name="_format">Formats of the response negotiated with the client</param>
+    /// <param name="_job">Job receiving the response</param>
+    virtual void compute_job(const Query& _query, std::shared_ptr<const DrugModelSnapshot> _drugModels, const ComputationFormat& _format, Job& _job) = 0;
+
+    /// <summary>
+    /// Get the statistics of the response cache
+    /// </summary>
+    /// <remarks>
+    /// Returns the size of the cache and its numbers of hits, misses, evictions and expirations.
+    /// </remarks>
+    virtual void get_cache_stats(Pistache::Http::ResponseWriter& _response) = 0;
 
 public:
     const std::string m_base = "/";
 
+protected:
+    // Metrics of the computation route, the phases of its queries are measured in it,
+    // whether they are answered at once or as jobs.
+    RouteMetrics* m_pComputationMetrics;
+
 private:
     std::shared_ptr<Pistache::Http::Endpoint> m_httpEndpoint;
     std::shared_ptr<Pistache::Rest::Router> m_router;
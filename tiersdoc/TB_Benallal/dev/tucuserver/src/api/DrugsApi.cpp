@@ -25,57 +25,59 @@ void DrugsApi::setupRoutes() {
 
     Routes::Get(*m_router, base + "/drugs", Routes::bind(&DrugsApi::list_drugs_handler, this));
     Routes::Post(*m_router, base + "/drugs", Routes::bind(&DrugsApi::add_drug_handler, this));
+    Routes::Post(*m_router, base + "/drugs/reload", Routes::bind(&DrugsApi::reload_drugs_handler, this));
     Routes::Delete(*m_router, base + "/drugs/:drugID", Routes::bind(&DrugsApi::delete_drug_handler, this));
     Routes::Put(*m_router, base + "/drugs/:drugID", Routes::bind(&DrugsApi::edit_drug_handler, this));
     Routes::Get(*m_router, base + "/drugs/:drugID", Routes::bind(&DrugsApi::get_drug_handler, this));
+
+    Metrics::getInstance()->registerRoute("GET", "/drugs");
+    Metrics::getInstance()->registerRoute("POST", "/drugs");
+    Metrics::getInstance()->registerRoute("POST", "/drugs/reload");
+    Metrics::getInstance()->registerRoute("DELETE", "/drugs/:drugID");
+    Metrics::getInstance()->registerRoute("PUT", "/drugs/:drugID");
+    Metrics::getInstance()->registerRoute("GET", "/drugs/:drugID");
 }
 
 void DrugsApi::add_drug_handler(const Pistache::Rest::Request& _request, Pistache::Http::ResponseWriter _response) {
 
-    try {
-        // TODO change the reader to a drug file reader
-        XMLReader xmlReader(_request.body());
-        this->add_drug(xmlReader.getQuery(), _response);
-    } catch (std::runtime_error&  e) {
-      //send a 400 error
-      _response.send(Pistache::Http::Code::Bad_Request, e.what());
-      return;
-    }
+    // Importing the drug model takes time, it must not block the reactor thread.
+    std::shared_ptr<RequestScope> pScope = std::make_shared<RequestScope>(Metrics::getInstance()->getRoute("POST", "/drugs"));
+    std::string body = _request.body();
+
+    dispatchToWorkers(std::move(_response), [this, body, pScope](Pistache::Http::ResponseWriter& _workerResponse) {
+        this->add_drug(body, _workerResponse);
+    });
 
 }
 void DrugsApi::delete_drug_handler(const Pistache::Rest::Request& _request, Pistache::Http::ResponseWriter _response) {
     // Getting the path params
     std::string drugID = _request.param(":drugID").as<std::string>();
-    
-    try {
-      this->delete_drug(drugID, _response);
-    } catch (std::runtime_error&  e) {
-      //send a 400 error
-      _response.send(Pistache::Http::Code::Bad_Request, e.what());
-      return;
-    }
+    std::shared_ptr<RequestScope> pScope = std::make_shared<RequestScope>(Metrics::getInstance()->getRoute("DELETE", "/drugs/:drugID"));
+
+    dispatchToWorkers(std::move(_response), [this, drugID, pScope](Pistache::Http::ResponseWriter& _workerResponse) {
+        this->delete_drug(drugID, _workerResponse);
+    });
 
 }
 void DrugsApi::edit_drug_handler(const Pistache::Rest::Request& _request, Pistache::Http::ResponseWriter _response) {
     // Getting the path params
     std::string drugID = _request.param(":drugID").as<std::string>();
-    
-    try {
-        XMLReader xmlReader(_request.body());
-        this->edit_drug(drugID, xmlReader.getQuery(), _response);
-    } catch (std::runtime_error&  e) {
-      //send a 400 error
-      _response.send(Pistache::Http::Code::Bad_Request, e.what());
-      return;
-    }
+    std::string body = _request.body();
+    std::shared_ptr<RequestScope> pScope = std::make_shared<RequestScope>(Metrics::getInstance()->getRoute("PUT", "/drugs/:drugID"));
+
+    dispatchToWorkers(std::move(_response), [this, drugID, body, pScope](Pistache::Http::ResponseWriter& _workerResponse) {
+        this->edit_drug(drugID, body, _workerResponse);
+    });
 
 }
 void DrugsApi::get_drug_handler(const Pistache::Rest::Request& _request, Pistache::Http::ResponseWriter _response) {
     // Getting the path params
     std::string drugID = _request.param(":drugID").as<std::string>();
-    
+
+    // The summaries are precomputed, they are served directly from the reactor thread.
+    RequestScope scope(Metrics::getInstance()->getRoute("GET", "/drugs/:drugID"));
     try {
-      this->get_drug(drugID, _response);
+      this->get_drug(drugID, getIfNoneMatch(_request), _response);
     } catch (std::runtime_error&  e) {
       //send a 400 error
       _response.send(Pistache::Http::Code::Bad_Request, e.what());
@@ -85,9 +87,9 @@ void DrugsApi::get_drug_handler(const Pistache::Rest::Request& _request, Pistach
 }
 void DrugsApi::list_drugs_handler(const Pistache::Rest::Request& _request, Pistache::Http::ResponseWriter _response) {
 
-    UNUSED(_request);
+    RequestScope scope(Metrics::getInstance()->getRoute("GET", "/drugs"));
     try {
-      this->list_drugs(_response);
+      this->list_drugs(getIfNoneMatch(_request), _response);
     } catch (std::runtime_error&  e) {
       //send a 400 error
       _response.send(Pistache::Http::Code::Bad_Request, e.what());
@@ -96,11 +98,33 @@ void DrugsApi::list_drugs_handler(const Pistache::Rest::Request& _request, Pista
 
 }
 
+void DrugsApi::reload_drugs_handler(const Pistache::Rest::Request& _request, Pistache::Http::ResponseWriter _response) {
+
+    UNUSED(_request);
+
+    // Importing the drug files takes time, it must not block the reactor thread.
+    std::shared_ptr<RequestScope> pScope = std::make_shared<RequestScope>(Metrics::getInstance()->getRoute("POST", "/drugs/reload"));
+
+    dispatchToWorkers(std::move(_response), [this, pScope](Pistache::Http::ResponseWriter& _workerResponse) {
+        this->reload_drugs(_workerResponse);
+    });
+
+}
+
 void DrugsApi::drugs_api_default_handler(const Pistache::Rest::Request& _request, Pistache::Http::ResponseWriter _response) {
     UNUSED(_request);
     _response.send(Pistache::Http::Code::Not_Found, "The requested method does not exist (DrugsApi)");
 }
 
+std::string DrugsApi::getIfNoneMatch(const Pistache::Rest::Request& _request) {
+    Pistache::Optional<Pistache::Http::Header::Raw> ifNoneMatch = _request.headers().tryGetRaw("If-None-Match");
+    if (ifNoneMatch.isEmpty()) {
+        return "";
+    }
+
+    return ifNoneMatch.get().value();
+}
+
 } // namespace API
 } // namespace Server
 } // namespace Tucuxi
@@ -26,6 +26,8 @@
 
 #include "../communication/query.h"
 #include "../communication/xmlreader.h"
+#include "../metrics.h"
+#include "WorkerDispatch.h"
 
 #include <string>
 
@@ -46,8 +48,11 @@ private:
     void edit_drug_handler(const Pistache::Rest::Request& _request, Pistache::Http::ResponseWriter _response);
     void get_drug_handler(const Pistache::Rest::Request& _request, Pistache::Http::ResponseWriter _response);
     void list_drugs_handler(const Pistache::Rest::Request& _request, Pistache::Http::ResponseWriter _response);
+    void reload_drugs_handler(const Pistache::Rest::Request& _request, Pistache::Http::ResponseWriter _response);
     void drugs_api_default_handler(const Pistache::Rest::Request& _request, Pistache::Http::ResponseWriter _response);
 
+    static std::string getIfNoneMatch(const Pistache::Rest::Request& _request);
+
 
     /// <summary>
     /// Adds a new drug.
@@ -55,8 +60,8 @@ private:
     /// <remarks>
     /// Adds a new drug to the list of the ones managed by the server.
     /// </remarks>
-    /// <param name="_query">XML desciption of a drug.</param>
-    virtual void add_drug(const Query& _query, Pistache::Http::ResponseWriter& _response) = 0;
+    /// <param name="_drugModelXml">XML desciption of a drug.</param>
+    virtual void add_drug(const std::string& _drugModelXml, Pistache::Http::ResponseWriter& _response) = 0;
 
     /// <summary>
     /// Delete the desired drug.
@@ -74,8 +79,8 @@ private:
     /// Changes the XML drug desciption file with the one sent.
     /// </remarks>
     /// <param name="_drugID">Unique identifier of the drug.</param>
-    /// <param name="_query">New XML drug desciption file.</param>
-    virtual void edit_drug(const std::string& _drugID, const Query& _query, Pistache::Http::ResponseWriter& _response) = 0;
+    /// <param name="_drugModelXml">New XML drug desciption file.</param>
+    virtual void edit_drug(const std::string& _drugID, const std::string& _drugModelXml, Pistache::Http::ResponseWriter& _response) = 0;
 
     /// <summary>
     /// Get the desired drug
@@ -84,7 +89,8 @@ private:
     /// Returns the desired drug XML header node.
     /// </remarks>
     /// <param name="_drugID">Unique identifier of the drug.</param>
-    virtual void get_drug(const std::string& _drugID, Pistache::Http::ResponseWriter& _response) = 0;
+    /// <param name="_ifNoneMatch">Value of the If-None-Match header, empty if absent.</param>
+    virtual void get_drug(const std::string& _drugID, const std::string& _ifNoneMatch, Pistache::Http::ResponseWriter& _response) = 0;
 
     /// <summary>
     /// Returns the list of all supported drugs
@@ -92,7 +98,16 @@ private:
     /// <remarks>
     /// Returns the header node of each XML drug desciption file that the server is able to manage.
     /// </remarks>
-    virtual void list_drugs(Pistache::Http::ResponseWriter& _response) = 0;
+    /// <param name="_ifNoneMatch">Value of the If-None-Match header, empty if absent.</param>
+    virtual void list_drugs(const std::string& _ifNoneMatch, Pistache::Http::ResponseWriter& _response) = 0;
+
+    /// <summary>
+    /// Reloads the drugs from the drugs directory
+    /// </summary>
+    /// <remarks>
+    /// Loads again every XML drug desciption file of the drugs directory and replaces the drugs managed by the server.
+    /// </remarks>
+    virtual void reload_drugs(Pistache::Http::ResponseWriter& _response) = 0;
 
 public:
     const std::string base = "/";
@@ -27,12 +27,16 @@ void HelloApi::setupRoutes() {
     Routes::Get(*m_router, base + "/hello", Routes::bind(&HelloApi::hello_world_handler, this));
     Routes::Post(*m_router, base + "/hello", Routes::bind(&HelloApi::test_query_handler, this));
 
+    Metrics::getInstance()->registerRoute("GET", "/hello");
+    Metrics::getInstance()->registerRoute("POST", "/hello");
+
     // Default handler, called when a route is not found
     m_router->addCustomHandler(Routes::bind(&HelloApi::hello_api_default_handler, this));
 }
 
 void HelloApi::hello_world_handler(const Pistache::Rest::Request& _request, Pistache::Http::ResponseWriter _response) {
     UNUSED(_request);
+    RequestScope scope(Metrics::getInstance()->getRoute("GET", "/hello"));
     try {
       this->hello_world(_response);
     } catch (std::runtime_error&  e) {
@@ -45,6 +49,7 @@ void HelloApi::hello_world_handler(const Pistache::Rest::Request& _request, Pist
 
 void HelloApi::test_query_handler(const Pistache::Rest::Request& _request, Pistache::Http::ResponseWriter _response) {
 
+    RequestScope scope(Metrics::getInstance()->getRoute("POST", "/hello"));
     try {
         XMLReader xmlReader(_request.body());
         this->test_query(xmlReader.getQuery(), _response);
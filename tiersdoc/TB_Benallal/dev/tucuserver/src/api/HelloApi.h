@@ -29,6 +29,7 @@
 #include "../communication/query.h"
 #include "../communication/xmlreader.h"
 #include "rapidxml.hpp"
+#include "../metrics.h"
 
 namespace Tucuxi {
 namespace Server {
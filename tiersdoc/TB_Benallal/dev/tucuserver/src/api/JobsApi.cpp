@@ -0,0 +1,88 @@
+/**
+* Tucuxi TDM server
+* This is the Tucuxi TDM server.
+*
+* OpenAPI spec version: 1.0.0
+* Contact: nadir.benallal@heig-vd.ch
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/swagger-api/swagger-codegen.git
+* Do not edit the class manually.
+*/
+
+#include "JobsApi.h"
+
+#include <sstream>
+
+#include "../communication/jsonstreamwriter.h"
+#include "../communication/xmlstreamwriter.h"
+
+namespace Tucuxi {
+namespace Server {
+namespace API {
+
+void sendJobStatus(const Job& _job, Pistache::Http::Code _code, Pistache::Http::ResponseWriter& _response) {
+    Job::Status status = _job.getStatus();
+    std::ostringstream output;
+
+    if (_job.isJsonResponse()) {
+        JsonStreamWriter writer(output, false);
+        writer.startObject();
+        writer.writeString("id", _job.getId());
+        writer.writeString("status", Job::toString(status));
+        if (status == Job::Status::Failed) {
+            writer.writeString("error", _job.getError());
+        }
+        writer.endObject();
+        _response.send(_code, output.str(), MIME(Application, Json));
+    } else {
+        XmlStreamWriter writer(output, false);
+        writer.startElement("job");
+        writer.writeElement("id", _job.getId());
+        writer.writeElement("status", Job::toString(status));
+        if (status == Job::Status::Failed) {
+            writer.writeElement("error", _job.getError());
+        }
+        writer.endElement();
+        _response.send(_code, output.str(), MIME(Application, Xml));
+    }
+}
+
+JobsApi::JobsApi(std::shared_ptr<Pistache::Http::Endpoint> _pEndpoint, std::shared_ptr<Pistache::Rest::Router> _pRouter)
+    : m_httpEndpoint(_pEndpoint), m_router(_pRouter)
+{ };
+
+void JobsApi::setupRoutes() {
+    using namespace Pistache::Rest;
+
+    Routes::Get(*m_router, m_base + "/jobs/:jobID", Routes::bind(&JobsApi::get_job_handler, this));
+    Routes::Delete(*m_router, m_base + "/jobs/:jobID", Routes::bind(&JobsApi::cancel_job_handler, this));
+
+    Metrics::getInstance()->registerRoute("GET", "/jobs/:jobID");
+    Metrics::getInstance()->registerRoute("DELETE", "/jobs/:jobID");
+}
+
+void JobsApi::get_job_handler(const Pistache::Rest::Request& _request, Pistache::Http::ResponseWriter _response) {
+    // Getting the path params
+    std::string jobID = _request.param(":jobID").as<std::string>();
+    bool isGzip = acceptsGzip(_request);
+    std::shared_ptr<RequestScope> pScope = std::make_shared<RequestScope>(Metrics::getInstance()->getRoute("GET", "/jobs/:jobID"));
+
+    // Compressing a large result must not block the reactor thread.
+    dispatchToWorkers(std::move(_response), [this, jobID, isGzip, pScope](Pistache::Http::ResponseWriter& _workerResponse) {
+        this->get_job(jobID, isGzip, _workerResponse);
+    });
+}
+
+void JobsApi::cancel_job_handler(const Pistache::Rest::Request& _request, Pistache::Http::ResponseWriter _response) {
+    // Getting the path params
+    std::string jobID = _request.param(":jobID").as<std::string>();
+    RequestScope scope(Metrics::getInstance()->getRoute("DELETE", "/jobs/:jobID"));
+
+    this->cancel_job(jobID, _response);
+}
+
+} // namespace API
+} // namespace Server
+} // namespace Tucuxi
+
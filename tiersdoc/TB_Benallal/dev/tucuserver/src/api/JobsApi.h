@@ -0,0 +1,86 @@
+/**
+* Tucuxi TDM server
+* This is the Tucuxi TDM server.
+*
+* OpenAPI spec version: 1.0.0
+* Contact: nadir.benallal@heig-vd.ch
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/swagger-api/swagger-codegen.git
+* Do not edit the class manually.
+*/
+/*
+ * JobsApi.h
+ *
+ * 
+ */
+
+#ifndef TUCUXI_SERVER_JOBS_API_H_
+#define TUCUXI_SERVER_JOBS_API_H_
+
+
+#include <pistache/endpoint.h>
+#include <pistache/http.h>
+#include <pistache/router.h>
+#include <pistache/http_headers.h>
+
+#include "../jobstore.h"
+#include "../metrics.h"
+#include "ChunkedResponse.h"
+#include "WorkerDispatch.h"
+
+#include <string>
+
+namespace Tucuxi {
+namespace Server {
+namespace API {
+
+// Sends the identifier and the status of a job, plus its error if it failed,
+// in JSON or XML according to the format of the response requested for the job.
+void sendJobStatus(const Job& _job, Pistache::Http::Code _code, Pistache::Http::ResponseWriter& _response);
+
+class  JobsApi {
+public:
+    JobsApi(std::shared_ptr<Pistache::Http::Endpoint> _pEndpoint, std::shared_ptr<Pistache::Rest::Router> _pRouter);
+    virtual ~JobsApi() {}
+
+    void setupRoutes();
+
+private:
+    void get_job_handler(const Pistache::Rest::Request& _request, Pistache::Http::ResponseWriter _response);
+    void cancel_job_handler(const Pistache::Rest::Request& _request, Pistache::Http::ResponseWriter _response);
+
+    /// <summary>
+    /// Get the desired job
+    /// </summary>
+    /// <remarks>
+    /// Returns the response of the computation if the job is done, its status otherwise.
+    /// </remarks>
+    /// <param name="_jobID">Unique identifier of the job.</param>
+    /// <param name="_isGzip">True if the client accepts a gzip encoded response.</param>
+    virtual void get_job(const std::string& _jobID, bool _isGzip, Pistache::Http::ResponseWriter& _response) = 0;
+
+    /// <summary>
+    /// Cancel the desired job
+    /// </summary>
+    /// <remarks>
+    /// Cancels the computation if it is not finished and forgets the job.
+    /// </remarks>
+    /// <param name="_jobID">Unique identifier of the job.</param>
+    virtual void cancel_job(const std::string& _jobID, Pistache::Http::ResponseWriter& _response) = 0;
+
+public:
+    const std::string m_base = "/";
+
+private:
+    std::shared_ptr<Pistache::Http::Endpoint> m_httpEndpoint;
+    std::shared_ptr<Pistache::Rest::Router> m_router;
+
+};
+
+} // namespace API
+} // namespace Server
+} // namespace Tucuxi
+
+#endif /* TUCUXI_SERVER_JOBS_API_H_ */
+
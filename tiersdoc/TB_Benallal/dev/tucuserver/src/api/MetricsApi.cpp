@@ -0,0 +1,40 @@
+/**
+* Tucuxi TDM server
+* This is the Tucuxi TDM server.
+*
+* OpenAPI spec version: 1.0.0
+* Contact: nadir.benallal@heig-vd.ch
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/swagger-api/swagger-codegen.git
+* Do not edit the class manually.
+*/
+
+#include "MetricsApi.h"
+
+namespace Tucuxi {
+namespace Server {
+namespace API {
+
+MetricsApi::MetricsApi(std::shared_ptr<Pistache::Http::Endpoint> _pEndpoint, std::shared_ptr<Pistache::Rest::Router> _pRouter)
+    : m_httpEndpoint(_pEndpoint), m_router(_pRouter)
+{ };
+
+void MetricsApi::setupRoutes() {
+    using namespace Pistache::Rest;
+
+    Routes::Get(*m_router, m_base + "/metrics", Routes::bind(&MetricsApi::get_metrics_handler, this));
+
+    Metrics::getInstance()->registerRoute("GET", "/metrics");
+}
+
+void MetricsApi::get_metrics_handler(const Pistache::Rest::Request& _request, Pistache::Http::ResponseWriter _response) {
+    UNUSED(_request);
+    RequestScope scope(Metrics::getInstance()->getRoute("GET", "/metrics"));
+    this->get_metrics(_response);
+}
+
+} // namespace API
+} // namespace Server
+} // namespace Tucuxi
+
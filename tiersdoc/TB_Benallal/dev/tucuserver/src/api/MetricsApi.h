@@ -0,0 +1,65 @@
+/**
+* Tucuxi TDM server
+* This is the Tucuxi TDM server.
+*
+* OpenAPI spec version: 1.0.0
+* Contact: nadir.benallal@heig-vd.ch
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/swagger-api/swagger-codegen.git
+* Do not edit the class manually.
+*/
+/*
+ * MetricsApi.h
+ *
+ * 
+ */
+
+#ifndef TUCUXI_SERVER_METRICS_API_H_
+#define TUCUXI_SERVER_METRICS_API_H_
+
+
+#include <pistache/endpoint.h>
+#include <pistache/http.h>
+#include <pistache/router.h>
+#include <pistache/http_headers.h>
+
+#include "../metrics.h"
+
+namespace Tucuxi {
+namespace Server {
+namespace API {
+
+class  MetricsApi {
+public:
+    MetricsApi(std::shared_ptr<Pistache::Http::Endpoint> _pEndpoint, std::shared_ptr<Pistache::Rest::Router> _pRouter);
+    virtual ~MetricsApi() {}
+
+    void setupRoutes();
+
+private:
+    void get_metrics_handler(const Pistache::Rest::Request& _request, Pistache::Http::ResponseWriter _response);
+
+    /// <summary>
+    /// Returns the metrics of the server
+    /// </summary>
+    /// <remarks>
+    /// Returns the request counters, the latency histograms and the state of the worker pool and of the caches, in the Prometheus text format.
+    /// </remarks>
+    virtual void get_metrics(Pistache::Http::ResponseWriter& _response) = 0;
+
+public:
+    const std::string m_base = "/";
+
+private:
+    std::shared_ptr<Pistache::Http::Endpoint> m_httpEndpoint;
+    std::shared_ptr<Pistache::Rest::Router> m_router;
+
+};
+
+} // namespace API
+} // namespace Server
+} // namespace Tucuxi
+
+#endif /* TUCUXI_SERVER_METRICS_API_H_ */
+
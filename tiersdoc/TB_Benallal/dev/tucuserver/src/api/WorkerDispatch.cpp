@@ -0,0 +1,47 @@
+#include "WorkerDispatch.h"
+
+namespace Tucuxi {
+namespace Server {
+namespace API {
+
+void dispatchToWorkers(Pistache::Http::ResponseWriter _response, ResponseTask _task) {
+
+    // std::function needs a copyable callable, the writer is shared with the task.
+    std::shared_ptr<Pistache::Http::ResponseWriter> pResponse = std::make_shared<Pistache::Http::ResponseWriter>(std::move(_response));
+
+    // A request that waited longer than the queue timeout is answered without running it,
+    // the client has likely given up and the workers catch up with the backlog sooner.
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+    unsigned int queueTimeout = Configuration::getInstance()->getQueueTimeout();
+    if (queueTimeout > 0) {
+        deadline = std::chrono::steady_clock::now() + std::chrono::seconds(queueTimeout);
+    }
+
+    bool accepted = WorkerPool::getInstance()->trySubmit([pResponse, _task, deadline]() {
+        if (std::chrono::steady_clock::now() > deadline) {
+            sendBusy(*pResponse, "The request waited too long for a free worker, retry later.");
+            return;
+        }
+
+        try {
+            _task(*pResponse);
+        } catch (std::exception& e) {
+          // the client is waiting for an answer whatever happened in the worker
+          pResponse->send(Pistache::Http::Code::Internal_Server_Error, e.what());
+        }
+    });
+
+    if (!accepted) {
+        sendBusy(*pResponse, "The server is busy, retry later.");
+    }
+}
+
+void sendBusy(Pistache::Http::ResponseWriter& _response, const std::string& _message) {
+    std::string retryAfter = std::to_string(Configuration::getInstance()->getRetryAfter());
+    _response.headers().addRaw(Pistache::Http::Header::Raw("Retry-After", retryAfter));
+    _response.send(Pistache::Http::Code::Service_Unavailable, _message);
+}
+
+} // namespace API
+} // namespace Server
+} // namespace Tucuxi
@@ -0,0 +1,33 @@
+#ifndef TUCUXI_SERVER_WORKER_DISPATCH_H_
+#define TUCUXI_SERVER_WORKER_DISPATCH_H_
+
+#include <chrono>
+#include <functional>
+#include <string>
+
+#include <pistache/http.h>
+#include <pistache/http_headers.h>
+
+#include "../configuration.h"
+#include "../workerpool.h"
+
+namespace Tucuxi {
+namespace Server {
+namespace API {
+
+typedef std::function<void(Pistache::Http::ResponseWriter& _response)> ResponseTask;
+
+// Hands a task over to the worker pool, which completes the response.
+// The reactor thread answers 503 with a Retry-After header if the pool is saturated,
+// the worker does the same if the task waited longer than the configured queue timeout.
+// An exception escaping the task is answered with a 500.
+void dispatchToWorkers(Pistache::Http::ResponseWriter _response, ResponseTask _task);
+
+// Answers 503 with the Retry-After header of the configuration.
+void sendBusy(Pistache::Http::ResponseWriter& _response, const std::string& _message);
+
+} // namespace API
+} // namespace Server
+} // namespace Tucuxi
+
+#endif /* TUCUXI_SERVER_WORKER_DISPATCH_H_ */
@@ -69,7 +69,7 @@ void ApiResponse::addWarning(const std::string& _id, const std::string& _languag
     m_responseIssues.addWarning(_id, _language, _content);
 }
 
-std::vector<Core::FullDosage> ApiResponseAdjustment::getAdjustments() const
+const std::vector<Core::FullDosage>& ApiResponseAdjustment::getAdjustments() const
 {
     return m_adjustments;
 }
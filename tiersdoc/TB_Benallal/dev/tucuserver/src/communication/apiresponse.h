@@ -86,7 +86,7 @@ public:
     void addAdjustment(const Core::FullDosage& _adjustment)
     {m_adjustments.push_back(_adjustment);}
 
-    std::vector<Core::FullDosage> getAdjustments() const;
+    const std::vector<Core::FullDosage>& getAdjustments() const;
 
 protected:
     std::vector<Core::FullDosage> m_adjustments;
@@ -1,5 +1,7 @@
 #include "apiresponsewriter.h"
 
+#include <sstream>
+
 namespace Tucuxi {
 namespace Server {
 
@@ -11,31 +13,52 @@ void ApiResponseWriter::addApiResponse(ApiResponse& _apiResponse)
     m_apiResponses.push_back(make_unique<ApiResponse>(_apiResponse));
 }
 
-std::string ApiResponseWriter::serialize()
+void ApiResponseWriter::addApiResponse(std::unique_ptr<ApiResponse> _apiResponse)
+{
+    // Taking the response over keeps its dynamic type, which a copy would slice.
+    m_apiResponses.push_back(move(_apiResponse));
+}
+
+void ApiResponseWriter::serialize(std::ostream& _output, bool _prettyPrint)
 {
-    // Creating root node.
-    XmlNode responsesNode = m_xmlDocument.createNode(EXmlNodeType::Element, "responses");
+    XmlStreamWriter writer(_output, _prettyPrint);
+
+    writer.startElement("responses");
 
-    // Adding children nodes to root.
     for (const unique_ptr<ApiResponse>& response : m_apiResponses) {
-        XmlNode responseNode = createResponse(response);
-        responsesNode.addChild(responseNode);
+        if (!_output) {
+            return;
+        }
+        writeResponse(writer, *response);
     }
 
-    // Adding complete root node to the document.
-    m_xmlDocument.setRoot(responsesNode);
+    writer.endElement();
+}
 
-    // Setting the xml api response in pretty print format.
-    if (m_xmlDocument.toString(m_xmlApiResponse, true)) {
-        return m_xmlApiResponse;
-    }
+std::string ApiResponseWriter::serialize()
+{
+    ostringstream output;
+    serialize(output, true);
 
-    return "Error while serializing the responses!";
+    return output.str();
 }
 
-std::string ApiResponseWriter::getXmlApiResponse() const
+void ApiResponseWriter::serializeJson(std::ostream& _output, bool _prettyPrint)
 {
-    return m_xmlApiResponse;
+    JsonStreamWriter writer(_output, _prettyPrint);
+
+    writer.startObject();
+    writer.startArray("responses");
+
+    for (const unique_ptr<ApiResponse>& response : m_apiResponses) {
+        if (!_output) {
+            return;
+        }
+        writeResponse(writer, *response);
+    }
+
+    writer.endArray();
+    writer.endObject();
 }
 
 const ApiResponses& ApiResponseWriter::getApiResponses() const
@@ -43,94 +66,116 @@ const ApiResponses& ApiResponseWriter::getApiResponses() const
     return m_apiResponses;
 }
 
-XmlNode ApiResponseWriter::createResponse(const std::unique_ptr<ApiResponse>& _apiResponse)
+void ApiResponseWriter::writeResponse(XmlStreamWriter& _writer, const ApiResponse& _apiResponse)
 {
-    XmlNode responseNode = m_xmlDocument.createNode(EXmlNodeType::Element, "response");
-
-    XmlNode queryIDNode = m_xmlDocument.createNode(EXmlNodeType::Element, "queryID", _apiResponse->getQueryID());
-    responseNode.addChild(queryIDNode);
-
-    XmlNode requestIDNode = m_xmlDocument.createNode(EXmlNodeType::Element, "requestID", _apiResponse->getRequestID());
-    responseNode.addChild(requestIDNode);
+    _writer.startElement("response");
 
-    XmlNode issuesNode = createIssues(*_apiResponse);
-    responseNode.addChild(issuesNode);
+    _writer.writeElement("queryID", _apiResponse.getQueryID());
+    _writer.writeElement("requestID", _apiResponse.getRequestID());
 
-    XmlNode dataNode = createData(_apiResponse);
-    responseNode.addChild(dataNode);
+    writeIssues(_writer, _apiResponse);
+    writeData(_writer, _apiResponse);
 
-    return responseNode;
+    _writer.endElement();
 }
 
-XmlNode ApiResponseWriter::createIssues(ApiResponse& _apiResponse)
+void ApiResponseWriter::writeIssues(XmlStreamWriter& _writer, const ApiResponse& _apiResponse)
 {
-    XmlNode issuesNode = m_xmlDocument.createNode(EXmlNodeType::Element, "issues");
+    _writer.startElement("issues");
 
     if (_apiResponse.getResponseIssues().getStatus() == ApiResponseStatus::SUCCESS) {
-        XmlNode statusNode = m_xmlDocument.createNode(EXmlNodeType::Element, "status", "Success");
-        issuesNode.addChild(statusNode);
+        _writer.writeElement("status", "Success");
     } else if (_apiResponse.getResponseIssues().getStatus() == ApiResponseStatus::ERROR) {
-        XmlNode statusNode = m_xmlDocument.createNode(EXmlNodeType::Element, "status", "Success");
-        issuesNode.addChild(statusNode);
+        _writer.writeElement("status", "Success");
     }
 
     if (_apiResponse.getResponseIssues().getErrors().size() > 0) {
-        XmlNode errorsNode = createErrors(_apiResponse);
-        issuesNode.addChild(errorsNode);
+        writeErrors(_writer, _apiResponse);
     }
 
     if (_apiResponse.getResponseIssues().getWarnings().size() > 0) {
-        XmlNode warningsNode = createWarnings(_apiResponse);
-        issuesNode.addChild(warningsNode);
+        writeWarnings(_writer, _apiResponse);
     }
 
-    return issuesNode;
+    _writer.endElement();
 }
 
-XmlNode ApiResponseWriter::createErrors(ApiResponse& _apiResponse)
+void ApiResponseWriter::writeErrors(XmlStreamWriter& _writer, const ApiResponse& _apiResponse)
 {
-    XmlNode errorsNode = m_xmlDocument.createNode(EXmlNodeType::Element, "errors");
+    _writer.startElement("errors");
 
     for (const unique_ptr<ApiResponseMessage>& error : _apiResponse.getResponseIssues().getErrors()) {
-        XmlNode errorNode = m_xmlDocument.createNode(EXmlNodeType::Element, "error");
-
-        XmlNode idNode = m_xmlDocument.createNode(EXmlNodeType::Element, "id", error->getId());
+        _writer.startElement("error");
+        _writer.writeElement("id", error->getId(), "lang", error->getLanguage());
+        _writer.writeElement("message", error->getContent());
+        _writer.endElement();
+    }
 
-        XmlAttribute languageAttribute = m_xmlDocument.createAttribute("lang", error->getLanguage());
-        idNode.addAttribute(languageAttribute);
-        errorNode.addChild(idNode);
+    _writer.endElement();
+}
 
-        XmlNode messageNode = m_xmlDocument.createNode(EXmlNodeType::Element, "message", error->getContent());
-        errorNode.addChild(messageNode);
+void ApiResponseWriter::writeWarnings(XmlStreamWriter& _writer, const ApiResponse& _apiResponse)
+{
+    _writer.startElement("warnings");
 
-        errorsNode.addChild(errorNode);
+    for (const unique_ptr<ApiResponseMessage>& warning : _apiResponse.getResponseIssues().getWarnings()) {
+        _writer.startElement("warning");
+        _writer.writeElement("id", warning->getId(), "lang", warning->getLanguage());
+        _writer.writeElement("message", warning->getContent());
+        _writer.endElement();
     }
 
-    return errorsNode;
+    _writer.endElement();
 }
 
-XmlNode ApiResponseWriter::createWarnings(ApiResponse& _apiResponse)
+void ApiResponseWriter::writeResponse(JsonStreamWriter& _writer, const ApiResponse& _apiResponse)
 {
-    XmlNode warningsNode = m_xmlDocument.createNode(EXmlNodeType::Element, "warnings");
+    _writer.startObject();
 
-    for (const unique_ptr<ApiResponseMessage>& warning : _apiResponse.getResponseIssues().getWarnings()) {
-        XmlNode warningNode = m_xmlDocument.createNode(EXmlNodeType::Element, "warning");
+    _writer.writeString("queryID", _apiResponse.getQueryID());
+    _writer.writeString("requestID", _apiResponse.getRequestID());
+
+    writeIssues(_writer, _apiResponse);
+    writeData(_writer, _apiResponse);
+
+    _writer.endObject();
+}
+
+void ApiResponseWriter::writeIssues(JsonStreamWriter& _writer, const ApiResponse& _apiResponse)
+{
+    _writer.startObject("issues");
 
-        XmlNode idNode = m_xmlDocument.createNode(EXmlNodeType::Element, "id", warning->getId());
-        idNode.setName("id");
-        idNode.setValue(warning->getId());
+    if (_apiResponse.getResponseIssues().getStatus() == ApiResponseStatus::SUCCESS) {
+        _writer.writeString("status", "Success");
+    } else if (_apiResponse.getResponseIssues().getStatus() == ApiResponseStatus::ERROR) {
+        _writer.writeString("status", "Success");
+    }
 
-        XmlAttribute languageAttribute = m_xmlDocument.createAttribute("lang", warning->getLanguage());
-        idNode.addAttribute(languageAttribute);
-        warningNode.addChild(idNode);
+    if (_apiResponse.getResponseIssues().getErrors().size() > 0) {
+        writeMessages(_writer, "errors", _apiResponse.getResponseIssues().getErrors());
+    }
 
-        XmlNode messageNode = m_xmlDocument.createNode(EXmlNodeType::Element, "message", warning->getContent());
-        warningNode.addChild(messageNode);
+    if (_apiResponse.getResponseIssues().getWarnings().size() > 0) {
+        writeMessages(_writer, "warnings", _apiResponse.getResponseIssues().getWarnings());
+    }
 
-        warningsNode.addChild(warningNode);
+    _writer.endObject();
+}
+
+void ApiResponseWriter::writeMessages(JsonStreamWriter& _writer, const std::string& _name,
+                                      const std::vector< std::unique_ptr<ApiResponseMessage> >& _messages)
+{
+    _writer.startArray(_name);
+
+    for (const unique_ptr<ApiResponseMessage>& message : _messages) {
+        _writer.startObject();
+        _writer.writeString("id", message->getId());
+        _writer.writeString("lang", message->getLanguage());
+        _writer.writeString("message", message->getContent());
+        _writer.endObject();
     }
 
-    return warningsNode;
+    _writer.endArray();
 }
 
 string ApiResponseWriter::dateToString(const DateTime& _datetime) const
@@ -149,56 +194,85 @@ string ApiResponseWriter::dateToString(const DateTime& _datetime) const
             boost::lexical_cast<string>(_datetime.second());
 }
 
-XmlNode ApiResponseAdjustmentWriter::createData(const std::unique_ptr<ApiResponse>& _apiResponse)
+void ApiResponseAdjustmentWriter::writeData(XmlStreamWriter& _writer, const ApiResponse& _apiResponse)
 {
-    /*
-    XmlNode dataNode = m_xmlDocument.createNode(EXmlNodeType::Element, "data");
+    // Only the adjustment responses carry data so far, the other ones get an empty data element.
+    const ApiResponseAdjustment* adjustmentResponse = dynamic_cast<const ApiResponseAdjustment*>(&_apiResponse);
+    if (adjustmentResponse == nullptr) {
+        _writer.writeElement("data", "");
+        return;
+    }
 
-    try {
-        const unique_ptr<ApiResponseAdjustment> adjustmentResponse(dynamic_cast<ApiResponseAdjustment*>(_apiResponse.get()));
-        // I'm getting nullptr on this dynamic_cast.
-        for (const Core::FullDosage& adjustment : adjustmentResponse->getAdjustments()) {
-            string scoreValue = boost::lexical_cast<string>(adjustment.getGlobalScore());
-            XmlNode scoreNode = m_xmlDocument.createNode(EXmlNodeType::Element, "score", scoreValue);
-            dataNode.addChild(scoreNode);
+    _writer.startElement("data");
 
-            // Create dosage history ?
+    for (const Core::FullDosage& adjustment : adjustmentResponse->getAdjustments()) {
+        _writer.startElement("adjustment");
+        _writer.writeElement("score", boost::lexical_cast<string>(adjustment.getGlobalScore()));
 
-            for (const Core::CycleData& cycle : adjustment.m_data) {
-                XmlNode cycleNode = m_xmlDocument.createNode(EXmlNodeType::Element, "cycle");
-                dataNode.addChild(cycleNode);
+        for (const Core::CycleData& cycle : adjustment.m_data) {
+            _writer.startElement("cycle");
+            _writer.writeElement("start", dateToString(cycle.m_start));
+            _writer.writeElement("end", dateToString(cycle.m_end));
 
-                string startValue = dateToString(cycle.m_start);
-                XmlNode startNode = m_xmlDocument.createNode(EXmlNodeType::Element, "start", startValue);
-                cycleNode.addChild(startNode);
+            _writer.startElement("concentrations");
+            for (const vector<Core::Concentration>& analyte : cycle.m_concentrations) {
+                _writer.startElement("analyte");
+                for (Core::Concentration concentration : analyte) {
+                    _writer.writeElement("concentration", boost::lexical_cast<string>(concentration));
+                }
+                _writer.endElement();
+            }
+            _writer.endElement();
+
+            _writer.endElement();
+        }
+
+        _writer.endElement();
+    }
+
+    _writer.endElement();
+}
 
-                string endValue = dateToString(cycle.m_end);
-                XmlNode endNode = m_xmlDocument.createNode(EXmlNodeType::Element, "end", endValue);
-                cycleNode.addChild(endNode);
+void ApiResponseAdjustmentWriter::writeData(JsonStreamWriter& _writer, const ApiResponse& _apiResponse)
+{
+    _writer.startObject("data");
 
-                XmlNode concentrationsNode = m_xmlDocument.createNode(EXmlNodeType::Element, "concentrations");
-                cycleNode.addChild(concentrationsNode);
+    const ApiResponseAdjustment* adjustmentResponse = dynamic_cast<const ApiResponseAdjustment*>(&_apiResponse);
+    if (adjustmentResponse != nullptr) {
+        _writer.startArray("adjustments");
 
-                for (vector<Core::Concentration> analyte : cycle.m_concentrations) {
-                    XmlNode analyteNode = m_xmlDocument.createNode(EXmlNodeType::Element, "analyte");
-                    cycleNode.addChild(analyteNode);
+        for (const Core::FullDosage& adjustment : adjustmentResponse->getAdjustments()) {
+            _writer.startObject();
+            _writer.writeNumber("score", adjustment.getGlobalScore());
 
-                    for (Core::Concentration c : analyte) {
-                        string concentrationValue = boost::lexical_cast<string>(c);
-                        XmlNode concentrationNode = m_xmlDocument.createNode(EXmlNodeType::Element, "concentration", concentrationValue);
-                        cycleNode.addChild(concentrationNode);
+            _writer.startArray("cycles");
+            for (const Core::CycleData& cycle : adjustment.m_data) {
+                _writer.startObject();
+                _writer.writeString("start", dateToString(cycle.m_start));
+                _writer.writeString("end", dateToString(cycle.m_end));
+
+                // One array of concentrations per analyte.
+                _writer.startArray("concentrations");
+                for (const vector<Core::Concentration>& analyte : cycle.m_concentrations) {
+                    _writer.startArray();
+                    for (Core::Concentration concentration : analyte) {
+                        _writer.writeNumber(concentration);
                     }
+                    _writer.endArray();
                 }
+                _writer.endArray();
+
+                _writer.endObject();
             }
+            _writer.endArray();
+
+            _writer.endObject();
         }
+
+        _writer.endArray();
     }
-    catch (bad_cast& ex) {
-        XmlNode dataNode = m_xmlDocument.createNode(EXmlNodeType::Element, "data", ex.what());
-    }
-    */
 
-    XmlNode dataNode = m_xmlDocument.createNode(EXmlNodeType::Element, "data", "Placeholder");
-    return dataNode;
+    _writer.endObject();
 }
 
 } // namespace Server
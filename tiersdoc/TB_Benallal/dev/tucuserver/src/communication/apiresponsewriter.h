@@ -1,11 +1,11 @@
 #ifndef TUCUXI_SERVER_APIRESPONSEWRITER_H
 #define TUCUXI_SERVER_APIRESPONSEWRITER_H
 
+#include <ostream>
+
 #include "apiresponse.h"
-#include "tucucommon/xmldocument.h"
-#include "tucucommon/xmlnode.h"
-#include "tucucommon/xmlattribute.h"
-#include "tucucommon/xmliterator.h"
+#include "xmlstreamwriter.h"
+#include "jsonstreamwriter.h"
 
 #include "boost/lexical_cast.hpp"
 
@@ -18,30 +18,42 @@ public:
     virtual ~ApiResponseWriter() {}
 
     void addApiResponse(ApiResponse& _apiResponse);
+    void addApiResponse(std::unique_ptr<ApiResponse> _apiResponse);
+
+    // Writes the responses to _output while they are serialized, the document is never
+    // held in memory as a whole. Stops early if _output fails, i.e. the client went away.
+    void serialize(std::ostream& _output, bool _prettyPrint);
     std::string serialize();
 
-    std::string getXmlApiResponse() const;
+    // Same as serialize, with the responses written in JSON.
+    void serializeJson(std::ostream& _output, bool _prettyPrint);
+
     const ApiResponses& getApiResponses() const;
 
 protected:
-    virtual Common::XmlNode createResponse(const std::unique_ptr<ApiResponse>& _apiResponse) ;
-    Common::XmlNode createIssues(ApiResponse& _apiResponse) ;
-    Common::XmlNode createErrors(ApiResponse& _apiResponse) ;
-    Common::XmlNode createWarnings(ApiResponse& _apiResponse) ;
-    virtual Common::XmlNode createData(const std::unique_ptr<ApiResponse>& _apiResponse) = 0 ;
+    virtual void writeResponse(XmlStreamWriter& _writer, const ApiResponse& _apiResponse);
+    void writeIssues(XmlStreamWriter& _writer, const ApiResponse& _apiResponse);
+    void writeErrors(XmlStreamWriter& _writer, const ApiResponse& _apiResponse);
+    void writeWarnings(XmlStreamWriter& _writer, const ApiResponse& _apiResponse);
+    virtual void writeData(XmlStreamWriter& _writer, const ApiResponse& _apiResponse) = 0;
+
+    virtual void writeResponse(JsonStreamWriter& _writer, const ApiResponse& _apiResponse);
+    void writeIssues(JsonStreamWriter& _writer, const ApiResponse& _apiResponse);
+    void writeMessages(JsonStreamWriter& _writer, const std::string& _name,
+                       const std::vector< std::unique_ptr<ApiResponseMessage> >& _messages);
+    virtual void writeData(JsonStreamWriter& _writer, const ApiResponse& _apiResponse) = 0;
 
     std::string dateToString(const Common::DateTime& _datetime) const ;
 
 protected:
-    std::string m_xmlApiResponse;
     ApiResponses m_apiResponses;
-    Common::XmlDocument m_xmlDocument;
 };
 
 class ApiResponseAdjustmentWriter : public ApiResponseWriter
 {
 protected:
-    Common::XmlNode createData(const std::unique_ptr<ApiResponse>& _apiResponse) override ;
+    void writeData(XmlStreamWriter& _writer, const ApiResponse& _apiResponse) override ;
+    void writeData(JsonStreamWriter& _writer, const ApiResponse& _apiResponse) override ;
 };
 
 } // namespace Server
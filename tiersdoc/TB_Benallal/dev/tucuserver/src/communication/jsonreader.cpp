@@ -0,0 +1,707 @@
+#include "jsonreader.h"
+
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+
+#include "tucucore/definitions.h"
+
+using namespace std;
+using namespace Tucuxi;
+using json = nlohmann::json;
+
+namespace Tucuxi {
+namespace Server {
+
+const string JSONReader::m_sDATE_FORMAT = "%Y-%m-%dT%H:%M:%S";
+const json JSONReader::m_sEMPTY;
+
+JSONReader::JSONReader(const string& _json)
+{
+    json document;
+    try {
+        document = json::parse(_json);
+    } catch (json::parse_error& e) {
+        throw runtime_error(string("Invalid JSON query: ") + e.what());
+    }
+
+    createQuery(document);
+}
+
+JSONReader::JSONReader(const json& _json)
+{
+    createQuery(_json);
+}
+
+const Query& JSONReader::getQuery() const
+{
+    return *m_pQuery;
+}
+
+void JSONReader::createQuery(const json& _json)
+{
+    if (!_json.is_object()) {
+        throw runtime_error("Invalid JSON query: the query is not an object");
+    }
+
+    const string QUERY_ID_NODE_NAME = "queryID";
+    const string CLIENT_ID_NODE_NAME = "clientID";
+    const string DATE_NODE_NAME = "date";
+    const string LANGUAGE_NODE_NAME = "language";
+    const string ADMIN_NODE_NAME = "admin";
+    const string PARAMETERS_NODE_NAME = "parameters";
+    const string REQUESTS_NODE_NAME = "requests";
+
+    try {
+        string queryID = getChildStringValue(_json, QUERY_ID_NODE_NAME);
+        string clientID = getChildStringValue(_json, CLIENT_ID_NODE_NAME);
+        Common::DateTime date = getChildDateTimeValue(_json, DATE_NODE_NAME);
+        string language = getChildStringValue(_json, LANGUAGE_NODE_NAME);
+
+        unique_ptr<AdministrativeData> pAdministrativeData = createAdministrativeData(getChild(_json, ADMIN_NODE_NAME));
+        unique_ptr<ParametersData> pParametersData = createParametersData(getChild(_json, PARAMETERS_NODE_NAME));
+
+        vector< unique_ptr<RequestData> > requests;
+        for (const json& request : getChild(_json, REQUESTS_NODE_NAME)) {
+            requests.emplace_back(createRequest(request));
+        }
+
+        m_pQuery = make_unique<Query>(
+                                 queryID,
+                                 clientID,
+                                 date,
+                                 language,
+                                 move(pAdministrativeData),
+                                 move(pParametersData),
+                                 requests
+                                );
+    } catch (json::exception& e) {
+        throw runtime_error(string("Invalid JSON query: ") + e.what());
+    }
+}
+
+unique_ptr<AdministrativeData> JSONReader::createAdministrativeData(const json& _admin) const
+{
+    const string MANDATOR_NODE_NAME = "mandator";
+    const string PATIENT_NODE_NAME = "patient";
+    const string CLINICALDATA_NODE_NAME = "clinicalData";
+
+    unique_ptr<Person> pMandator = createPerson(getChild(_admin, MANDATOR_NODE_NAME));
+    unique_ptr<Person> pPatient = createPerson(getChild(_admin, PATIENT_NODE_NAME));
+    unique_ptr<ClinicalData> pClinicalData = createClinicalData(getChild(_admin, CLINICALDATA_NODE_NAME));
+
+    return make_unique<AdministrativeData>(
+                                      move(pMandator),
+                                      move(pPatient),
+                                      move(pClinicalData)
+                                    );
+}
+
+unique_ptr<Person> JSONReader::createPerson(const json& _person) const
+{
+    const string PERSON_NODE_NAME = "person";
+    const string INSTITUTE_NODE_NAME = "institute";
+
+    unique_ptr<PersonalContact> pPersonalContact = createPersonalContact(getChild(_person, PERSON_NODE_NAME));
+    unique_ptr<InstituteContact> pInstituteContact = createInstituteContact(getChild(_person, INSTITUTE_NODE_NAME));
+
+    return make_unique<Person>(
+                           move(pPersonalContact),
+                           move(pInstituteContact)
+                       );
+}
+
+unique_ptr<PersonalContact> JSONReader::createPersonalContact(const json& _personalContact) const
+{
+    const string ID_NODE_NAME = "id";
+    const string TITLE_NODE_NAME = "title";
+    const string FIRSTNAME_NODE_NAME = "firstName";
+    const string LASTNAME_NODE_NAME = "lastName";
+    const string ADDRESS_NODE_NAME = "address";
+    const string PHONE_NODE_NAME = "phone";
+    const string EMAIL_NODE_NAME = "email";
+
+    return make_unique<PersonalContact>(
+                                      getChildStringValue(_personalContact, ID_NODE_NAME),
+                                      getChildStringValue(_personalContact, TITLE_NODE_NAME),
+                                      getChildStringValue(_personalContact, FIRSTNAME_NODE_NAME),
+                                      getChildStringValue(_personalContact, LASTNAME_NODE_NAME),
+                                      createAddress(getChild(_personalContact, ADDRESS_NODE_NAME)),
+                                      createPhone(getChild(_personalContact, PHONE_NODE_NAME)),
+                                      createEmail(getChild(_personalContact, EMAIL_NODE_NAME))
+                                    );
+}
+
+unique_ptr<InstituteContact> JSONReader::createInstituteContact(const json& _instituteContact) const
+{
+    const string ID_NODE_NAME = "id";
+    const string NAME_NODE_NAME = "name";
+    const string ADDRESS_NODE_NAME = "address";
+    const string PHONE_NODE_NAME = "phone";
+    const string EMAIL_NODE_NAME = "email";
+
+    return make_unique<InstituteContact>(
+                                      getChildStringValue(_instituteContact, ID_NODE_NAME),
+                                      getChildStringValue(_instituteContact, NAME_NODE_NAME),
+                                      createAddress(getChild(_instituteContact, ADDRESS_NODE_NAME)),
+                                      createPhone(getChild(_instituteContact, PHONE_NODE_NAME)),
+                                      createEmail(getChild(_instituteContact, EMAIL_NODE_NAME))
+                                      );
+}
+
+unique_ptr<Address> JSONReader::createAddress(const json& _address) const
+{
+    const string STREET_NODE_NAME = "street";
+    const string POSTALCODE_NODE_NAME = "postCode";
+    const string CITY_NODE_NAME = "city";
+    const string STATE_NODE_NAME = "state";
+    const string COUNTRY_NODE_NAME = "country";
+
+    return make_unique<Address>(
+                            getChildStringValue(_address, STREET_NODE_NAME),
+                            getChildIntValue(_address, POSTALCODE_NODE_NAME),
+                            getChildStringValue(_address, CITY_NODE_NAME),
+                            getChildStringValue(_address, STATE_NODE_NAME),
+                            getChildStringValue(_address, COUNTRY_NODE_NAME)
+                         );
+}
+
+unique_ptr<Phone> JSONReader::createPhone(const json& _phone) const
+{
+    const string NUMBER_NODE_NAME = "number";
+    const string TYPE_NODE_NAME = "type";
+
+    return make_unique<Phone>(getChildStringValue(_phone, NUMBER_NODE_NAME), getChildStringValue(_phone, TYPE_NODE_NAME));
+}
+
+unique_ptr<Email> JSONReader::createEmail(const json& _email) const
+{
+    const string ADDRESS_NODE_NAME = "address";
+    const string TYPE_NODE_NAME = "type";
+
+    return make_unique<Email>(getChildStringValue(_email, ADDRESS_NODE_NAME), getChildStringValue(_email, TYPE_NODE_NAME));
+}
+
+unique_ptr<ClinicalData> JSONReader::createClinicalData(const json& _clinicalData) const
+{
+    map<string, string> data;
+
+    if (_clinicalData.is_object()) {
+        for (json::const_iterator it = _clinicalData.begin(); it != _clinicalData.end(); ++it) {
+            data[it.key()] = getChildStringValue(_clinicalData, it.key());
+        }
+    }
+
+    return make_unique<ClinicalData>(data);
+}
+
+unique_ptr<ParametersData> JSONReader::createParametersData(const json& _parameters) const
+{
+    const string PATIENT_NODE_NAME = "patient";
+    const string DRUGS_NODE_NAME = "drugs";
+
+    unique_ptr<PatientData> pPatient = createPatientData(getChild(_parameters, PATIENT_NODE_NAME));
+
+    vector< unique_ptr<DrugData> > drugs;
+    for (const json& drug : getChild(_parameters, DRUGS_NODE_NAME)) {
+        drugs.push_back(createDrugData(drug));
+    }
+
+    return make_unique<ParametersData>(
+                                      move(pPatient),
+                                      move(drugs)
+                                    );
+}
+
+unique_ptr<PatientData> JSONReader::createPatientData(const json& _patientData) const
+{
+    const string COVARIATES_NODE_NAME = "covariates";
+
+    vector< unique_ptr<CovariateData> > covariates;
+    for (const json& covariate : getChild(_patientData, COVARIATES_NODE_NAME)) {
+        covariates.push_back(createCovariateData(covariate));
+    }
+
+    return make_unique<PatientData>(covariates);
+}
+
+unique_ptr<CovariateData> JSONReader::createCovariateData(const json& _covariateData) const
+{
+    const string NAME_NODE_NAME = "name";
+    const string DATE_NODE_NAME = "date";
+    const string VALUE_NODE_NAME = "value";
+    const string UNIT_NODE_NAME = "unit";
+    const string DATATYPE_NODE_NAME = "dataType";
+    const string NATURE_NODE_NAME = "nature";
+
+    static const map<string, Core::DataType> DATA_TYPES = {
+        {"Int", Core::DataType::Int},
+        {"Double", Core::DataType::Double},
+        {"Bool", Core::DataType::Bool},
+        {"Date", Core::DataType::Date}
+    };
+
+    string dataTypeString = getChildStringValue(_covariateData, DATATYPE_NODE_NAME);
+    map<string, Core::DataType>::const_iterator dataType = DATA_TYPES.find(dataTypeString);
+    if (dataType == DATA_TYPES.end()) {
+        throw runtime_error("Invalid JSON query: unknown covariate data type (" + dataTypeString + ")");
+    }
+
+    return make_unique<CovariateData>(
+                                     getChildStringValue(_covariateData, NAME_NODE_NAME),
+                                     getChildDateTimeValue(_covariateData, DATE_NODE_NAME),
+                                     getChildStringValue(_covariateData, VALUE_NODE_NAME),
+                                     getChildStringValue(_covariateData, UNIT_NODE_NAME),
+                                     dataType->second,
+                                     getChildStringValue(_covariateData, NATURE_NODE_NAME)
+                                );
+}
+
+unique_ptr<DrugData> JSONReader::createDrugData(const json& _drugData) const
+{
+    const string DRUG_ID_NODE_NAME = "drugID";
+    const string ACTIVE_PRINCIPLE_NODE_NAME = "activePrinciple";
+    const string BRAND_NAME_NODE_NAME = "brandName";
+    const string ATC_NODE_NAME = "atc";
+    const string TREATMENT_NODE_NAME = "treatment";
+    const string SAMPLES_NODE_NAME = "samples";
+    const string TARGETS_NODE_NAME = "targets";
+
+    unique_ptr<Treatment> pTreatment = createTreatment(getChild(_drugData, TREATMENT_NODE_NAME));
+
+    vector< unique_ptr<SampleData> > samples;
+    for (const json& sample : getChild(_drugData, SAMPLES_NODE_NAME)) {
+        samples.push_back(createSampleData(sample));
+    }
+
+    vector< unique_ptr<TargetData> > targets;
+    for (const json& target : getChild(_drugData, TARGETS_NODE_NAME)) {
+        targets.push_back(createTargetData(target));
+    }
+
+    return make_unique<DrugData>(
+                            getChildStringValue(_drugData, DRUG_ID_NODE_NAME),
+                            getChildStringValue(_drugData, ACTIVE_PRINCIPLE_NODE_NAME),
+                            getChildStringValue(_drugData, BRAND_NAME_NODE_NAME),
+                            getChildStringValue(_drugData, ATC_NODE_NAME),
+                            move(pTreatment),
+                            samples,
+                            targets
+                        );
+}
+
+unique_ptr<TargetData> JSONReader::createTargetData(const json& _targetData) const
+{
+    const string ANALYTE_ID_NODE_NAME           = "activeMoietyID";
+    const string TARGET_TYPE_NODE_NAME          = "targetType";
+    const string UNIT_NODE_NAME                 = "unit";
+    const string INEFFICACY_ALARM_ID_NODE_NAME  = "inefficacyAlarm";
+    const string MIN_NODE_NAME                  = "min";
+    const string BEST_NODE_NAME                 = "best";
+    const string MAX_ID_NODE_NAME               = "max";
+    const string TOXICITY_ALARM_NODE_NAME       = "toxicityAlarm";
+
+    return make_unique<TargetData>(
+                               getChildStringValue(_targetData, ANALYTE_ID_NODE_NAME),
+                               getChildStringValue(_targetData, TARGET_TYPE_NODE_NAME),
+                               getChildStringValue(_targetData, UNIT_NODE_NAME),
+                               getChildDoubleValue(_targetData, INEFFICACY_ALARM_ID_NODE_NAME),
+                               getChildDoubleValue(_targetData, MIN_NODE_NAME),
+                               getChildDoubleValue(_targetData, BEST_NODE_NAME),
+                               getChildDoubleValue(_targetData, MAX_ID_NODE_NAME),
+                               getChildDoubleValue(_targetData, TOXICITY_ALARM_NODE_NAME)
+                        );
+}
+
+unique_ptr<SampleData> JSONReader::createSampleData(const json& _sampleData) const
+{
+    const string SAMPLE_ID_NODE_NAME = "sampleID";
+    const string SAMPLE_DATE_NODE_NAME = "sampleDate";
+    const string ARRIVAL_DATE_NODE_NAME = "arrivalDate";
+    const string CONCENTRATIONS_NODE_NAME = "concentrations";
+    const string LIKELYHOOD_USE_NODE_NAME = "likelyhoodUse";
+
+    vector< unique_ptr<ConcentrationData> > concentrations;
+    for (const json& concentration : getChild(_sampleData, CONCENTRATIONS_NODE_NAME)) {
+        concentrations.push_back(createConcentrationData(concentration));
+    }
+
+    return make_unique<SampleData>(
+                               getChildStringValue(_sampleData, SAMPLE_ID_NODE_NAME),
+                               getChildDateTimeValue(_sampleData, SAMPLE_DATE_NODE_NAME),
+                               getChildDateTimeValue(_sampleData, ARRIVAL_DATE_NODE_NAME),
+                               concentrations,
+                               getChildBoolValue(_sampleData, LIKELYHOOD_USE_NODE_NAME)
+                        );
+}
+
+unique_ptr<ConcentrationData> JSONReader::createConcentrationData(const json& _concentrationData) const
+{
+    const string ANALITE_ID_NODE_NAME = "analyteID";
+    const string VALUE_NODE_NAME = "value";
+    const string UNIT_NODE_NAME = "unit";
+
+    return make_unique<ConcentrationData>(
+                                      getChildStringValue(_concentrationData, ANALITE_ID_NODE_NAME),
+                                      getChildDoubleValue(_concentrationData, VALUE_NODE_NAME),
+                                      getChildStringValue(_concentrationData, UNIT_NODE_NAME)
+                                      );
+}
+
+unique_ptr<Treatment> JSONReader::createTreatment(const json& _treatment) const
+{
+    const string DOSAGE_HISTORY_NODE_NAME = "dosageHistory";
+
+    unique_ptr<Core::DosageHistory> pDosageHistory = make_unique<Core::DosageHistory>();
+    for (const json& dosageTimeRange : getChild(_treatment, DOSAGE_HISTORY_NODE_NAME)) {
+        unique_ptr<Core::DosageTimeRange> pDosageTimeRange = createDosageTimeRange(dosageTimeRange);
+        pDosageHistory->addTimeRange(*pDosageTimeRange);
+    }
+
+    return make_unique<Treatment>(move(pDosageHistory));
+}
+
+unique_ptr<Core::DosageTimeRange> JSONReader::createDosageTimeRange(const json& _dosageTimeRange) const
+{
+    const string START_NODE_NAME    = "start";
+    const string END_NODE_NAME      = "end";
+    const string DOSAGE_NODE_NAME   = "dosage";
+
+    Common::DateTime start = getChildDateTimeValue(_dosageTimeRange, START_NODE_NAME);
+    Common::DateTime end = getChildDateTimeValue(_dosageTimeRange, END_NODE_NAME);
+    Common::Duration infusionTime(end - start);
+
+    unique_ptr<Core::Dosage> pDosage = createDosage(getChild(_dosageTimeRange, DOSAGE_NODE_NAME), infusionTime);
+    return make_unique<Core::DosageTimeRange>(
+                                            start,
+                                            end,
+                                            *pDosage
+                                        );
+}
+
+unique_ptr<Core::Dosage> JSONReader::createDosage(const json& _dosage, Common::Duration _infusionTime) const
+{
+    const string DOSAGE_LOOP_NODE_NAME  = "dosageLoop";
+
+    const json& dosageLoop = getChild(_dosage, DOSAGE_LOOP_NODE_NAME);
+    if (!dosageLoop.is_null()) {
+        // Create dosage loop from a bounded dosage
+        unique_ptr<Core::DosageBounded> pDosageBounded = createDosageBounded(dosageLoop, _infusionTime);
+        return make_unique<Core::DosageLoop>(*pDosageBounded);
+    }
+
+    return createDosageBounded(_dosage, _infusionTime);
+}
+
+unique_ptr<Core::DosageBounded> JSONReader::createDosageBounded(const json& _dosageBounded, Common::Duration _infusionTime) const
+{
+    const string DOSAGE_REPEAT_NODE_NAME            = "dosageRepeat";
+    const string DOSAGE_SEQUENCE_NODE_NAME          = "dosageSequence";
+    const string LASTING_DOSAGE_NODE_NAME           = "lastingDosage";
+    const string DAILY_DOSAGE_NODE_NAME             = "dailyDosage";
+    const string WEEKLY_DOSAGE_NODE_NAME            = "weeklyDosage";
+    const string DOSE_NODE_NAME                     = "dose";
+    const string DOSE_VALUE_NODE_NAME               = "value";
+    const string FORMULATION_AND_ROUTE_NODE_NAME    = "formulationAndRoute";
+    const string TIME_NODE_NAME                     = "time";
+
+    if (!_dosageBounded.is_object() || _dosageBounded.empty()) {
+        throw runtime_error("Invalid JSON query: missing dosage");
+    }
+
+    // The kind of dosage is given by the name of its single member.
+    const string& name = _dosageBounded.begin().key();
+    const json& dosage = _dosageBounded.begin().value();
+
+    if (name == DOSAGE_REPEAT_NODE_NAME) {
+        const string ITERATIONS_NODE_NAME = "iterations";
+
+        int iterations = getChildIntValue(dosage, ITERATIONS_NODE_NAME);
+
+        // The repeated dosage is the member beside the iterations.
+        json repeatedDosage = dosage;
+        repeatedDosage.erase(ITERATIONS_NODE_NAME);
+        unique_ptr<Core::DosageBounded> pRepeatedDosage = createDosageBounded(repeatedDosage, _infusionTime);
+
+        return make_unique<Core::DosageRepeat>(*pRepeatedDosage, iterations);
+    }
+
+    if (name == DOSAGE_SEQUENCE_NODE_NAME) {
+        if (!dosage.is_array() || dosage.empty()) {
+            throw runtime_error("Invalid JSON query: empty dosage sequence");
+        }
+
+        unique_ptr<Core::DosageSequence> pDosageSequence = make_unique<Core::DosageSequence>(*createDosageBounded(dosage[0], _infusionTime));
+        for (size_t i = 1; i < dosage.size(); i++) {
+            pDosageSequence->addDosage(*createDosageBounded(dosage[i], _infusionTime));
+        }
+
+        return move(pDosageSequence);
+    }
+
+    Core::DoseValue doseValue = getChildDoubleValue(getChild(dosage, DOSE_NODE_NAME), DOSE_VALUE_NODE_NAME);
+    unique_ptr<Core::FormulationAndRoute> formulationAndRoute = createFormulationAndRoute(getChild(dosage, FORMULATION_AND_ROUTE_NODE_NAME));
+
+    if (name == LASTING_DOSAGE_NODE_NAME) {
+        const string DATE_INTERVAL_NODE_NAME            = "dateInterval";
+        const string START_NODE_NAME                    = "start";
+        const string END_NODE_NAME                      = "end";
+
+        const json& dateInterval = getChild(dosage, DATE_INTERVAL_NODE_NAME);
+        Common::DateTime start = getChildDateTimeValue(dateInterval, START_NODE_NAME);
+        Common::DateTime end = getChildDateTimeValue(dateInterval, END_NODE_NAME);
+        Common::Duration interval(end - start);
+
+        return make_unique<Core::LastingDose>(
+                                                doseValue,
+                                                *formulationAndRoute,
+                                                _infusionTime,
+                                                interval
+                                            );
+    }
+
+    if (name == DAILY_DOSAGE_NODE_NAME) {
+        string timeValue = getChildStringValue(dosage, TIME_NODE_NAME);
+        Common::TimeOfDay time(Common::DateTime(timeValue, "%H:%M:%S").getTimeOfDay());
+
+        return make_unique<Core::DailyDose>(
+                                                doseValue,
+                                                *formulationAndRoute,
+                                                _infusionTime,
+                                                time
+                                            );
+    }
+
+    if (name == WEEKLY_DOSAGE_NODE_NAME) {
+        const string DAY_NODE_NAME = "day";
+
+        int day = getChildIntValue(dosage, DAY_NODE_NAME);
+        if (day < 0 || day > SATURDAY) {
+            throw runtime_error("Invalid JSON query: invalid day of week (" + to_string(day) + ")");
+        }
+
+        string timeValue = getChildStringValue(dosage, TIME_NODE_NAME);
+        Common::TimeOfDay time(Common::DateTime(timeValue, "%H:%M:%S").getTimeOfDay());
+
+        return make_unique<Core::WeeklyDose>(
+                                                doseValue,
+                                                *formulationAndRoute,
+                                                _infusionTime,
+                                                time,
+                                                Core::DayOfWeek(static_cast<unsigned>(day))
+                                            );
+    }
+
+    throw runtime_error("Invalid JSON query: unknown dosage (" + name + ")");
+}
+
+unique_ptr<Core::FormulationAndRoute> JSONReader::createFormulationAndRoute(const json& _formulationAndRoute) const
+{
+    const string FORMULATION_NODE_NAME          = "formulation";
+    const string ADMINISTRATION_NAME_NODE_NAME  = "administrationName";
+    const string ADMINISTRATION_ROUTE_NODE_NAME = "administrationRoute";
+    const string ABSORBTION_MODEL_NODE_NAME     = "absorbtionModel";
+
+    // The unknown values are undefined, as for the XML queries.
+    static const map<string, Core::Formulation> FORMULATIONS = {
+        {"OralSolution", Core::Formulation::OralSolution},
+        {"ParenteralSolution", Core::Formulation::ParenteralSolution},
+        {"Test", Core::Formulation::Test}
+    };
+    static const map<string, Core::AdministrationRoute> ADMINISTRATION_ROUTES = {
+        {"Intramuscular", Core::AdministrationRoute::Intramuscular},
+        {"IntravenousBolus", Core::AdministrationRoute::IntravenousBolus},
+        {"IntravenousDrip", Core::AdministrationRoute::IntravenousDrip},
+        {"Nasal", Core::AdministrationRoute::Nasal},
+        {"Oral", Core::AdministrationRoute::Oral},
+        {"Rectal", Core::AdministrationRoute::Rectal},
+        {"Subcutaneous", Core::AdministrationRoute::Subcutaneous},
+        {"Sublingual", Core::AdministrationRoute::Sublingual},
+        {"Transdermal", Core::AdministrationRoute::Transdermal},
+        {"Vaginal", Core::AdministrationRoute::Vaginal}
+    };
+    static const map<string, Core::RouteModel> ABSORBTION_MODELS = {
+        {"Extravascular", Core::RouteModel::EXTRAVASCULAR},
+        {"Intravascular", Core::RouteModel::INTRAVASCULAR},
+        {"Infusion", Core::RouteModel::INFUSION}
+    };
+
+    Core::Formulation formulation = Core::Formulation::Undefined;
+    map<string, Core::Formulation>::const_iterator formulationIt =
+            FORMULATIONS.find(getChildStringValue(_formulationAndRoute, FORMULATION_NODE_NAME));
+    if (formulationIt != FORMULATIONS.end()) {
+        formulation = formulationIt->second;
+    }
+
+    Core::AdministrationRoute administrationRoute = Core::AdministrationRoute::Undefined;
+    map<string, Core::AdministrationRoute>::const_iterator administrationRouteIt =
+            ADMINISTRATION_ROUTES.find(getChildStringValue(_formulationAndRoute, ADMINISTRATION_ROUTE_NODE_NAME));
+    if (administrationRouteIt != ADMINISTRATION_ROUTES.end()) {
+        administrationRoute = administrationRouteIt->second;
+    }
+
+    Core::RouteModel absorbtionModel = Core::RouteModel::UNDEFINED;
+    map<string, Core::RouteModel>::const_iterator absorbtionModelIt =
+            ABSORBTION_MODELS.find(getChildStringValue(_formulationAndRoute, ABSORBTION_MODEL_NODE_NAME));
+    if (absorbtionModelIt != ABSORBTION_MODELS.end()) {
+        absorbtionModel = absorbtionModelIt->second;
+    }
+
+    return make_unique<Core::FormulationAndRoute>(
+                                               formulation,
+                                               administrationRoute,
+                                               absorbtionModel,
+                                               getChildStringValue(_formulationAndRoute, ADMINISTRATION_NAME_NODE_NAME)
+                                            );
+}
+
+unique_ptr<RequestData> JSONReader::createRequest(const json& _request) const
+{
+    const string REQUEST_ID_NODE_NAME           = "requestID";
+    const string DRUG_ID_NODE_NAME              = "drugID";
+    const string REQUEST_TYPE_NODE_NAME         = "requestType";
+    const string DATE_INTERVAL_NODE_NAME        = "dateInterval";
+    const string DATE_INTERVAL_START_NODE_NAME  = "start";
+    const string DATE_INTERVAL_END_NODE_NAME    = "end";
+    const string PREDICTION_TYPE_NODE_NAME      = "predictionType";
+    const string GRAPH_NODE_NAME                = "graph";
+    const string PERCENTILES_NODE_NAME          = "percentiles";
+
+    const json& dateInterval = getChild(_request, DATE_INTERVAL_NODE_NAME);
+    Common::DateTime start = getChildDateTimeValue(dateInterval, DATE_INTERVAL_START_NODE_NAME);
+    Common::DateTime end = getChildDateTimeValue(dateInterval, DATE_INTERVAL_END_NODE_NAME);
+
+    // The back extrapolation is not supported yet, as for the XML queries.
+    unique_ptr<Backextrapolation> pBackextrapolation;
+
+    return make_unique<RequestData>(
+                                 getChildStringValue(_request, REQUEST_ID_NODE_NAME),
+                                 getChildStringValue(_request, DRUG_ID_NODE_NAME),
+                                 getChildStringValue(_request, REQUEST_TYPE_NODE_NAME),
+                                 make_unique<DateInterval>(start, end),
+                                 getChildStringValue(_request, PREDICTION_TYPE_NODE_NAME),
+                                 createGraphData(getChild(_request, GRAPH_NODE_NAME)),
+                                 createPercentiles(getChild(_request, PERCENTILES_NODE_NAME)),
+                                 move(pBackextrapolation)
+                             );
+}
+
+unique_ptr<GraphData> JSONReader::createGraphData(const json& _graphData) const
+{
+    const string DATE_INTERVAL_NODE_NAME    = "dateInterval";
+    const string START_NODE_NAME            = "start";
+    const string END_NODE_NAME              = "end";
+    const string PERCENTILES_NODE_NAME      = "percentiles";
+
+    const json& dateInterval = getChild(_graphData, DATE_INTERVAL_NODE_NAME);
+    Common::DateTime start = getChildDateTimeValue(dateInterval, START_NODE_NAME);
+    Common::DateTime end = getChildDateTimeValue(dateInterval, END_NODE_NAME);
+
+    unique_ptr<DateInterval> pDateInterval = make_unique<DateInterval>(start, end);
+    return make_unique<GraphData>(move(pDateInterval), createPercentiles(getChild(_graphData, PERCENTILES_NODE_NAME)));
+}
+
+vector<unsigned short> JSONReader::createPercentiles(const json& _percentiles) const
+{
+    vector<unsigned short> percentiles;
+    for (const json& percentile : _percentiles) {
+        unsigned short finalValue = 0;
+        if (percentile.is_number_unsigned()) {
+            finalValue = percentile.get<unsigned short>();
+        } else if (percentile.is_string()) {
+            try {
+                finalValue = static_cast<unsigned short>(stoul(percentile.get<string>()));
+            } catch (invalid_argument&) {
+                finalValue = 0;
+            } catch (out_of_range&) {
+                finalValue = 0;
+            }
+        }
+
+        percentiles.push_back(finalValue);
+    }
+
+    return percentiles;
+}
+
+const json& JSONReader::getChild(const json& _parent, const string& _childName) const
+{
+    if (!_parent.is_object()) {
+        return m_sEMPTY;
+    }
+
+    json::const_iterator child = _parent.find(_childName);
+    return child == _parent.end() ? m_sEMPTY : *child;
+}
+
+string JSONReader::getChildStringValue(const json& _parent, const string& _childName) const
+{
+    const json& child = getChild(_parent, _childName);
+    if (child.is_string()) {
+        return child.get<string>();
+    }
+    if (child.is_null()) {
+        return "";
+    }
+
+    return child.dump();
+}
+
+int JSONReader::getChildIntValue(const json& _parent, const string& _childName) const
+{
+    const json& child = getChild(_parent, _childName);
+    if (child.is_number()) {
+        return child.get<int>();
+    }
+
+    int finalValue = 0;
+    try {
+        finalValue = stoi(getChildStringValue(_parent, _childName));
+    } catch (invalid_argument&) {
+        finalValue = 0;
+    } catch (out_of_range&) {
+        finalValue = 0;
+    }
+
+    return finalValue;
+}
+
+double JSONReader::getChildDoubleValue(const json& _parent, const string& _childName) const
+{
+    const json& child = getChild(_parent, _childName);
+    if (child.is_number()) {
+        return child.get<double>();
+    }
+
+    double finalValue = 0.0;
+    try {
+        finalValue = stod(getChildStringValue(_parent, _childName));
+    } catch (invalid_argument&) {
+        finalValue = 0.0;
+    } catch (out_of_range&) {
+        finalValue = 0.0;
+    }
+
+    return finalValue;
+}
+
+bool JSONReader::getChildBoolValue(const json& _parent, const string& _childName) const
+{
+    const json& child = getChild(_parent, _childName);
+    if (child.is_boolean()) {
+        return child.get<bool>();
+    }
+
+    string value = getChildStringValue(_parent, _childName);
+    transform(value.begin(), value.end(), value.begin(), ::tolower);
+
+    return value == "true";
+}
+
+Common::DateTime JSONReader::getChildDateTimeValue(const json& _parent, const string& _childName) const
+{
+    return Common::DateTime(getChildStringValue(_parent, _childName), m_sDATE_FORMAT);
+}
+
+} // namespace Server
+} // namespace Tucuxi
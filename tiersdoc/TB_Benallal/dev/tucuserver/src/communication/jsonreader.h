@@ -0,0 +1,78 @@
+#ifndef JSONREADER_H
+#define JSONREADER_H
+
+#include <string>
+#include <vector>
+#include "nlohmann/json.hpp"
+#include "query.h"
+
+namespace Tucuxi {
+namespace Server {
+
+// Counterpart of XMLReader for the queries sent in JSON. The document has the structure
+// of the XML query, the lists (requests, drugs, covariates, samples, targets,
+// concentrations, percentiles, dosageHistory, dosageSequence) being arrays.
+// The text is parsed once into a json value, which is then read with direct member
+// lookups. Throws std::runtime_error if the query is not valid.
+class JSONReader
+{
+public:
+    JSONReader(const std::string& _json);
+    JSONReader(const nlohmann::json& _json);
+
+    JSONReader(JSONReader& other) = delete;
+
+    const Query& getQuery() const;
+
+protected:
+    void createQuery(const nlohmann::json& _json);
+
+    // Methods to separate the creation of an AdministrativeData
+    std::unique_ptr<AdministrativeData> createAdministrativeData(const nlohmann::json& _admin) const;
+    std::unique_ptr<Person> createPerson(const nlohmann::json& _person) const;
+    std::unique_ptr<PersonalContact> createPersonalContact(const nlohmann::json& _personalContact) const;
+    std::unique_ptr<InstituteContact> createInstituteContact(const nlohmann::json& _instituteContact) const;
+    std::unique_ptr<Address> createAddress(const nlohmann::json& _address) const;
+    std::unique_ptr<Phone> createPhone(const nlohmann::json& _phone) const;
+    std::unique_ptr<Email> createEmail(const nlohmann::json& _email) const;
+    std::unique_ptr<ClinicalData> createClinicalData(const nlohmann::json& _clinicalData) const;
+
+    // Methods to separate the creation of a ParametersData
+    std::unique_ptr<ParametersData> createParametersData(const nlohmann::json& _parameters) const;
+    std::unique_ptr<PatientData> createPatientData(const nlohmann::json& _patientData) const;
+    std::unique_ptr<CovariateData> createCovariateData(const nlohmann::json& _covariateData) const;
+    std::unique_ptr<DrugData> createDrugData(const nlohmann::json& _drugData) const;
+    std::unique_ptr<TargetData> createTargetData(const nlohmann::json& _targetData) const;
+    std::unique_ptr<SampleData> createSampleData(const nlohmann::json& _sampleData) const;
+    std::unique_ptr<ConcentrationData> createConcentrationData(const nlohmann::json& _concentrationData) const;
+    std::unique_ptr<Treatment> createTreatment(const nlohmann::json& _treatment) const;
+    std::unique_ptr<Core::DosageTimeRange> createDosageTimeRange(const nlohmann::json& _dosageTimeRange) const;
+    std::unique_ptr<Core::Dosage> createDosage(const nlohmann::json& _dosage, Common::Duration _infusionTime) const;
+    std::unique_ptr<Core::DosageBounded> createDosageBounded(const nlohmann::json& _dosageBounded, Common::Duration _infusionTime) const;
+    std::unique_ptr<Core::FormulationAndRoute> createFormulationAndRoute(const nlohmann::json& _formulationAndRoute) const;
+
+    // Methods to separate the creation of the requests
+    std::unique_ptr<RequestData> createRequest(const nlohmann::json& _request) const;
+    std::unique_ptr<GraphData> createGraphData(const nlohmann::json& _graphData) const;
+    std::vector<unsigned short> createPercentiles(const nlohmann::json& _percentiles) const;
+
+    // Utilitary methods, a missing member gives an empty value like a missing XML node.
+    // The numbers and the booleans may be given as JSON values or as strings.
+    const nlohmann::json& getChild(const nlohmann::json& _parent, const std::string& _childName) const;
+    std::string getChildStringValue(const nlohmann::json& _parent, const std::string& _childName) const;
+    int getChildIntValue(const nlohmann::json& _parent, const std::string& _childName) const;
+    double getChildDoubleValue(const nlohmann::json& _parent, const std::string& _childName) const;
+    bool getChildBoolValue(const nlohmann::json& _parent, const std::string& _childName) const;
+    Common::DateTime getChildDateTimeValue(const nlohmann::json& _parent, const std::string& _childName) const;
+
+protected:
+    static const std::string m_sDATE_FORMAT;
+    static const nlohmann::json m_sEMPTY;
+
+    std::unique_ptr<Query> m_pQuery;
+};
+
+} // namespace Server
+} // namespace Tucuxi
+
+#endif // JSONREADER_H
@@ -0,0 +1,161 @@
+#include "jsonstreamwriter.h"
+
+#include <cmath>
+#include <limits>
+
+namespace Tucuxi {
+namespace Server {
+
+using namespace std;
+
+JsonStreamWriter::JsonStreamWriter(ostream& _output, bool _prettyPrint)
+    : m_output(_output), m_prettyPrint(_prettyPrint),
+      // The doubles are written with enough digits to be read back unchanged.
+      m_previousPrecision(_output.precision(numeric_limits<double>::max_digits10))
+{}
+
+JsonStreamWriter::~JsonStreamWriter()
+{
+    m_output.precision(m_previousPrecision);
+}
+
+void JsonStreamWriter::startObject()
+{
+    startValue();
+    start('{');
+}
+
+void JsonStreamWriter::startObject(const string& _name)
+{
+    startMember(_name);
+    start('{');
+}
+
+void JsonStreamWriter::endObject()
+{
+    end('}');
+}
+
+void JsonStreamWriter::startArray()
+{
+    startValue();
+    start('[');
+}
+
+void JsonStreamWriter::startArray(const string& _name)
+{
+    startMember(_name);
+    start('[');
+}
+
+void JsonStreamWriter::endArray()
+{
+    end(']');
+}
+
+void JsonStreamWriter::writeString(const string& _name, const string& _value)
+{
+    startMember(_name);
+    m_output << '"';
+    writeEscaped(_value);
+    m_output << '"';
+}
+
+void JsonStreamWriter::writeNumber(const string& _name, double _value)
+{
+    startMember(_name);
+    writeDouble(_value);
+}
+
+void JsonStreamWriter::writeNumber(double _value)
+{
+    startValue();
+    writeDouble(_value);
+}
+
+void JsonStreamWriter::startValue()
+{
+    if (m_isEmpty.empty()) {
+        return;
+    }
+
+    if (!m_isEmpty.back()) {
+        m_output << ',';
+    }
+    m_isEmpty.back() = false;
+
+    if (m_prettyPrint) {
+        m_output << '\n';
+        for (size_t i = 0; i < m_isEmpty.size(); i++) {
+            m_output << '\t';
+        }
+    }
+}
+
+void JsonStreamWriter::startMember(const string& _name)
+{
+    startValue();
+    m_output << '"';
+    writeEscaped(_name);
+    m_output << (m_prettyPrint ? "\": " : "\":");
+}
+
+void JsonStreamWriter::start(char _opening)
+{
+    m_output << _opening;
+    m_isEmpty.push_back(true);
+}
+
+void JsonStreamWriter::end(char _closing)
+{
+    bool isEmpty = m_isEmpty.back();
+    m_isEmpty.pop_back();
+
+    if (m_prettyPrint && !isEmpty) {
+        m_output << '\n';
+        for (size_t i = 0; i < m_isEmpty.size(); i++) {
+            m_output << '\t';
+        }
+    }
+    m_output << _closing;
+}
+
+void JsonStreamWriter::writeDouble(double _value)
+{
+    // JSON has no representation for NaN nor the infinities.
+    if (std::isfinite(_value)) {
+        m_output << _value;
+    } else {
+        m_output << "null";
+    }
+}
+
+void JsonStreamWriter::writeEscaped(const string& _text)
+{
+    static const char HEXADECIMAL_DIGITS[] = "0123456789abcdef";
+
+    size_t start = 0;
+    for (size_t i = 0; i < _text.size(); i++) {
+        unsigned char character = static_cast<unsigned char>(_text[i]);
+        if (character >= 0x20 && character != '"' && character != '\\') {
+            continue;
+        }
+
+        m_output.write(_text.data() + start, i - start);
+        switch (character) {
+        case '"': m_output << "\\\""; break;
+        case '\\': m_output << "\\\\"; break;
+        case '\n': m_output << "\\n"; break;
+        case '\r': m_output << "\\r"; break;
+        case '\t': m_output << "\\t"; break;
+        default:
+            m_output << "\\u00" << HEXADECIMAL_DIGITS[character >> 4] << HEXADECIMAL_DIGITS[character & 0xF];
+            break;
+        }
+        start = i + 1;
+    }
+    m_output.write(_text.data() + start, _text.size() - start);
+}
+
+} // namespace Server
+} // namespace Tucuxi
@@ -0,0 +1,54 @@
+#ifndef TUCUXI_SERVER_JSONSTREAMWRITER_H
+#define TUCUXI_SERVER_JSONSTREAMWRITER_H
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace Tucuxi {
+namespace Server {
+
+// Writes a JSON document member by member to an output stream, the counterpart of
+// XmlStreamWriter. The names are only given for the members of objects, the values
+// of arrays are unnamed. The document is indented with tabs in pretty print mode.
+class JsonStreamWriter
+{
+public:
+    JsonStreamWriter(std::ostream& _output, bool _prettyPrint);
+    JsonStreamWriter(JsonStreamWriter& other) = delete;
+    ~JsonStreamWriter();
+
+    void startObject();
+    void startObject(const std::string& _name);
+    void endObject();
+
+    void startArray();
+    void startArray(const std::string& _name);
+    void endArray();
+
+    void writeString(const std::string& _name, const std::string& _value);
+    void writeNumber(const std::string& _name, double _value);
+    void writeNumber(double _value);
+
+protected:
+    // Writes the separator and the indentation expected before a new value.
+    void startValue();
+    void startMember(const std::string& _name);
+    void start(char _opening);
+    void end(char _closing);
+    void writeDouble(double _value);
+    void writeEscaped(const std::string& _text);
+
+protected:
+    std::ostream& m_output;
+    const bool m_prettyPrint;
+    const std::streamsize m_previousPrecision;
+
+    // For each object or array started and not yet ended, whether it has no value yet.
+    std::vector<bool> m_isEmpty;
+};
+
+} // namespace Server
+} // namespace Tucuxi
+
+#endif // TUCUXI_SERVER_JSONSTREAMWRITER_H
@@ -22,51 +22,60 @@ XMLReader::XMLReader()
 */
 
 XMLReader::XMLReader(const string& _xml)
-    : m_xml(_xml)
+    : m_xml(_xml), m_xmlDocument(m_ownedXmlDocument)
 {
     // TODO try to see if I can catch a parsing exception.
     if(m_xmlDocument.fromString(m_xml)) {
+        createQuery();
+    } else {
+        cout << "Failed to load and parse xml file!" << endl;
+    }
+}
 
-        const string DRUG_ID_NODE_NAME = "queryID";
-        const string CLIENT_ID_NODE_NAME = "clientID";
-        const string DATE_NODE_NAME = "date";
-        const string LANGUAGE_NODE_NAME = "language";
-        const string REQUESTS_NODE_NAME = "requests";
-
-        Common::XmlNode root = m_xmlDocument.getRoot();
+XMLReader::XMLReader(Common::XmlDocument& _xmlDocument)
+    : m_xmlDocument(_xmlDocument)
+{
+    createQuery();
+}
 
-        string drugID = root.getChildren(DRUG_ID_NODE_NAME)->getValue();
-        string clientID = root.getChildren(CLIENT_ID_NODE_NAME)->getValue();
+void XMLReader::createQuery()
+{
+    const string DRUG_ID_NODE_NAME = "queryID";
+    const string CLIENT_ID_NODE_NAME = "clientID";
+    const string DATE_NODE_NAME = "date";
+    const string LANGUAGE_NODE_NAME = "language";
+    const string REQUESTS_NODE_NAME = "requests";
 
-        string dateValue = root.getChildren(DATE_NODE_NAME)->getValue();
-        Common::DateTime date(dateValue, m_sDATE_FORMAT);
+    Common::XmlNode root = m_xmlDocument.getRoot();
 
-        string language = root.getChildren(LANGUAGE_NODE_NAME)->getValue();
+    string drugID = root.getChildren(DRUG_ID_NODE_NAME)->getValue();
+    string clientID = root.getChildren(CLIENT_ID_NODE_NAME)->getValue();
 
-        unique_ptr<AdministrativeData> pAdministrativeData = createAdministrativeData();
-        unique_ptr<ParametersData> pParametersData = createParametersData();
+    string dateValue = root.getChildren(DATE_NODE_NAME)->getValue();
+    Common::DateTime date(dateValue, m_sDATE_FORMAT);
 
-        Common::XmlNodeIterator requestsRootIterator = root.getChildren(REQUESTS_NODE_NAME);
-        Common::XmlNodeIterator requestsIterator = requestsRootIterator->getChildren();
-        vector< unique_ptr<RequestData> > requests;
-        while(requestsIterator != requestsIterator.none()) {
-            requests.emplace_back(createRequest(requestsIterator));
-            requestsIterator++;
-        }
+    string language = root.getChildren(LANGUAGE_NODE_NAME)->getValue();
 
-        m_pQuery = make_unique<Query>(
-                                 drugID,
-                                 clientID,
-                                 date,
-                                 language,
-                                 move(pAdministrativeData),
-                                 move(pParametersData),
-                                 requests
-                                );
+    unique_ptr<AdministrativeData> pAdministrativeData = createAdministrativeData();
+    unique_ptr<ParametersData> pParametersData = createParametersData();
 
-    } else {
-        cout << "Failed to load and parse xml file!" << endl;
+    Common::XmlNodeIterator requestsRootIterator = root.getChildren(REQUESTS_NODE_NAME);
+    Common::XmlNodeIterator requestsIterator = requestsRootIterator->getChildren();
+    vector< unique_ptr<RequestData> > requests;
+    while(requestsIterator != requestsIterator.none()) {
+        requests.emplace_back(createRequest(requestsIterator));
+        requestsIterator++;
     }
+
+    m_pQuery = make_unique<Query>(
+                             drugID,
+                             clientID,
+                             date,
+                             language,
+                             move(pAdministrativeData),
+                             move(pParametersData),
+                             requests
+                            );
 }
 
 XMLReader::~XMLReader()
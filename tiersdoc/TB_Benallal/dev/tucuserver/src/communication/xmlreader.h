@@ -17,6 +17,9 @@ class XMLReader
 public:
     XMLReader(const std::string& _xml);
 
+    // Reads a document already parsed, it must outlive the reader.
+    XMLReader(Common::XmlDocument& _xmlDocument);
+
     XMLReader(XMLReader& other) = delete;
 
     ~XMLReader();
@@ -24,6 +27,8 @@ public:
     const Query& getQuery() const;
 
 protected:
+    void createQuery();
+
     // Methods to separate the creation of an AdministrativeData
     std::unique_ptr<AdministrativeData> createAdministrativeData() const;
     std::unique_ptr<Person> createPerson(Common::XmlNodeIterator& _personRootIterator) const;
@@ -64,7 +69,10 @@ protected:
     static const std::string m_sDATE_FORMAT;
 
     std::string m_xml;
-    Common::XmlDocument m_xmlDocument;
+
+    // Parsed from m_xml, unused if the document is given already parsed.
+    Common::XmlDocument m_ownedXmlDocument;
+    Common::XmlDocument& m_xmlDocument;
     std::unique_ptr<Query> m_pQuery;
 };
 
@@ -0,0 +1,91 @@
+#include "xmlstreamwriter.h"
+
+namespace Tucuxi {
+namespace Server {
+
+using namespace std;
+
+XmlStreamWriter::XmlStreamWriter(ostream& _output, bool _prettyPrint)
+    : m_output(_output), m_prettyPrint(_prettyPrint)
+{}
+
+void XmlStreamWriter::startElement(const string& _name)
+{
+    writeIndentation();
+    m_output << '<' << _name << '>';
+    writeEndOfLine();
+
+    m_elements.push_back(_name);
+}
+
+void XmlStreamWriter::endElement()
+{
+    string name = m_elements.back();
+    m_elements.pop_back();
+
+    writeIndentation();
+    m_output << "</" << name << '>';
+    writeEndOfLine();
+}
+
+void XmlStreamWriter::writeElement(const string& _name, const string& _value)
+{
+    writeIndentation();
+    m_output << '<' << _name << '>';
+    writeEscaped(_value);
+    m_output << "</" << _name << '>';
+    writeEndOfLine();
+}
+
+void XmlStreamWriter::writeElement(const string& _name, const string& _value,
+                                   const string& _attributeName, const string& _attributeValue)
+{
+    writeIndentation();
+    m_output << '<' << _name << ' ' << _attributeName << "=\"";
+    writeEscaped(_attributeValue);
+    m_output << "\">";
+    writeEscaped(_value);
+    m_output << "</" << _name << '>';
+    writeEndOfLine();
+}
+
+void XmlStreamWriter::writeIndentation()
+{
+    if (m_prettyPrint) {
+        for (size_t i = 0; i < m_elements.size(); i++) {
+            m_output << '\t';
+        }
+    }
+}
+
+void XmlStreamWriter::writeEscaped(const string& _text)
+{
+    // Writing the runs of characters without entity at once, most values have none.
+    size_t start = 0;
+    for (size_t i = 0; i < _text.size(); i++) {
+        const char* entity = nullptr;
+        switch (_text[i]) {
+        case '<': entity = "&lt;"; break;
+        case '>': entity = "&gt;"; break;
+        case '&': entity = "&amp;"; break;
+        case '"': entity = "&quot;"; break;
+        case '\'': entity = "&apos;"; break;
+        default: continue;
+        }
+
+        m_output.write(_text.data() + start, i - start);
+        m_output << entity;
+        start = i + 1;
+    }
+    m_output.write(_text.data() + start, _text.size() - start);
+}
+
+void XmlStreamWriter::writeEndOfLine()
+{
+    if (m_prettyPrint) {
+        m_output << '\n';
+    }
+}
+
+} // namespace Server
+} // namespace Tucuxi
@@ -0,0 +1,43 @@
+#ifndef TUCUXI_SERVER_XMLSTREAMWRITER_H
+#define TUCUXI_SERVER_XMLSTREAMWRITER_H
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace Tucuxi {
+namespace Server {
+
+// Writes an XML document element by element to an output stream, without building
+// the document in memory first. The values are escaped, the document is indented
+// with tabs in pretty print mode and written without any formatting otherwise.
+class XmlStreamWriter
+{
+public:
+    XmlStreamWriter(std::ostream& _output, bool _prettyPrint);
+
+    void startElement(const std::string& _name);
+    void endElement();
+
+    // Writes an element containing only a value.
+    void writeElement(const std::string& _name, const std::string& _value);
+    void writeElement(const std::string& _name, const std::string& _value,
+                      const std::string& _attributeName, const std::string& _attributeValue);
+
+protected:
+    void writeIndentation();
+    void writeEscaped(const std::string& _text);
+    void writeEndOfLine();
+
+protected:
+    std::ostream& m_output;
+    const bool m_prettyPrint;
+
+    // The elements started and not yet ended.
+    std::vector<std::string> m_elements;
+};
+
+} // namespace Server
+} // namespace Tucuxi
+
+#endif // TUCUXI_SERVER_XMLSTREAMWRITER_H
@@ -8,20 +8,45 @@ namespace Server {
 
 const Core::CycleSize Computer::m_sCycleSize = Configuration::getInstance()->getCycleSize();
 
-Computer::Computer(const Query& _query)
-    : m_query(_query)
+Computer::Computer(const Query& _query, size_t _requestPosition, shared_ptr<const DrugModelSnapshot> _drugModels)
+    : m_query(_query), m_requestPosition(_requestPosition), m_drugModels(move(_drugModels))
 {}
 
 ApiResponse& Computer::getResult()
 {
     if (m_result.get() == nullptr) {
-        m_result = make_unique<ApiResponseAdjustment>(m_query.getQueryID(), "123");
+        m_result = make_unique<ApiResponseAdjustment>(m_query.getQueryID(), getRequest().getRequestID());
         m_result->addError("ComputationError", m_query.getLanguage(), "Getting result when computing is not complete!");
     }
 
     return *m_result;
 }
 
+unique_ptr<ApiResponse> Computer::releaseResult()
+{
+    getResult();
+    return move(m_result);
+}
+
+const RequestData& Computer::getRequest() const
+{
+    return *m_query.getRequests().at(m_requestPosition);
+}
+
+size_t Computer::findDrugPosition() const
+{
+    string drugID = getRequest().getDrugID();
+    const vector< unique_ptr<DrugData> >& drugs = m_query.getpParameters().getDrugs();
+    size_t drugPosition = 0;
+    for (; drugPosition < drugs.size(); ++drugPosition) {
+        if (drugs.at(drugPosition)->getDrugID() == drugID) {
+            break;
+        }
+    }
+
+    return drugPosition;
+}
+
 PatientVariates Computer::extractPatientVariates() const
 {
     const vector< unique_ptr<CovariateData> >& covariateData = m_query.getpParameters()
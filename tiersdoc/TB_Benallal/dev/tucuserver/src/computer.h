@@ -4,6 +4,7 @@
 #include "communication/query.h"
 #include "communication/apiresponse.h"
 #include "configuration.h"
+#include "drugmodelstore.h"
 
 #include "tucucore/drugtreatment/patientcovariate.h"
 #include "tucucore/drugtreatment/target.h"
@@ -20,8 +21,17 @@ public:
     virtual void compute() = 0;
     virtual ApiResponse& getResult();
 
+    // Gives the result away, to aggregate it with the ones of the other requests of the query.
+    std::unique_ptr<ApiResponse> releaseResult();
+
 protected:
-    Computer(const Query& _query);
+    // The drug models are those of the snapshot the query was received with.
+    Computer(const Query& _query, size_t _requestPosition, std::shared_ptr<const DrugModelSnapshot> _drugModels);
+
+    const RequestData& getRequest() const;
+
+    // Returns the number of drugs of the query if the request's drug is not in the parameters.
+    size_t findDrugPosition() const;
 
     Core::PatientVariates extractPatientVariates() const;
     // TODO inefficacyAlarm and toxicityAlarm are not supported yet
@@ -32,6 +42,8 @@ protected:
     const static Tucuxi::Core::CycleSize m_sCycleSize;
 
     const Query& m_query;
+    const size_t m_requestPosition;
+    const std::shared_ptr<const DrugModelSnapshot> m_drugModels;
     std::unique_ptr<ApiResponse> m_result;
 };
 
@@ -6,9 +6,61 @@ namespace Server {
 Configuration* Configuration::m_sConfiguration = nullptr;
 
 Configuration::Configuration()
-    : m_port(9090), m_cycleSize(250), m_maxDateInterval(31)
+    : m_port(9090), m_cycleSize(250), m_maxDateInterval(31), m_workerPoolSize(4), m_maxQueueSize(64), m_retryAfter(1),
+      m_drugsDirectory("../tucuserver/drugs"),
+      m_cacheMaxEntries(256),
+      m_cacheMaxMemory(64 * 1024 * 1024),
+      m_cacheTimeToLive(600),
+      m_prettyPrint(true),
+      m_maxJobs(256),
+      m_jobsTimeToLive(3600),
+      m_reactorThreads(2),
+      m_backlog(128),
+      m_maxPayload(1024 * 1024),
+      m_noDelay(true),
+      m_queueTimeout(30)
 {}
 
+std::string Configuration::getDrugsDirectory() const
+{
+    return m_drugsDirectory;
+}
+
+void Configuration::setDrugsDirectory(const std::string& drugsDirectory)
+{
+    m_drugsDirectory = drugsDirectory;
+}
+
+size_t Configuration::getWorkerPoolSize() const
+{
+    return m_workerPoolSize;
+}
+
+void Configuration::setWorkerPoolSize(size_t workerPoolSize)
+{
+    m_workerPoolSize = workerPoolSize;
+}
+
+size_t Configuration::getMaxQueueSize() const
+{
+    return m_maxQueueSize;
+}
+
+void Configuration::setMaxQueueSize(size_t maxQueueSize)
+{
+    m_maxQueueSize = maxQueueSize;
+}
+
+unsigned int Configuration::getRetryAfter() const
+{
+    return m_retryAfter;
+}
+
+void Configuration::setRetryAfter(unsigned int retryAfter)
+{
+    m_retryAfter = retryAfter;
+}
+
 unsigned int Configuration::getMaxAdjustments() const
 {
     return m_maxAdjustments;
@@ -43,6 +95,21 @@ Configuration* Configuration::getInstance()
         m_sConfiguration->setCycleSize(configurationReader.getCycleSize());
         m_sConfiguration->setMaxDateInterval(configurationReader.getMaxDateInterval());
         m_sConfiguration->setMaxAdjustments(configurationReader.getMaxAdjustments());
+        m_sConfiguration->setWorkerPoolSize(configurationReader.getWorkerPoolSize());
+        m_sConfiguration->setMaxQueueSize(configurationReader.getMaxQueueSize());
+        m_sConfiguration->setRetryAfter(configurationReader.getRetryAfter());
+        m_sConfiguration->setDrugsDirectory(configurationReader.getDrugsDirectory());
+        m_sConfiguration->setCacheMaxEntries(configurationReader.getCacheMaxEntries());
+        m_sConfiguration->setCacheMaxMemory(configurationReader.getCacheMaxMemory());
+        m_sConfiguration->setCacheTimeToLive(configurationReader.getCacheTimeToLive());
+        m_sConfiguration->setPrettyPrint(configurationReader.getPrettyPrint());
+        m_sConfiguration->setMaxJobs(configurationReader.getMaxJobs());
+        m_sConfiguration->setJobsTimeToLive(configurationReader.getJobsTimeToLive());
+        m_sConfiguration->setReactorThreads(configurationReader.getReactorThreads());
+        m_sConfiguration->setBacklog(configurationReader.getBacklog());
+        m_sConfiguration->setMaxPayload(configurationReader.getMaxPayload());
+        m_sConfiguration->setNoDelay(configurationReader.getNoDelay());
+        m_sConfiguration->setQueueTimeout(configurationReader.getQueueTimeout());
     }
 
     return m_sConfiguration;
@@ -63,5 +130,115 @@ unsigned int Configuration::getMaxDateInterval() const
     return m_maxDateInterval;
 }
 
+size_t Configuration::getCacheMaxEntries() const
+{
+    return m_cacheMaxEntries;
+}
+
+void Configuration::setCacheMaxEntries(size_t cacheMaxEntries)
+{
+    m_cacheMaxEntries = cacheMaxEntries;
+}
+
+size_t Configuration::getCacheMaxMemory() const
+{
+    return m_cacheMaxMemory;
+}
+
+void Configuration::setCacheMaxMemory(size_t cacheMaxMemory)
+{
+    m_cacheMaxMemory = cacheMaxMemory;
+}
+
+unsigned int Configuration::getCacheTimeToLive() const
+{
+    return m_cacheTimeToLive;
+}
+
+void Configuration::setCacheTimeToLive(unsigned int cacheTimeToLive)
+{
+    m_cacheTimeToLive = cacheTimeToLive;
+}
+
+bool Configuration::getPrettyPrint() const
+{
+    return m_prettyPrint;
+}
+
+void Configuration::setPrettyPrint(bool prettyPrint)
+{
+    m_prettyPrint = prettyPrint;
+}
+
+unsigned int Configuration::getMaxJobs() const
+{
+    return m_maxJobs;
+}
+
+void Configuration::setMaxJobs(unsigned int maxJobs)
+{
+    m_maxJobs = maxJobs;
+}
+
+unsigned int Configuration::getJobsTimeToLive() const
+{
+    return m_jobsTimeToLive;
+}
+
+void Configuration::setJobsTimeToLive(unsigned int jobsTimeToLive)
+{
+    m_jobsTimeToLive = jobsTimeToLive;
+}
+
+unsigned int Configuration::getReactorThreads() const
+{
+    return m_reactorThreads;
+}
+
+void Configuration::setReactorThreads(unsigned int reactorThreads)
+{
+    m_reactorThreads = reactorThreads;
+}
+
+unsigned int Configuration::getBacklog() const
+{
+    return m_backlog;
+}
+
+void Configuration::setBacklog(unsigned int backlog)
+{
+    m_backlog = backlog;
+}
+
+size_t Configuration::getMaxPayload() const
+{
+    return m_maxPayload;
+}
+
+void Configuration::setMaxPayload(size_t maxPayload)
+{
+    m_maxPayload = maxPayload;
+}
+
+bool Configuration::getNoDelay() const
+{
+    return m_noDelay;
+}
+
+void Configuration::setNoDelay(bool noDelay)
+{
+    m_noDelay = noDelay;
+}
+
+unsigned int Configuration::getQueueTimeout() const
+{
+    return m_queueTimeout;
+}
+
+void Configuration::setQueueTimeout(unsigned int queueTimeout)
+{
+    m_queueTimeout = queueTimeout;
+}
+
 } // namespace Server
 } // namespace Tucuxi
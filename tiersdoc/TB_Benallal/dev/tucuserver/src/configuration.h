@@ -2,6 +2,7 @@
 #define TUCUXI_SERVER_CONFIGURATION_H
 
 #include <cstdint>
+#include <string>
 
 #include "tucucore/definitions.h"
 
@@ -27,6 +28,51 @@ public:
     unsigned int getMaxAdjustments() const;
     void setMaxAdjustments(unsigned int maxAdjustments);
 
+    size_t getWorkerPoolSize() const;
+    void setWorkerPoolSize(size_t workerPoolSize);
+
+    size_t getMaxQueueSize() const;
+    void setMaxQueueSize(size_t maxQueueSize);
+
+    unsigned int getRetryAfter() const;
+    void setRetryAfter(unsigned int retryAfter);
+
+    std::string getDrugsDirectory() const;
+    void setDrugsDirectory(const std::string& drugsDirectory);
+
+    size_t getCacheMaxEntries() const;
+    void setCacheMaxEntries(size_t cacheMaxEntries);
+
+    size_t getCacheMaxMemory() const;
+    void setCacheMaxMemory(size_t cacheMaxMemory);
+
+    unsigned int getCacheTimeToLive() const;
+    void setCacheTimeToLive(unsigned int cacheTimeToLive);
+
+    bool getPrettyPrint() const;
+    void setPrettyPrint(bool prettyPrint);
+
+    unsigned int getMaxJobs() const;
+    void setMaxJobs(unsigned int maxJobs);
+
+    unsigned int getJobsTimeToLive() const;
+    void setJobsTimeToLive(unsigned int jobsTimeToLive);
+
+    unsigned int getReactorThreads() const;
+    void setReactorThreads(unsigned int reactorThreads);
+
+    unsigned int getBacklog() const;
+    void setBacklog(unsigned int backlog);
+
+    size_t getMaxPayload() const;
+    void setMaxPayload(size_t maxPayload);
+
+    bool getNoDelay() const;
+    void setNoDelay(bool noDelay);
+
+    unsigned int getQueueTimeout() const;
+    void setQueueTimeout(unsigned int queueTimeout);
+
 protected:
     Configuration();
 
@@ -37,6 +83,21 @@ protected:
     Core::CycleSize m_cycleSize;
     unsigned int m_maxDateInterval;
     unsigned int m_maxAdjustments;
+    size_t m_workerPoolSize;
+    size_t m_maxQueueSize;
+    unsigned int m_retryAfter;
+    std::string m_drugsDirectory;
+    size_t m_cacheMaxEntries;
+    size_t m_cacheMaxMemory;
+    unsigned int m_cacheTimeToLive;
+    bool m_prettyPrint;
+    unsigned int m_maxJobs;
+    unsigned int m_jobsTimeToLive;
+    unsigned int m_reactorThreads;
+    unsigned int m_backlog;
+    size_t m_maxPayload;
+    bool m_noDelay;
+    unsigned int m_queueTimeout;
 };
 
 } // namespace Server
@@ -6,23 +6,49 @@ namespace Tucuxi {
 namespace Server {
 
 ConfigurationReader::ConfigurationReader(const std::string& _filename)
-    : m_filename(_filename), m_port(9090), m_cycleSize(250), m_maxDateInterval(31)
+    : m_filename(_filename), m_port(9090), m_cycleSize(250), m_maxDateInterval(31),
+      m_workerPoolSize(4), m_maxQueueSize(64), m_retryAfter(1), m_drugsDirectory("../tucuserver/drugs"), m_cacheMaxEntries(256), m_cacheMaxMemory(64 * 1024 * 1024), m_cacheTimeToLive(600), m_prettyPrint(true), m_maxJobs(256), m_jobsTimeToLive(3600), m_reactorThreads(2), m_backlog(128), m_maxPayload(1024 * 1024), m_noDelay(true), m_queueTimeout(30)
 {
 
     if(m_xmlDocument.open(m_filename)) {
 
         const string NET_NODE_NAME = "net";
         const string COMPUTATION_NODE_NAME = "computation";
+        const string WORKERS_NODE_NAME = "workers";
+        const string DRUGS_NODE_NAME = "drugs";
+        const string CACHE_NODE_NAME = "cache";
+        const string RESPONSES_NODE_NAME = "responses";
+        const string JOBS_NODE_NAME = "jobs";
 
         Common::XmlNode root = m_xmlDocument.getRoot();
 
         Common::XmlNodeIterator netRootIterator = root.getChildren(NET_NODE_NAME);
         Common::XmlNodeIterator computationRootIterator = root.getChildren(COMPUTATION_NODE_NAME);
+        Common::XmlNodeIterator workersRootIterator = root.getChildren(WORKERS_NODE_NAME);
+        Common::XmlNodeIterator drugsRootIterator = root.getChildren(DRUGS_NODE_NAME);
+        Common::XmlNodeIterator cacheRootIterator = root.getChildren(CACHE_NODE_NAME);
+        Common::XmlNodeIterator responsesRootIterator = root.getChildren(RESPONSES_NODE_NAME);
+        Common::XmlNodeIterator jobsRootIterator = root.getChildren(JOBS_NODE_NAME);
 
         m_port = createPort(netRootIterator);
         m_cycleSize = createCycleSize(computationRootIterator);
         m_maxDateInterval = createMaxDateInterval(computationRootIterator);
         m_maxAdjustments = createMaxAdjustments(computationRootIterator);
+        m_workerPoolSize = createWorkerPoolSize(workersRootIterator);
+        m_maxQueueSize = createMaxQueueSize(workersRootIterator);
+        m_retryAfter = createRetryAfter(workersRootIterator);
+        m_drugsDirectory = createDrugsDirectory(drugsRootIterator);
+        m_cacheMaxEntries = createCacheMaxEntries(cacheRootIterator);
+        m_cacheMaxMemory = createCacheMaxMemory(cacheRootIterator);
+        m_cacheTimeToLive = createCacheTimeToLive(cacheRootIterator);
+        m_prettyPrint = createPrettyPrint(responsesRootIterator);
+        m_maxJobs = createMaxJobs(jobsRootIterator);
+        m_jobsTimeToLive = createJobsTimeToLive(jobsRootIterator);
+        m_reactorThreads = createReactorThreads(netRootIterator);
+        m_backlog = createBacklog(netRootIterator);
+        m_maxPayload = createMaxPayload(netRootIterator);
+        m_noDelay = createNoDelay(netRootIterator);
+        m_queueTimeout = createQueueTimeout(workersRootIterator);
     }
 }
 
@@ -78,6 +104,275 @@ unsigned int ConfigurationReader::createMaxAdjustments(Common::XmlNodeIterator &
     return maxAdjustments;
 }
 
+size_t ConfigurationReader::createWorkerPoolSize(Common::XmlNodeIterator& _workersRootIterator)
+{
+    const string POOL_SIZE_NODE_NAME = "poolSize";
+
+    size_t workerPoolSize = 4;
+    if (_workersRootIterator != _workersRootIterator.none()) {
+        string workerPoolSizeValue = _workersRootIterator->getChildren(POOL_SIZE_NODE_NAME)->getValue();
+        workerPoolSize = stoul(workerPoolSizeValue);
+    }
+
+    return workerPoolSize;
+}
+
+size_t ConfigurationReader::createMaxQueueSize(Common::XmlNodeIterator& _workersRootIterator)
+{
+    const string MAX_QUEUE_SIZE_NODE_NAME = "maxQueueSize";
+
+    size_t maxQueueSize = 64;
+    if (_workersRootIterator != _workersRootIterator.none()) {
+        string maxQueueSizeValue = _workersRootIterator->getChildren(MAX_QUEUE_SIZE_NODE_NAME)->getValue();
+        maxQueueSize = stoul(maxQueueSizeValue);
+    }
+
+    return maxQueueSize;
+}
+
+unsigned int ConfigurationReader::createRetryAfter(Common::XmlNodeIterator& _workersRootIterator)
+{
+    const string RETRY_AFTER_NODE_NAME = "retryAfter";
+
+    unsigned int retryAfter = 1;
+    if (_workersRootIterator != _workersRootIterator.none()) {
+        string retryAfterValue = _workersRootIterator->getChildren(RETRY_AFTER_NODE_NAME)->getValue();
+        retryAfter = stoul(retryAfterValue);
+    }
+
+    return retryAfter;
+}
+
+string ConfigurationReader::createDrugsDirectory(Common::XmlNodeIterator& _drugsRootIterator)
+{
+    const string DIRECTORY_NODE_NAME = "directory";
+
+    string drugsDirectory = "../tucuserver/drugs";
+    if (_drugsRootIterator != _drugsRootIterator.none()) {
+        drugsDirectory = _drugsRootIterator->getChildren(DIRECTORY_NODE_NAME)->getValue();
+    }
+
+    return drugsDirectory;
+}
+
+string ConfigurationReader::getDrugsDirectory() const
+{
+    return m_drugsDirectory;
+}
+
+size_t ConfigurationReader::getWorkerPoolSize() const
+{
+    return m_workerPoolSize;
+}
+
+size_t ConfigurationReader::getMaxQueueSize() const
+{
+    return m_maxQueueSize;
+}
+
+unsigned int ConfigurationReader::getRetryAfter() const
+{
+    return m_retryAfter;
+}
+
+size_t ConfigurationReader::createCacheMaxEntries(Common::XmlNodeIterator& _cacheRootIterator)
+{
+    const string MAX_ENTRIES_NODE_NAME = "maxEntries";
+
+    size_t cacheMaxEntries = 256;
+    if (_cacheRootIterator != _cacheRootIterator.none()) {
+        string cacheMaxEntriesValue = _cacheRootIterator->getChildren(MAX_ENTRIES_NODE_NAME)->getValue();
+        cacheMaxEntries = stoul(cacheMaxEntriesValue);
+    }
+
+    return cacheMaxEntries;
+}
+
+size_t ConfigurationReader::getCacheMaxEntries() const
+{
+    return m_cacheMaxEntries;
+}
+
+size_t ConfigurationReader::createCacheMaxMemory(Common::XmlNodeIterator& _cacheRootIterator)
+{
+    const string MAX_MEMORY_NODE_NAME = "maxMemory";
+
+    size_t cacheMaxMemory = 64 * 1024 * 1024;
+    if (_cacheRootIterator != _cacheRootIterator.none()) {
+        string cacheMaxMemoryValue = _cacheRootIterator->getChildren(MAX_MEMORY_NODE_NAME)->getValue();
+        cacheMaxMemory = stoul(cacheMaxMemoryValue) * 1024 * 1024;
+    }
+
+    return cacheMaxMemory;
+}
+
+size_t ConfigurationReader::getCacheMaxMemory() const
+{
+    return m_cacheMaxMemory;
+}
+
+unsigned int ConfigurationReader::createCacheTimeToLive(Common::XmlNodeIterator& _cacheRootIterator)
+{
+    const string TIME_TO_LIVE_NODE_NAME = "timeToLive";
+
+    unsigned int cacheTimeToLive = 600;
+    if (_cacheRootIterator != _cacheRootIterator.none()) {
+        string cacheTimeToLiveValue = _cacheRootIterator->getChildren(TIME_TO_LIVE_NODE_NAME)->getValue();
+        cacheTimeToLive = stoul(cacheTimeToLiveValue);
+    }
+
+    return cacheTimeToLive;
+}
+
+unsigned int ConfigurationReader::getCacheTimeToLive() const
+{
+    return m_cacheTimeToLive;
+}
+
+bool ConfigurationReader::createPrettyPrint(Common::XmlNodeIterator& _responsesRootIterator)
+{
+    const string PRETTY_PRINT_NODE_NAME = "prettyPrint";
+
+    bool prettyPrint = true;
+    if (_responsesRootIterator != _responsesRootIterator.none()) {
+        string prettyPrintValue = _responsesRootIterator->getChildren(PRETTY_PRINT_NODE_NAME)->getValue();
+        prettyPrint = stoul(prettyPrintValue) != 0;
+    }
+
+    return prettyPrint;
+}
+
+bool ConfigurationReader::getPrettyPrint() const
+{
+    return m_prettyPrint;
+}
+
+unsigned int ConfigurationReader::createMaxJobs(Common::XmlNodeIterator& _jobsRootIterator)
+{
+    const string MAX_JOBS_NODE_NAME = "maxJobs";
+
+    unsigned int maxJobs = 256;
+    if (_jobsRootIterator != _jobsRootIterator.none()) {
+        string maxJobsValue = _jobsRootIterator->getChildren(MAX_JOBS_NODE_NAME)->getValue();
+        maxJobs = stoul(maxJobsValue);
+    }
+
+    return maxJobs;
+}
+
+unsigned int ConfigurationReader::getMaxJobs() const
+{
+    return m_maxJobs;
+}
+
+unsigned int ConfigurationReader::createJobsTimeToLive(Common::XmlNodeIterator& _jobsRootIterator)
+{
+    const string TIME_TO_LIVE_NODE_NAME = "timeToLive";
+
+    unsigned int jobsTimeToLive = 3600;
+    if (_jobsRootIterator != _jobsRootIterator.none()) {
+        string jobsTimeToLiveValue = _jobsRootIterator->getChildren(TIME_TO_LIVE_NODE_NAME)->getValue();
+        jobsTimeToLive = stoul(jobsTimeToLiveValue);
+    }
+
+    return jobsTimeToLive;
+}
+
+unsigned int ConfigurationReader::getJobsTimeToLive() const
+{
+    return m_jobsTimeToLive;
+}
+
+unsigned int ConfigurationReader::createReactorThreads(Common::XmlNodeIterator& _netRootIterator)
+{
+    const string REACTOR_THREADS_NODE_NAME = "reactorThreads";
+
+    unsigned int reactorThreads = 2;
+    if (_netRootIterator != _netRootIterator.none()) {
+        string reactorThreadsValue = _netRootIterator->getChildren(REACTOR_THREADS_NODE_NAME)->getValue();
+        reactorThreads = stoul(reactorThreadsValue);
+    }
+
+    return reactorThreads;
+}
+
+unsigned int ConfigurationReader::getReactorThreads() const
+{
+    return m_reactorThreads;
+}
+
+unsigned int ConfigurationReader::createBacklog(Common::XmlNodeIterator& _netRootIterator)
+{
+    const string BACKLOG_NODE_NAME = "backlog";
+
+    unsigned int backlog = 128;
+    if (_netRootIterator != _netRootIterator.none()) {
+        string backlogValue = _netRootIterator->getChildren(BACKLOG_NODE_NAME)->getValue();
+        backlog = stoul(backlogValue);
+    }
+
+    return backlog;
+}
+
+unsigned int ConfigurationReader::getBacklog() const
+{
+    return m_backlog;
+}
+
+size_t ConfigurationReader::createMaxPayload(Common::XmlNodeIterator& _netRootIterator)
+{
+    const string MAX_PAYLOAD_NODE_NAME = "maxPayload";
+
+    size_t maxPayload = 1024 * 1024;
+    if (_netRootIterator != _netRootIterator.none()) {
+        string maxPayloadValue = _netRootIterator->getChildren(MAX_PAYLOAD_NODE_NAME)->getValue();
+        maxPayload = stoul(maxPayloadValue) * 1024;
+    }
+
+    return maxPayload;
+}
+
+size_t ConfigurationReader::getMaxPayload() const
+{
+    return m_maxPayload;
+}
+
+bool ConfigurationReader::createNoDelay(Common::XmlNodeIterator& _netRootIterator)
+{
+    const string NO_DELAY_NODE_NAME = "noDelay";
+
+    bool noDelay = true;
+    if (_netRootIterator != _netRootIterator.none()) {
+        string noDelayValue = _netRootIterator->getChildren(NO_DELAY_NODE_NAME)->getValue();
+        noDelay = stoul(noDelayValue) != 0;
+    }
+
+    return noDelay;
+}
+
+bool ConfigurationReader::getNoDelay() const
+{
+    return m_noDelay;
+}
+
+unsigned int ConfigurationReader::createQueueTimeout(Common::XmlNodeIterator& _workersRootIterator)
+{
+    const string QUEUE_TIMEOUT_NODE_NAME = "queueTimeout";
+
+    unsigned int queueTimeout = 30;
+    if (_workersRootIterator != _workersRootIterator.none()) {
+        string queueTimeoutValue = _workersRootIterator->getChildren(QUEUE_TIMEOUT_NODE_NAME)->getValue();
+        queueTimeout = stoul(queueTimeoutValue);
+    }
+
+    return queueTimeout;
+}
+
+unsigned int ConfigurationReader::getQueueTimeout() const
+{
+    return m_queueTimeout;
+}
+
 unsigned int ConfigurationReader::getMaxAdjustments() const
 {
     return m_maxAdjustments;
@@ -20,12 +20,42 @@ public:
     Core::CycleSize getCycleSize() const;
     unsigned int getMaxDateInterval() const;
     unsigned int getMaxAdjustments() const;
+    size_t getWorkerPoolSize() const;
+    size_t getMaxQueueSize() const;
+    unsigned int getRetryAfter() const;
+    std::string getDrugsDirectory() const;
+    size_t getCacheMaxEntries() const;
+    size_t getCacheMaxMemory() const;
+    unsigned int getCacheTimeToLive() const;
+    bool getPrettyPrint() const;
+    unsigned int getMaxJobs() const;
+    unsigned int getJobsTimeToLive() const;
+    unsigned int getReactorThreads() const;
+    unsigned int getBacklog() const;
+    size_t getMaxPayload() const;
+    bool getNoDelay() const;
+    unsigned int getQueueTimeout() const;
 
 protected:
     uint16_t createPort(Common::XmlNodeIterator& _netRootIterator);
     Core::CycleSize createCycleSize(Common::XmlNodeIterator& _computationRootIterator);
     unsigned int createMaxDateInterval(Common::XmlNodeIterator& _computationRootIterator);
     unsigned int createMaxAdjustments(Common::XmlNodeIterator& _computationRootIterator);
+    size_t createWorkerPoolSize(Common::XmlNodeIterator& _workersRootIterator);
+    size_t createMaxQueueSize(Common::XmlNodeIterator& _workersRootIterator);
+    unsigned int createRetryAfter(Common::XmlNodeIterator& _workersRootIterator);
+    std::string createDrugsDirectory(Common::XmlNodeIterator& _drugsRootIterator);
+    size_t createCacheMaxEntries(Common::XmlNodeIterator& _cacheRootIterator);
+    size_t createCacheMaxMemory(Common::XmlNodeIterator& _cacheRootIterator);
+    unsigned int createCacheTimeToLive(Common::XmlNodeIterator& _cacheRootIterator);
+    bool createPrettyPrint(Common::XmlNodeIterator& _responsesRootIterator);
+    unsigned int createMaxJobs(Common::XmlNodeIterator& _jobsRootIterator);
+    unsigned int createJobsTimeToLive(Common::XmlNodeIterator& _jobsRootIterator);
+    unsigned int createReactorThreads(Common::XmlNodeIterator& _netRootIterator);
+    unsigned int createBacklog(Common::XmlNodeIterator& _netRootIterator);
+    size_t createMaxPayload(Common::XmlNodeIterator& _netRootIterator);
+    bool createNoDelay(Common::XmlNodeIterator& _netRootIterator);
+    unsigned int createQueueTimeout(Common::XmlNodeIterator& _workersRootIterator);
 
 protected:
     std::string m_filename;
@@ -35,6 +65,21 @@ protected:
     Core::CycleSize m_cycleSize;
     unsigned int m_maxDateInterval;
     unsigned int m_maxAdjustments;
+    size_t m_workerPoolSize;
+    size_t m_maxQueueSize;
+    unsigned int m_retryAfter;
+    std::string m_drugsDirectory;
+    size_t m_cacheMaxEntries;
+    size_t m_cacheMaxMemory;
+    unsigned int m_cacheTimeToLive;
+    bool m_prettyPrint;
+    unsigned int m_maxJobs;
+    unsigned int m_jobsTimeToLive;
+    unsigned int m_reactorThreads;
+    unsigned int m_backlog;
+    size_t m_maxPayload;
+    bool m_noDelay;
+    unsigned int m_queueTimeout;
 };
 
 } // namespace Server
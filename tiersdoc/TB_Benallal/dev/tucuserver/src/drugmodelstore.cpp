@@ -0,0 +1,264 @@
+#include "drugmodelstore.h"
+
+#include <algorithm>
+#include <dirent.h>
+#include <fstream>
+#include <sstream>
+
+#include "sha256.h"
+
+using namespace std;
+using namespace Tucuxi::Core;
+
+namespace Tucuxi {
+namespace Server {
+
+DrugModelSnapshot::DrugModelSnapshot(unsigned int _version, DrugModelEntries _entries)
+    : m_version(_version), m_entries(move(_entries))
+{
+    m_summary = "<drugs>";
+    for (const auto& entry : m_entries) {
+        m_summary += entry.second->m_summary;
+    }
+    m_summary += "</drugs>";
+
+    m_etag = DrugModelStore::computeEtag(m_summary);
+}
+
+shared_ptr<const DrugModel> DrugModelSnapshot::getDrugModel(const string& _drugID) const
+{
+    shared_ptr<const DrugModelEntry> entry = getEntry(_drugID);
+    if (entry == nullptr) {
+        return nullptr;
+    }
+
+    return entry->m_drugModel;
+}
+
+shared_ptr<const DrugModelEntry> DrugModelSnapshot::getEntry(const string& _drugID) const
+{
+    DrugModelEntries::const_iterator it = m_entries.find(_drugID);
+    if (it == m_entries.end()) {
+        return nullptr;
+    }
+
+    return it->second;
+}
+
+const DrugModelSnapshot::DrugModelEntries& DrugModelSnapshot::getEntries() const
+{
+    return m_entries;
+}
+
+size_t DrugModelSnapshot::getNbDrugModels() const
+{
+    return m_entries.size();
+}
+
+unsigned int DrugModelSnapshot::getVersion() const
+{
+    return m_version;
+}
+
+const string& DrugModelSnapshot::getSummary() const
+{
+    return m_summary;
+}
+
+const string& DrugModelSnapshot::getEtag() const
+{
+    return m_etag;
+}
+
+DrugModelStore* DrugModelStore::m_sDrugModelStore = nullptr;
+
+DrugModelStore* DrugModelStore::getInstance()
+{
+    if (m_sDrugModelStore == nullptr) {
+        m_sDrugModelStore = new DrugModelStore(Configuration::getInstance()->getDrugsDirectory());
+        vector<string> failedFiles;
+        m_sDrugModelStore->reload(failedFiles);
+    }
+
+    return m_sDrugModelStore;
+}
+
+DrugModelStore::DrugModelStore(const string& _drugsDirectory)
+    : m_drugsDirectory(_drugsDirectory),
+      m_snapshot(make_shared<const DrugModelSnapshot>(0, DrugModelSnapshot::DrugModelEntries())),
+      m_lastVersion(0)
+{}
+
+shared_ptr<const DrugModelSnapshot> DrugModelStore::getSnapshot() const
+{
+    return atomic_load(&m_snapshot);
+}
+
+bool DrugModelStore::reload(vector<string>& _failedFiles)
+{
+    vector<string> files;
+    if (!listDrugFiles(m_drugsDirectory, files)) {
+        return false;
+    }
+
+    // The import is done outside of the write lock, the current snapshot stays in use meanwhile.
+    DrugModelSnapshot::DrugModelEntries entries;
+    for (const string& file : files) {
+        string drugModelXml;
+        shared_ptr<const DrugModelEntry> entry;
+        if (readFile(m_drugsDirectory + "/" + file, drugModelXml)) {
+            entry = createEntry(drugModelXml);
+        }
+
+        // A file is also skipped if another one already provides a model for the same drug.
+        if (entry == nullptr || !entries.emplace(entry->m_drugModel->getDrugId(), entry).second) {
+            _failedFiles.push_back(file);
+        }
+    }
+
+    lock_guard<mutex> lock(m_writeMutex);
+    publish(move(entries));
+
+    return true;
+}
+
+DrugModelStore::Result DrugModelStore::add(const string& _drugModelXml, string& _drugID)
+{
+    shared_ptr<const DrugModelEntry> entry = createEntry(_drugModelXml);
+    if (entry == nullptr) {
+        return Result::InvalidDrugModel;
+    }
+    _drugID = entry->m_drugModel->getDrugId();
+
+    lock_guard<mutex> lock(m_writeMutex);
+    DrugModelSnapshot::DrugModelEntries entries = getSnapshot()->getEntries();
+    if (!entries.emplace(_drugID, entry).second) {
+        return Result::AlreadyExists;
+    }
+    publish(move(entries));
+
+    return Result::Ok;
+}
+
+DrugModelStore::Result DrugModelStore::edit(const string& _drugID, const string& _drugModelXml)
+{
+    shared_ptr<const DrugModelEntry> entry = createEntry(_drugModelXml);
+    if (entry == nullptr) {
+        return Result::InvalidDrugModel;
+    }
+    if (entry->m_drugModel->getDrugId() != _drugID) {
+        return Result::DrugIDMismatch;
+    }
+
+    lock_guard<mutex> lock(m_writeMutex);
+    DrugModelSnapshot::DrugModelEntries entries = getSnapshot()->getEntries();
+    DrugModelSnapshot::DrugModelEntries::iterator it = entries.find(_drugID);
+    if (it == entries.end()) {
+        return Result::NotFound;
+    }
+    it->second = entry;
+    publish(move(entries));
+
+    return Result::Ok;
+}
+
+DrugModelStore::Result DrugModelStore::remove(const string& _drugID)
+{
+    lock_guard<mutex> lock(m_writeMutex);
+    DrugModelSnapshot::DrugModelEntries entries = getSnapshot()->getEntries();
+    if (entries.erase(_drugID) == 0) {
+        return Result::NotFound;
+    }
+    publish(move(entries));
+
+    return Result::Ok;
+}
+
+const string& DrugModelStore::getDrugsDirectory() const
+{
+    return m_drugsDirectory;
+}
+
+string DrugModelStore::computeEtag(const string& _content)
+{
+    // A digest of the content, stable across builds, so that the clients' validators remain valid.
+    return '"' + sha256Hex(_content) + '"';
+}
+
+shared_ptr<const DrugModelEntry> DrugModelStore::createEntry(const string& _drugModelXml)
+{
+    const string HEAD_START_TAG = "<head>";
+    const string HEAD_END_TAG = "</head>";
+
+    DrugModel* drugModel = nullptr;
+    DrugModelImport drugModelImport;
+    if (drugModelImport.importFromString(drugModel, _drugModelXml) != DrugModelImport::Result::Ok) {
+        delete drugModel;
+        return nullptr;
+    }
+
+    shared_ptr<DrugModelEntry> entry = make_shared<DrugModelEntry>();
+    entry->m_drugModel = shared_ptr<const DrugModel>(drugModel);
+
+    entry->m_summary = "<drug><drugId>" + drugModel->getDrugId() + "</drugId>" +
+            "<drugModelId>" + drugModel->getDrugModelId() + "</drugModelId>";
+
+    // The head node is copied as is from the drug file, it is the description clients display.
+    size_t headStart = _drugModelXml.find(HEAD_START_TAG);
+    size_t headEnd = _drugModelXml.find(HEAD_END_TAG, headStart);
+    if (headStart != string::npos && headEnd != string::npos) {
+        entry->m_summary += _drugModelXml.substr(headStart, headEnd + HEAD_END_TAG.size() - headStart);
+    }
+    entry->m_summary += "</drug>";
+
+    entry->m_etag = computeEtag(entry->m_summary);
+
+    return entry;
+}
+
+void DrugModelStore::publish(DrugModelSnapshot::DrugModelEntries _entries)
+{
+    // The caller holds m_writeMutex.
+    atomic_store(&m_snapshot, shared_ptr<const DrugModelSnapshot>(make_shared<const DrugModelSnapshot>(++m_lastVersion, move(_entries))));
+}
+
+bool DrugModelStore::listDrugFiles(const string& _drugsDirectory, vector<string>& _files)
+{
+    const string DRUG_FILE_EXTENSION = ".xml";
+
+    DIR* directory = opendir(_drugsDirectory.c_str());
+    if (directory == nullptr) {
+        return false;
+    }
+
+    while (dirent* entry = readdir(directory)) {
+        string name = entry->d_name;
+        if (name.size() > DRUG_FILE_EXTENSION.size() &&
+                name.compare(name.size() - DRUG_FILE_EXTENSION.size(), DRUG_FILE_EXTENSION.size(), DRUG_FILE_EXTENSION) == 0) {
+            _files.push_back(name);
+        }
+    }
+    closedir(directory);
+
+    // The directory order is not specified, sorting makes the loading reproducible.
+    sort(_files.begin(), _files.end());
+
+    return true;
+}
+
+bool DrugModelStore::readFile(const string& _filename, string& _content)
+{
+    ifstream file(_filename);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    ostringstream content;
+    content << file.rdbuf();
+    _content = content.str();
+
+    return true;
+}
+
+} // namespace Server
+} // namespace Tucuxi
@@ -0,0 +1,117 @@
+#ifndef TUCUXI_SERVER_DRUGMODELSTORE_H
+#define TUCUXI_SERVER_DRUGMODELSTORE_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "tucucore/drugmodel/drugmodel.h"
+#include "tucucore/drugmodelimport.h"
+
+#include "configuration.h"
+
+namespace Tucuxi {
+namespace Server {
+
+// A loaded drug model with its summary, computed once when the model is imported.
+struct DrugModelEntry
+{
+    std::shared_ptr<const Core::DrugModel> m_drugModel;
+
+    // <drug> node with the identifiers and the <head> node of the drug file.
+    std::string m_summary;
+    std::string m_etag;
+};
+
+// Immutable set of drug models, indexed by drug ID.
+// A computation keeps the snapshot it started with, whatever is published meanwhile.
+class DrugModelSnapshot
+{
+public:
+    typedef std::map<std::string, std::shared_ptr<const DrugModelEntry> > DrugModelEntries;
+
+    DrugModelSnapshot(unsigned int _version, DrugModelEntries _entries);
+
+    // Returns nullptr if no model is known for the drug.
+    std::shared_ptr<const Core::DrugModel> getDrugModel(const std::string& _drugID) const;
+    std::shared_ptr<const DrugModelEntry> getEntry(const std::string& _drugID) const;
+    const DrugModelEntries& getEntries() const;
+    size_t getNbDrugModels() const;
+    unsigned int getVersion() const;
+
+    // <drugs> node gathering the summaries of all the drugs, built once per snapshot.
+    const std::string& getSummary() const;
+    const std::string& getEtag() const;
+
+protected:
+    const unsigned int m_version;
+    const DrugModelEntries m_entries;
+    std::string m_summary;
+    std::string m_etag;
+};
+
+// Holds the drug models of the configured directory in memory.
+// The readers get the current snapshot without locking. The writers build a new snapshot
+// aside (copy-on-write) and swap it atomically, so no request ever sees a half-loaded state.
+class DrugModelStore
+{
+public:
+    enum class Result {
+        Ok,
+        InvalidDrugModel,
+        AlreadyExists,
+        NotFound,
+        DrugIDMismatch
+    };
+
+    static DrugModelStore* getInstance();
+
+    DrugModelStore(const std::string& _drugsDirectory);
+    DrugModelStore(DrugModelStore& other) = delete;
+
+    std::shared_ptr<const DrugModelSnapshot> getSnapshot() const;
+
+    // Loads every drug model file (*.xml) of the directory and publishes them.
+    // The files that cannot be imported are skipped and added to _failedFiles.
+    // Returns false, keeping the current snapshot, if the directory cannot be read.
+    bool reload(std::vector<std::string>& _failedFiles);
+
+    // Imports a drug model and publishes it under its drug ID, if no model exists yet for it.
+    Result add(const std::string& _drugModelXml, std::string& _drugID);
+
+    // Imports a drug model and publishes it in place of the existing model of _drugID.
+    Result edit(const std::string& _drugID, const std::string& _drugModelXml);
+
+    Result remove(const std::string& _drugID);
+
+    const std::string& getDrugsDirectory() const;
+
+    static std::string computeEtag(const std::string& _content);
+
+protected:
+    static std::shared_ptr<const DrugModelEntry> createEntry(const std::string& _drugModelXml);
+
+    void publish(DrugModelSnapshot::DrugModelEntries _entries);
+
+    static bool listDrugFiles(const std::string& _drugsDirectory, std::vector<std::string>& _files);
+    static bool readFile(const std::string& _filename, std::string& _content);
+
+protected:
+    static DrugModelStore* m_sDrugModelStore;
+
+    const std::string m_drugsDirectory;
+
+    // Accessed with the atomic_load/atomic_store overloads only.
+    std::shared_ptr<const DrugModelSnapshot> m_snapshot;
+
+    // Serializes the writers, the readers never take it.
+    std::mutex m_writeMutex;
+    unsigned int m_lastVersion;
+};
+
+} // namespace Server
+} // namespace Tucuxi
+
+#endif // TUCUXI_SERVER_DRUGMODELSTORE_H
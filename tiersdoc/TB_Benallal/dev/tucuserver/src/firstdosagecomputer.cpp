@@ -6,30 +6,32 @@ using namespace Tucuxi::Core;
 namespace Tucuxi {
 namespace Server {
 
-FirstDosageComputer::FirstDosageComputer(const Query& _query)
-    : Computer (_query)
+FirstDosageComputer::FirstDosageComputer(const Query& _query, size_t _requestPosition, shared_ptr<const DrugModelSnapshot> _drugModels)
+    : Computer(_query, _requestPosition, move(_drugModels))
 {}
 
 void FirstDosageComputer::compute()
 {
     // Getting the drug related to the request
-    string drugID = m_query.getRequests().at(0)->getDrugID();
-    const vector< unique_ptr<DrugData> >& drugs = m_query.getpParameters().getDrugs();
-    size_t drugPosition = 0;
-    for (; drugPosition < drugs.size(); ++drugPosition) {
-        if (drugs.at(drugPosition)->getDrugID() == drugID) {
-            break;
-        }
+    string drugID = getRequest().getDrugID();
+    size_t drugPosition = findDrugPosition();
+    if (drugPosition == m_query.getpParameters().getDrugs().size()) {
+        // The error response is set directly: getResult() would add a "ComputationError" before it.
+        unique_ptr<ApiResponseAdjustment> apiResponse = make_unique<ApiResponseAdjustment>(m_query.getQueryID(), getRequest().getRequestID());
+        apiResponse->addError("UnknownDrug", m_query.getLanguage(), "No parameters for drug " + drugID + ".");
+        m_result = move(apiResponse);
+        return;
     }
 
     IComputingService* component = dynamic_cast<IComputingService*>(ComputingComponent::createComponent());
 
-    // Getting the drug model
-    DrugModel* drugModel;
-    DrugModelImport drugModelImport;
-    DrugModelImport::Result importResult = drugModelImport.importFromFile(drugModel, "../tucuserver/drugs/ch.tucuxi.busulfan_children.xml");
-    if (importResult != DrugModelImport::Result::Ok) {
-        m_result->addError("DrugImportError", m_query.getLanguage(), "Error while importing drug model.");
+    // Getting the drug model, the snapshot keeps it alive even if the store is reloaded meanwhile
+    shared_ptr<const DrugModel> drugModel = m_drugModels->getDrugModel(drugID);
+    if (drugModel == nullptr) {
+        unique_ptr<ApiResponseAdjustment> apiResponse = make_unique<ApiResponseAdjustment>(m_query.getQueryID(), getRequest().getRequestID());
+        apiResponse->addError("UnknownDrugModel", m_query.getLanguage(), "No drug model available for drug " + drugID + ".");
+        m_result = move(apiResponse);
+        delete component;
         return;
     }
 
@@ -49,9 +51,9 @@ void FirstDosageComputer::compute()
     }
 
     // Creating the adjustment trait
-    RequestResponseId requestResponseID = 1; //m_query.getRequests().at(0)->getRequestID();
-    Common::DateTime start = m_query.getRequests().at(0)->getpDateInterval().getStart();
-    Common::DateTime end = m_query.getRequests().at(0)->getpDateInterval().getEnd();
+    RequestResponseId requestResponseID = 1; //getRequest().getRequestID();
+    Common::DateTime start = getRequest().getpDateInterval().getStart();
+    Common::DateTime end = getRequest().getpDateInterval().getEnd();
     Common::DateTime adjustmentTime(start);
 
     if ((end - start).toDays() > Configuration::getInstance()->getMaxDateInterval()) {
@@ -59,7 +61,7 @@ void FirstDosageComputer::compute()
         end = start + Common::Duration(chrono::hours(24) * Configuration::getInstance()->getMaxDateInterval());
     }
 
-    string predictionType = m_query.getRequests().at(0)->getPredictionType();
+    string predictionType = getRequest().getPredictionType();
     PredictionParameterType predictionParamaterType = PredictionParameterType::Population;
     if (predictionType == "population") {
         predictionParamaterType = PredictionParameterType::Population;
@@ -111,7 +113,6 @@ void FirstDosageComputer::compute()
     }
 
     // Delete all dynamically allocated objects
-    delete drugModel;
     delete component;
 }
 
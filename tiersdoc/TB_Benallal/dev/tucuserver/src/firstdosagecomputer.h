@@ -2,6 +2,7 @@
 #define TUCUXI_SERVER_FIRSTDOSAGECOMPUTER_H
 
 #include "computer.h"
+#include "drugmodelstore.h"
 
 #include "tucucore/computingservice/computingrequest.h"
 #include "tucucore/computingservice/computingresponse.h"
@@ -15,7 +16,7 @@ namespace Server {
 class FirstDosageComputer : public Computer
 {
 public:
-    FirstDosageComputer(const Query& _query);
+    FirstDosageComputer(const Query& _query, size_t _requestPosition, std::shared_ptr<const DrugModelSnapshot> _drugModels);
 
     void compute();
 };
@@ -12,6 +12,8 @@
 
 #include "ComputationApiImpl.h"
 
+#include <sstream>
+
 namespace Tucuxi {
 namespace Server {
 namespace API {
@@ -22,42 +24,128 @@ ComputationApiImpl::ComputationApiImpl(std::shared_ptr<Pistache::Http::Endpoint>
     : ComputationApi(_pEndpoint, _pRouter)
     { }
 
-void ComputationApiImpl::compute_requests(const Query& _query, Pistache::Http::ResponseWriter& _response) {
-
-    std::string requestType = _query.getRequests()
-                                    .at(0)
-                                    ->getRequestType();
-    unique_ptr<Computer> computer;
-    unique_ptr<ApiResponseWriter> apiResponseWriter;
-
-    if (requestType == "prediction") {
-        computer = make_unique<PredictionComputer>(_query);
-    } else if (requestType == "dosageAdaptation") {
-        computer = make_unique<AdjustmentComputer>(_query);
-        apiResponseWriter = make_unique<ApiResponseAdjustmentWriter>();
-    } else if (requestType == "firstDosage") {
-        computer = make_unique<FirstDosageComputer>(_query);
+void ComputationApiImpl::compute_requests(const Query& _query, std::shared_ptr<const DrugModelSnapshot> _drugModels, const std::string& _cacheKey, const ComputationFormat& _format, Pistache::Http::ResponseWriter& _response) {
+
+    ApiResponseAdjustmentWriter apiResponseWriter;
+    string error;
+    if (!computeResponses(_query, _drugModels, apiResponseWriter, error, nullptr)) {
+        _response.send(Pistache::Http::Code::Bad_Request, error);
+        return;
+    }
+
+    // The responses are serialized in the order of the requests, and sent while they are serialized
+    std::chrono::steady_clock::time_point serializeStart = std::chrono::steady_clock::now();
+    const Pistache::Http::Mime::MediaType mime = _format.m_isJsonResponse ? MIME(Application, Json) : MIME(Application, Xml);
+    Pistache::Http::ResponseStream stream = startChunkedResponse(_response, Pistache::Http::Code::Ok, mime, _format.m_isGzip);
+    ChunkedResponseBuffer buffer(stream, _format.m_isGzip);
+
+    // The cache gets a copy of the uncompressed response, unless it would not fit in the cache anyway
+    string xmlApiResponse;
+    if (!_cacheKey.empty()) {
+        buffer.setCopy(&xmlApiResponse, ResponseCache::getInstance()->getMaxMemory());
+    }
+
+    ostream output(&buffer);
+    if (_format.m_isJsonResponse) {
+        apiResponseWriter.serializeJson(output, Configuration::getInstance()->getPrettyPrint());
     } else {
-        _response.send(Pistache::Http::Code::Bad_Request, "Invalid request type (" + requestType + ")");
+        apiResponseWriter.serialize(output, Configuration::getInstance()->getPrettyPrint());
+    }
+    bool isSent = buffer.finish();
+    m_pComputationMetrics->observePhase(Phase::Serialize, std::chrono::steady_clock::now() - serializeStart);
+
+    if (isSent && buffer.isCopyComplete()) {
+        ResponseCache::getInstance()->put(_cacheKey, xmlApiResponse);
+    }
+}
+
+void ComputationApiImpl::compute_job(const Query& _query, std::shared_ptr<const DrugModelSnapshot> _drugModels, const ComputationFormat& _format, Job& _job) {
+
+    ApiResponseAdjustmentWriter apiResponseWriter;
+    string error;
+    if (!computeResponses(_query, _drugModels, apiResponseWriter, error, &_job)) {
+        _job.fail(error);
+        return;
+    }
+
+    if (_job.isCancelled()) {
         return;
     }
 
-    /*
-    Tucuxi::Core::ComputationResult computationResult = computer->compute();
-    if (computationResult != Tucuxi::Core::ComputationResult::Success) {
-        string error = "Failure within the computation of the request!";
-        _response.send(Pistache::Http::Code::Internal_Server_Error, error);
+    // The response is kept uncompressed, it is encoded for each client retrieving it
+    std::chrono::steady_clock::time_point serializeStart = std::chrono::steady_clock::now();
+    ostringstream output;
+    if (_format.m_isJsonResponse) {
+        apiResponseWriter.serializeJson(output, Configuration::getInstance()->getPrettyPrint());
     } else {
-        _response.send(Pistache::Http::Code::Ok, computer->getResult());
+        apiResponseWriter.serialize(output, Configuration::getInstance()->getPrettyPrint());
     }
-    */
-    computer->compute();
-    ApiResponse& apiResponse = computer->getResult();
-    apiResponseWriter->addApiResponse(apiResponse);
-    string xmlApiResponse = apiResponseWriter->serialize();
-
-    //_response.send(Pistache::Http::Code::Ok, computer->getResult().getQueryID());
-    _response.send(Pistache::Http::Code::Ok, xmlApiResponse);
+    m_pComputationMetrics->observePhase(Phase::Serialize, std::chrono::steady_clock::now() - serializeStart);
+
+    _job.finish(output.str());
+}
+
+bool ComputationApiImpl::computeResponses(const Query& _query, const std::shared_ptr<const DrugModelSnapshot>& _drugModels, ApiResponseWriter& _apiResponseWriter, std::string& _error, const Job* _pJob) const {
+
+    // Creating a computer for each request, the whole query is refused if one of them is invalid
+    vector< unique_ptr<Computer> > computers;
+    for (size_t i = 0; i < _query.getRequests().size(); i++) {
+        std::string requestType = _query.getRequests().at(i)->getRequestType();
+
+        if (requestType == "prediction") {
+            computers.push_back(make_unique<PredictionComputer>(_query, i, _drugModels));
+        } else if (requestType == "dosageAdaptation") {
+            computers.push_back(make_unique<AdjustmentComputer>(_query, i, _drugModels));
+        } else if (requestType == "firstDosage") {
+            computers.push_back(make_unique<FirstDosageComputer>(_query, i, _drugModels));
+        } else {
+            _error = "Invalid request type (" + requestType + ")";
+            return false;
+        }
+    }
+
+    // The requests are independent, they are computed in parallel on the worker pool
+    vector<WorkerPool::Task> tasks;
+    for (unique_ptr<Computer>& computer : computers) {
+        Computer* pComputer = computer.get();
+        tasks.push_back([pComputer, &_query, _pJob]() {
+            if (_pJob != nullptr && _pJob->isCancelled()) {
+                return;
+            }
+
+            try {
+                pComputer->compute();
+            } catch (std::exception& e) {
+                pComputer->getResult().addError("ComputationError", _query.getLanguage(), e.what());
+            }
+        });
+    }
+    std::chrono::steady_clock::time_point computeStart = std::chrono::steady_clock::now();
+    WorkerPool::getInstance()->runAll(tasks);
+    m_pComputationMetrics->observePhase(Phase::Compute, std::chrono::steady_clock::now() - computeStart);
+
+    for (unique_ptr<Computer>& computer : computers) {
+        _apiResponseWriter.addApiResponse(computer->releaseResult());
+    }
+
+    return true;
+}
+
+void ComputationApiImpl::get_cache_stats(Pistache::Http::ResponseWriter& _response) {
+    ResponseCache* responseCache = ResponseCache::getInstance();
+
+    string stats = "<cache>";
+    stats += "<entries>" + to_string(responseCache->getNbEntries()) + "</entries>";
+    stats += "<maxEntries>" + to_string(responseCache->getMaxEntries()) + "</maxEntries>";
+    stats += "<memory>" + to_string(responseCache->getMemory()) + "</memory>";
+    stats += "<maxMemory>" + to_string(responseCache->getMaxMemory()) + "</maxMemory>";
+    stats += "<hits>" + to_string(responseCache->getNbHits()) + "</hits>";
+    stats += "<misses>" + to_string(responseCache->getNbMisses()) + "</misses>";
+    stats += "<evictions>" + to_string(responseCache->getNbEvictions()) + "</evictions>";
+    stats += "<expirations>" + to_string(responseCache->getNbExpirations()) + "</expirations>";
+    stats += "</cache>";
+
+    _response.send(Pistache::Http::Code::Ok, stats, MIME(Application, Xml));
 }
 
 } // namespace API
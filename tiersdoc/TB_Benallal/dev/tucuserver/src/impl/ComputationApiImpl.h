@@ -32,6 +32,10 @@
 #include "../adjustmentcomputer.h"
 #include "../firstdosagecomputer.h"
 #include "../communication/apiresponsewriter.h"
+#include "../workerpool.h"
+#include "../responsecache.h"
+#include "../metrics.h"
+#include "../jobstore.h"
 
 namespace Tucuxi {
 namespace Server {
@@ -42,7 +46,15 @@ public:
     ComputationApiImpl(std::shared_ptr<Pistache::Http::Endpoint> _pEndpoint, std::shared_ptr<Pistache::Rest::Router> _pRouter);
     ~ComputationApiImpl() { }
 
-    void compute_requests(const Query& _query, Pistache::Http::ResponseWriter& _response);
+    void compute_requests(const Query& _query, std::shared_ptr<const DrugModelSnapshot> _drugModels, const std::string& _cacheKey, const ComputationFormat& _format, Pistache::Http::ResponseWriter& _response);
+    void compute_job(const Query& _query, std::shared_ptr<const DrugModelSnapshot> _drugModels, const ComputationFormat& _format, Job& _job);
+    void get_cache_stats(Pistache::Http::ResponseWriter& _response);
+
+protected:
+    // Computes the requests of the query in parallel and adds their responses to the writer.
+    // Returns false, with the reason in _error, if a request of the query is invalid.
+    // The requests not started yet are skipped once the job, if any, is cancelled.
+    bool computeResponses(const Query& _query, const std::shared_ptr<const DrugModelSnapshot>& _drugModels, ApiResponseWriter& _apiResponseWriter, std::string& _error, const Job* _pJob) const;
 
 };
 
@@ -20,55 +20,91 @@ DrugsApiImpl::DrugsApiImpl(std::shared_ptr<Pistache::Http::Endpoint> _pEndpoint,
     : DrugsApi(_pEndpoint, _pRouter)
     { }
 
-void DrugsApiImpl::add_drug(const Query& _query, Pistache::Http::ResponseWriter& _response) {
-    std::string mandatorFirstName = _query.getpAdmin()
-                                    .getpMandator()
-                                    .getpPerson()
-                                    .getFirstName();
-    std::string mandatorLastName = _query.getpAdmin()
-                                    .getpMandator()
-                                    .getpPerson()
-                                    .getLastName();
-
-    std::string text = "This request was sent by mandator: " +
-            mandatorFirstName + " " + mandatorLastName +
-            " on the drugs endpoint.";
+void DrugsApiImpl::add_drug(const std::string& _drugModelXml, Pistache::Http::ResponseWriter& _response) {
+    std::string drugID;
+    DrugModelStore::Result result = DrugModelStore::getInstance()->add(_drugModelXml, drugID);
 
-    _response.send(Pistache::Http::Code::Ok, text);
+    if (result == DrugModelStore::Result::InvalidDrugModel) {
+        _response.send(Pistache::Http::Code::Bad_Request, "The drug model cannot be imported.");
+    } else if (result == DrugModelStore::Result::AlreadyExists) {
+        _response.send(Pistache::Http::Code::Conflict, "A drug model already exists for drug " + drugID + ".");
+    } else {
+        _response.headers().add<Pistache::Http::Header::Location>("/drugs/" + drugID);
+        _response.send(Pistache::Http::Code::Created, "Drug model added for drug " + drugID + ".");
+    }
 }
 
 void DrugsApiImpl::delete_drug(const std::string& _drugID, Pistache::Http::ResponseWriter& _response) {
-    std::string text = "Request received on the drugs endpoint with id: " + _drugID;
-    _response.send(Pistache::Http::Code::Ok, text);
+    DrugModelStore::Result result = DrugModelStore::getInstance()->remove(_drugID);
+
+    if (result == DrugModelStore::Result::NotFound) {
+        _response.send(Pistache::Http::Code::Not_Found, "No drug model for drug " + _drugID + ".");
+    } else {
+        _response.send(Pistache::Http::Code::Ok, "Drug model deleted for drug " + _drugID + ".");
+    }
 }
 
-void DrugsApiImpl::edit_drug(const std::string& _drugID, const Query& _query, Pistache::Http::ResponseWriter& _response) {
-    std::string mandatorFirstName = _query.getpAdmin()
-                                    .getpMandator()
-                                    .getpPerson()
-                                    .getFirstName();
-    std::string mandatorLastName = _query.getpAdmin()
-                                    .getpMandator()
-                                    .getpPerson()
-                                    .getLastName();
+void DrugsApiImpl::edit_drug(const std::string& _drugID, const std::string& _drugModelXml, Pistache::Http::ResponseWriter& _response) {
+    DrugModelStore::Result result = DrugModelStore::getInstance()->edit(_drugID, _drugModelXml);
 
-    std::string text = "This request was sent by mandator: " +
-            mandatorFirstName + " " + mandatorLastName +
-            " on the drugs endpoint with id: " + _drugID;
+    if (result == DrugModelStore::Result::InvalidDrugModel) {
+        _response.send(Pistache::Http::Code::Bad_Request, "The drug model cannot be imported.");
+    } else if (result == DrugModelStore::Result::DrugIDMismatch) {
+        _response.send(Pistache::Http::Code::Bad_Request, "The drug model is not a model of drug " + _drugID + ".");
+    } else if (result == DrugModelStore::Result::NotFound) {
+        _response.send(Pistache::Http::Code::Not_Found, "No drug model for drug " + _drugID + ".");
+    } else {
+        _response.send(Pistache::Http::Code::Ok, "Drug model replaced for drug " + _drugID + ".");
+    }
+}
 
-    _response.send(Pistache::Http::Code::Ok, text);
+void DrugsApiImpl::get_drug(const std::string& _drugID, const std::string& _ifNoneMatch, Pistache::Http::ResponseWriter& _response) {
+    std::shared_ptr<const DrugModelEntry> entry = DrugModelStore::getInstance()->getSnapshot()->getEntry(_drugID);
+    if (entry == nullptr) {
+        _response.send(Pistache::Http::Code::Not_Found, "No drug model for drug " + _drugID + ".");
+        return;
+    }
+
+    sendSummary(entry->m_summary, entry->m_etag, _ifNoneMatch, _response);
 }
 
-void DrugsApiImpl::get_drug(const std::string& _drugID, Pistache::Http::ResponseWriter& _response) {
-    std::string text = "Request received on the drugs endpoint with id: " + _drugID;
-    _response.send(Pistache::Http::Code::Ok, text);
+void DrugsApiImpl::list_drugs(const std::string& _ifNoneMatch, Pistache::Http::ResponseWriter& _response) {
+    std::shared_ptr<const DrugModelSnapshot> drugModels = DrugModelStore::getInstance()->getSnapshot();
+    sendSummary(drugModels->getSummary(), drugModels->getEtag(), _ifNoneMatch, _response);
 }
 
-void DrugsApiImpl::list_drugs(Pistache::Http::ResponseWriter& _response) {
-    std::string text = "Request received on the drugs endpoint.";
+void DrugsApiImpl::reload_drugs(Pistache::Http::ResponseWriter& _response) {
+    DrugModelStore* drugModelStore = DrugModelStore::getInstance();
+
+    std::vector<std::string> failedFiles;
+    if (!drugModelStore->reload(failedFiles)) {
+        std::string text = "Unable to read the drugs directory: " + drugModelStore->getDrugsDirectory();
+        _response.send(Pistache::Http::Code::Internal_Server_Error, text);
+        return;
+    }
+
+    std::shared_ptr<const DrugModelSnapshot> drugModels = drugModelStore->getSnapshot();
+    std::string text = std::to_string(drugModels->getNbDrugModels()) + " drug models loaded (version " +
+            std::to_string(drugModels->getVersion()) + ").";
+    for (const std::string& failedFile : failedFiles) {
+        text += "\nNot loaded: " + failedFile;
+    }
+
     _response.send(Pistache::Http::Code::Ok, text);
 }
 
+void DrugsApiImpl::sendSummary(const std::string& _summary, const std::string& _etag, const std::string& _ifNoneMatch, Pistache::Http::ResponseWriter& _response) {
+    _response.headers().addRaw(Pistache::Http::Header::Raw("ETag", _etag));
+
+    // The client already has this version, only the validator is sent back.
+    if (_ifNoneMatch == "*" || _ifNoneMatch.find(_etag) != std::string::npos) {
+        _response.send(Pistache::Http::Code::Not_Modified);
+        return;
+    }
+
+    _response.send(Pistache::Http::Code::Ok, _summary, MIME(Application, Xml));
+}
+
 } // namespace API
 } // namespace Server
 } // namespace Tucuxi
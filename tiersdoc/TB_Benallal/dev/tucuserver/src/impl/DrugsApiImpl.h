@@ -28,6 +28,7 @@
 #include "../api/DrugsApi.h"
 
 #include "../communication/query.h"
+#include "../drugmodelstore.h"
 #include <string>
 
 namespace Tucuxi {
@@ -39,11 +40,15 @@ public:
     DrugsApiImpl(std::shared_ptr<Pistache::Http::Endpoint> _pEndpoint, std::shared_ptr<Pistache::Rest::Router> _pRouter);
     ~DrugsApiImpl() { }
 
-    void add_drug(const Query& _query, Pistache::Http::ResponseWriter& _response);
+    void add_drug(const std::string& _drugModelXml, Pistache::Http::ResponseWriter& _response);
     void delete_drug(const std::string& _drugID, Pistache::Http::ResponseWriter& _response);
-    void edit_drug(const std::string& _drugID, const Query& _query, Pistache::Http::ResponseWriter& _response);
-    void get_drug(const std::string& _drugID, Pistache::Http::ResponseWriter& _response);
-    void list_drugs(Pistache::Http::ResponseWriter& _response);
+    void edit_drug(const std::string& _drugID, const std::string& _drugModelXml, Pistache::Http::ResponseWriter& _response);
+    void get_drug(const std::string& _drugID, const std::string& _ifNoneMatch, Pistache::Http::ResponseWriter& _response);
+    void list_drugs(const std::string& _ifNoneMatch, Pistache::Http::ResponseWriter& _response);
+    void reload_drugs(Pistache::Http::ResponseWriter& _response);
+
+private:
+    void sendSummary(const std::string& _summary, const std::string& _etag, const std::string& _ifNoneMatch, Pistache::Http::ResponseWriter& _response);
 
 };
 
@@ -0,0 +1,56 @@
+/**
+* Tucuxi TDM server
+* This is the Tucuxi TDM server.
+*
+* OpenAPI spec version: 1.0.0
+* Contact: nadir.benallal@heig-vd.ch
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/swagger-api/swagger-codegen.git
+* Do not edit the class manually.
+*/
+
+#include "JobsApiImpl.h"
+
+namespace Tucuxi {
+namespace Server {
+namespace API {
+
+using namespace std;
+
+JobsApiImpl::JobsApiImpl(std::shared_ptr<Pistache::Http::Endpoint> _pEndpoint, std::shared_ptr<Pistache::Rest::Router> _pRouter)
+    : JobsApi(_pEndpoint, _pRouter)
+    { }
+
+void JobsApiImpl::get_job(const std::string& _jobID, bool _isGzip, Pistache::Http::ResponseWriter& _response) {
+    shared_ptr<Job> job = JobStore::getInstance()->get(_jobID);
+    if (job == nullptr) {
+        _response.send(Pistache::Http::Code::Not_Found, "Unknown or expired job (" + _jobID + ")");
+        return;
+    }
+
+    shared_ptr<const string> result = job->getResult();
+    if (result == nullptr) {
+        sendJobStatus(*job, Pistache::Http::Code::Ok, _response);
+        return;
+    }
+
+    const Pistache::Http::Mime::MediaType mime = job->isJsonResponse() ? MIME(Application, Json) : MIME(Application, Xml);
+    Pistache::Http::ResponseStream stream = startChunkedResponse(_response, Pistache::Http::Code::Ok, mime, _isGzip);
+    ChunkedResponseBuffer buffer(stream, _isGzip);
+    buffer.sputn(result->data(), static_cast<std::streamsize>(result->size()));
+    buffer.finish();
+}
+
+void JobsApiImpl::cancel_job(const std::string& _jobID, Pistache::Http::ResponseWriter& _response) {
+    if (!JobStore::getInstance()->cancel(_jobID)) {
+        _response.send(Pistache::Http::Code::Not_Found, "Unknown or expired job (" + _jobID + ")");
+        return;
+    }
+
+    _response.send(Pistache::Http::Code::No_Content);
+}
+
+} // namespace API
+} // namespace Server
+} // namespace Tucuxi
@@ -0,0 +1,52 @@
+/**
+* Tucuxi TDM server
+* This is the Tucuxi TDM server.
+*
+* OpenAPI spec version: 1.0.0
+* Contact: nadir.benallal@heig-vd.ch
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/swagger-api/swagger-codegen.git
+* Do not edit the class manually.
+*/
+
+/*
+* JobsApiImpl.h
+*
+* 
+*/
+
+#ifndef TUCUXI_SERVER_JOBS_API_IMPL_H_
+#define TUCUXI_SERVER_JOBS_API_IMPL_H_
+
+
+#include <pistache/endpoint.h>
+#include <pistache/http.h>
+#include <pistache/router.h>
+#include <memory>
+
+#include "../api/JobsApi.h"
+
+#include "../jobstore.h"
+
+namespace Tucuxi {
+namespace Server {
+namespace API {
+
+class JobsApiImpl : public Tucuxi::Server::API::JobsApi {
+public:
+    JobsApiImpl(std::shared_ptr<Pistache::Http::Endpoint> _pEndpoint, std::shared_ptr<Pistache::Rest::Router> _pRouter);
+    ~JobsApiImpl() { }
+
+    void get_job(const std::string& _jobID, bool _isGzip, Pistache::Http::ResponseWriter& _response);
+    void cancel_job(const std::string& _jobID, Pistache::Http::ResponseWriter& _response);
+
+};
+
+} // namespace API
+} // namespace Server
+} // namespace Tucuxi
+
+
+
+#endif /* TUCUXI_SERVER_JOBS_API_IMPL_H_ */
@@ -0,0 +1,81 @@
+/**
+* Tucuxi TDM server
+* This is the Tucuxi TDM server.
+*
+* OpenAPI spec version: 1.0.0
+* Contact: nadir.benallal@heig-vd.ch
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/swagger-api/swagger-codegen.git
+* Do not edit the class manually.
+*/
+
+#include "MetricsApiImpl.h"
+
+#include <sstream>
+
+namespace Tucuxi {
+namespace Server {
+namespace API {
+
+using namespace std;
+
+MetricsApiImpl::MetricsApiImpl(std::shared_ptr<Pistache::Http::Endpoint> _pEndpoint, std::shared_ptr<Pistache::Rest::Router> _pRouter)
+    : MetricsApi(_pEndpoint, _pRouter)
+    { }
+
+void MetricsApiImpl::get_metrics(Pistache::Http::ResponseWriter& _response) {
+    ostringstream metrics;
+    Metrics::getInstance()->write(metrics);
+
+    // The gauges are read when scraping, nothing is counted on the hot path for them.
+    WorkerPool* workerPool = WorkerPool::getInstance();
+    metrics << "# HELP tucuserver_worker_threads Number of threads of the worker pool.\n";
+    metrics << "# TYPE tucuserver_worker_threads gauge\n";
+    metrics << "tucuserver_worker_threads " << workerPool->getNbWorkers() << "\n";
+    metrics << "# HELP tucuserver_worker_queue_depth Number of tasks waiting for a worker.\n";
+    metrics << "# TYPE tucuserver_worker_queue_depth gauge\n";
+    metrics << "tucuserver_worker_queue_depth " << workerPool->getQueueSize() << "\n";
+    metrics << "# HELP tucuserver_worker_queue_capacity Maximum number of tasks waiting for a worker.\n";
+    metrics << "# TYPE tucuserver_worker_queue_capacity gauge\n";
+    metrics << "tucuserver_worker_queue_capacity " << workerPool->getMaxQueueSize() << "\n";
+
+    shared_ptr<const DrugModelSnapshot> drugModels = DrugModelStore::getInstance()->getSnapshot();
+    metrics << "# HELP tucuserver_drug_models Number of drug models loaded.\n";
+    metrics << "# TYPE tucuserver_drug_models gauge\n";
+    metrics << "tucuserver_drug_models " << drugModels->getNbDrugModels() << "\n";
+    metrics << "# HELP tucuserver_drug_models_version Version of the published drug models.\n";
+    metrics << "# TYPE tucuserver_drug_models_version gauge\n";
+    metrics << "tucuserver_drug_models_version " << drugModels->getVersion() << "\n";
+
+    ResponseCache* responseCache = ResponseCache::getInstance();
+    metrics << "# HELP tucuserver_response_cache_entries Number of computation responses cached.\n";
+    metrics << "# TYPE tucuserver_response_cache_entries gauge\n";
+    metrics << "tucuserver_response_cache_entries " << responseCache->getNbEntries() << "\n";
+    metrics << "# HELP tucuserver_response_cache_bytes Memory used by the cached computation responses.\n";
+    metrics << "# TYPE tucuserver_response_cache_bytes gauge\n";
+    metrics << "tucuserver_response_cache_bytes " << responseCache->getMemory() << "\n";
+    metrics << "# HELP tucuserver_response_cache_hits_total Number of computation queries served from the cache.\n";
+    metrics << "# TYPE tucuserver_response_cache_hits_total counter\n";
+    metrics << "tucuserver_response_cache_hits_total " << responseCache->getNbHits() << "\n";
+    metrics << "# HELP tucuserver_response_cache_misses_total Number of computation queries not found in the cache.\n";
+    metrics << "# TYPE tucuserver_response_cache_misses_total counter\n";
+    metrics << "tucuserver_response_cache_misses_total " << responseCache->getNbMisses() << "\n";
+    metrics << "# HELP tucuserver_response_cache_evictions_total Number of cached responses evicted to respect the limits.\n";
+    metrics << "# TYPE tucuserver_response_cache_evictions_total counter\n";
+    metrics << "tucuserver_response_cache_evictions_total " << responseCache->getNbEvictions() << "\n";
+
+    JobStore* jobStore = JobStore::getInstance();
+    metrics << "# HELP tucuserver_jobs Number of asynchronous computation jobs kept, running or finished.\n";
+    metrics << "# TYPE tucuserver_jobs gauge\n";
+    metrics << "tucuserver_jobs " << jobStore->getNbJobs() << "\n";
+    metrics << "# HELP tucuserver_jobs_capacity Maximum number of asynchronous computation jobs kept.\n";
+    metrics << "# TYPE tucuserver_jobs_capacity gauge\n";
+    metrics << "tucuserver_jobs_capacity " << jobStore->getMaxJobs() << "\n";
+
+    _response.send(Pistache::Http::Code::Ok, metrics.str(), MIME(Text, Plain));
+}
+
+} // namespace API
+} // namespace Server
+} // namespace Tucuxi
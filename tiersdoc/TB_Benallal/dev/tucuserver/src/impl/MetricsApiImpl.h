@@ -0,0 +1,54 @@
+/**
+* Tucuxi TDM server
+* This is the Tucuxi TDM server.
+*
+* OpenAPI spec version: 1.0.0
+* Contact: nadir.benallal@heig-vd.ch
+*
+* NOTE: This class is auto generated by the swagger code generator program.
+* https://github.com/swagger-api/swagger-codegen.git
+* Do not edit the class manually.
+*/
+
+/*
+* MetricsApiImpl.h
+*
+* 
+*/
+
+#ifndef TUCUXI_SERVER_METRICS_API_IMPL_H_
+#define TUCUXI_SERVER_METRICS_API_IMPL_H_
+
+
+#include <pistache/endpoint.h>
+#include <pistache/http.h>
+#include <pistache/router.h>
+#include <memory>
+
+#include "../api/MetricsApi.h"
+
+#include "../drugmodelstore.h"
+#include "../jobstore.h"
+#include "../responsecache.h"
+#include "../workerpool.h"
+
+namespace Tucuxi {
+namespace Server {
+namespace API {
+
+class MetricsApiImpl : public Tucuxi::Server::API::MetricsApi {
+public:
+    MetricsApiImpl(std::shared_ptr<Pistache::Http::Endpoint> _pEndpoint, std::shared_ptr<Pistache::Rest::Router> _pRouter);
+    ~MetricsApiImpl() { }
+
+    void get_metrics(Pistache::Http::ResponseWriter& _response);
+
+};
+
+} // namespace API
+} // namespace Server
+} // namespace Tucuxi
+
+
+
+#endif /* TUCUXI_SERVER_METRICS_API_IMPL_H_ */
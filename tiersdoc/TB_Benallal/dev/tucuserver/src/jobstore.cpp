@@ -0,0 +1,236 @@
+#include "jobstore.h"
+
+#include <iomanip>
+#include <sstream>
+
+using namespace std;
+
+namespace Tucuxi {
+namespace Server {
+
+Job::Job(const string& _id, bool _isJsonResponse)
+    : m_id(_id), m_isJsonResponse(_isJsonResponse), m_isCancelled(false), m_status(Status::Queued)
+{}
+
+const string& Job::getId() const
+{
+    return m_id;
+}
+
+bool Job::isJsonResponse() const
+{
+    return m_isJsonResponse;
+}
+
+bool Job::start()
+{
+    lock_guard<mutex> lock(m_mutex);
+    if (m_status != Status::Queued) {
+        return false;
+    }
+
+    m_status = Status::Running;
+    return true;
+}
+
+void Job::finish(string _result)
+{
+    lock_guard<mutex> lock(m_mutex);
+    if (m_status != Status::Running) {
+        return;
+    }
+
+    m_status = Status::Done;
+    m_result = make_shared<const string>(move(_result));
+    m_finishTime = chrono::steady_clock::now();
+}
+
+void Job::fail(const string& _error)
+{
+    lock_guard<mutex> lock(m_mutex);
+    if (m_status != Status::Running) {
+        return;
+    }
+
+    m_status = Status::Failed;
+    m_error = _error;
+    m_finishTime = chrono::steady_clock::now();
+}
+
+void Job::cancel()
+{
+    m_isCancelled.store(true);
+
+    lock_guard<mutex> lock(m_mutex);
+    if (m_status == Status::Queued || m_status == Status::Running) {
+        m_status = Status::Cancelled;
+        m_finishTime = chrono::steady_clock::now();
+    }
+}
+
+bool Job::isCancelled() const
+{
+    return m_isCancelled.load();
+}
+
+Job::Status Job::getStatus() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_status;
+}
+
+shared_ptr<const string> Job::getResult() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_result;
+}
+
+string Job::getError() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_error;
+}
+
+bool Job::isExpired(chrono::steady_clock::time_point _now, chrono::seconds _timeToLive) const
+{
+    lock_guard<mutex> lock(m_mutex);
+    if (m_status == Status::Queued || m_status == Status::Running) {
+        return false;
+    }
+
+    return m_finishTime + _timeToLive <= _now;
+}
+
+string Job::toString(Status _status)
+{
+    switch (_status) {
+    case Status::Queued:
+        return "queued";
+    case Status::Running:
+        return "running";
+    case Status::Done:
+        return "done";
+    case Status::Failed:
+        return "failed";
+    case Status::Cancelled:
+        return "cancelled";
+    }
+
+    return "";
+}
+
+JobStore* JobStore::m_sJobStore = nullptr;
+
+JobStore* JobStore::getInstance()
+{
+    if (m_sJobStore == nullptr) {
+        Configuration* configuration = Configuration::getInstance();
+        m_sJobStore = new JobStore(configuration->getMaxJobs(), chrono::seconds(configuration->getJobsTimeToLive()));
+    }
+
+    return m_sJobStore;
+}
+
+JobStore::JobStore(size_t _maxJobs, chrono::seconds _timeToLive)
+    : m_maxJobs(_maxJobs), m_timeToLive(_timeToLive)
+{}
+
+shared_ptr<Job> JobStore::create(bool _isJsonResponse)
+{
+    lock_guard<mutex> lock(m_mutex);
+
+    if (m_jobs.size() >= m_maxJobs) {
+        purgeExpired(chrono::steady_clock::now());
+        if (m_jobs.size() >= m_maxJobs) {
+            return nullptr;
+        }
+    }
+
+    string id = generateId();
+    while (m_jobs.find(id) != m_jobs.end()) {
+        id = generateId();
+    }
+
+    shared_ptr<Job> job = make_shared<Job>(id, _isJsonResponse);
+    m_jobs[id] = job;
+
+    return job;
+}
+
+shared_ptr<Job> JobStore::get(const string& _id)
+{
+    lock_guard<mutex> lock(m_mutex);
+
+    unordered_map<string, shared_ptr<Job> >::iterator it = m_jobs.find(_id);
+    if (it == m_jobs.end()) {
+        return nullptr;
+    }
+
+    if (it->second->isExpired(chrono::steady_clock::now(), m_timeToLive)) {
+        m_jobs.erase(it);
+        return nullptr;
+    }
+
+    return it->second;
+}
+
+bool JobStore::cancel(const string& _id)
+{
+    shared_ptr<Job> job;
+    {
+        lock_guard<mutex> lock(m_mutex);
+
+        unordered_map<string, shared_ptr<Job> >::iterator it = m_jobs.find(_id);
+        if (it == m_jobs.end()) {
+            return false;
+        }
+
+        job = it->second;
+        m_jobs.erase(it);
+
+        if (job->isExpired(chrono::steady_clock::now(), m_timeToLive)) {
+            return false;
+        }
+    }
+
+    // The worker still holds the job, it sees the cancellation and drops the result.
+    job->cancel();
+
+    return true;
+}
+
+size_t JobStore::getNbJobs() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_jobs.size();
+}
+
+size_t JobStore::getMaxJobs() const
+{
+    return m_maxJobs;
+}
+
+void JobStore::purgeExpired(chrono::steady_clock::time_point _now)
+{
+    for (unordered_map<string, shared_ptr<Job> >::iterator it = m_jobs.begin(); it != m_jobs.end();) {
+        if (it->second->isExpired(_now, m_timeToLive)) {
+            it = m_jobs.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+string JobStore::generateId()
+{
+    // 128 bits read from the operating system generator, 32 bits at a time.
+    ostringstream id;
+    id << hex << setfill('0');
+    for (int i = 0; i < 4; ++i) {
+        id << setw(8) << static_cast<uint32_t>(m_randomDevice());
+    }
+    return id.str();
+}
+
+} // namespace Server
+} // namespace Tucuxi
@@ -0,0 +1,119 @@
+#ifndef TUCUXI_SERVER_JOBSTORE_H
+#define TUCUXI_SERVER_JOBSTORE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+#include "configuration.h"
+
+namespace Tucuxi {
+namespace Server {
+
+// Asynchronous computation of a query. The job is run by a worker of the pool
+// while the client polls its status, then retrieves its serialized response.
+class Job
+{
+public:
+    enum class Status {
+        Queued,
+        Running,
+        Done,
+        Failed,
+        Cancelled
+    };
+
+    Job(const std::string& _id, bool _isJsonResponse);
+    Job(Job& other) = delete;
+
+    const std::string& getId() const;
+    bool isJsonResponse() const;
+
+    // Returns false if the job has been cancelled before a worker took it.
+    bool start();
+
+    // The result of a job cancelled meanwhile is discarded.
+    void finish(std::string _result);
+    void fail(const std::string& _error);
+
+    // A running job cannot be interrupted, it stops at the next check of isCancelled().
+    void cancel();
+    bool isCancelled() const;
+
+    Status getStatus() const;
+
+    // Returns nullptr unless the job is done.
+    std::shared_ptr<const std::string> getResult() const;
+    std::string getError() const;
+
+    // Returns true if the job finished more than _timeToLive ago.
+    bool isExpired(std::chrono::steady_clock::time_point _now, std::chrono::seconds _timeToLive) const;
+
+    static std::string toString(Status _status);
+
+protected:
+    const std::string m_id;
+    const bool m_isJsonResponse;
+
+    std::atomic<bool> m_isCancelled;
+
+    mutable std::mutex m_mutex;
+    Status m_status;
+    std::shared_ptr<const std::string> m_result;
+    std::string m_error;
+    std::chrono::steady_clock::time_point m_finishTime;
+};
+
+// Bounded store of the asynchronous jobs. A finished job is kept until its result
+// expires, the expired jobs are purged when room is needed for a new one. Once the
+// store is full of pending or unexpired jobs, no job is created until one is removed.
+class JobStore
+{
+public:
+    // Not synchronized: the instance is created by main() before the reactor threads start.
+    static JobStore* getInstance();
+
+    JobStore(size_t _maxJobs, std::chrono::seconds _timeToLive);
+    JobStore(JobStore& other) = delete;
+
+    // Returns nullptr if the store is full.
+    std::shared_ptr<Job> create(bool _isJsonResponse);
+
+    // Returns nullptr if the job does not exist or has expired.
+    std::shared_ptr<Job> get(const std::string& _id);
+
+    // Cancels the job and removes it from the store.
+    // Returns false if the job does not exist or has expired.
+    bool cancel(const std::string& _id);
+
+    size_t getNbJobs() const;
+    size_t getMaxJobs() const;
+
+protected:
+    // The caller holds m_mutex.
+    void purgeExpired(std::chrono::steady_clock::time_point _now);
+    std::string generateId();
+
+protected:
+    static JobStore* m_sJobStore;
+
+    const size_t m_maxJobs;
+    const std::chrono::seconds m_timeToLive;
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<std::string, std::shared_ptr<Job> > m_jobs;
+
+    // The identifiers are drawn from the operating system generator (not a seeded PRNG whose state
+    // can be rebuilt from observed outputs), they cannot be guessed from the ones of other clients.
+    std::random_device m_randomDevice;
+};
+
+} // namespace Server
+} // namespace Tucuxi
+
+#endif // TUCUXI_SERVER_JOBSTORE_H
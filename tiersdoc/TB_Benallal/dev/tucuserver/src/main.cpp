@@ -8,15 +8,30 @@
 #include "impl/HelloApiImpl.h"
 #include "impl/ComputationApiImpl.h"
 #include "impl/DrugsApiImpl.h"
+#include "impl/MetricsApiImpl.h"
+#include "impl/JobsApiImpl.h"
 
 #include "configuration.h"
+#include "workerpool.h"
+#include "drugmodelstore.h"
+#include "responsecache.h"
+#include "jobstore.h"
 
 using namespace std;
 using namespace Pistache;
 
-void init(Http::Endpoint& _pEndpoint, size_t _thr = 2) {
+void init(Http::Endpoint& _pEndpoint, const Tucuxi::Server::Configuration& _configuration) {
+    // Reusing the address lets the server restart at once after a load test left connections in TIME_WAIT.
+    Flags<Tcp::Options> flags = Tcp::Options::ReuseAddr;
+    if (_configuration.getNoDelay()) {
+        flags.setFlag(Tcp::Options::NoDelay);
+    }
+
     auto opts = Pistache::Http::Endpoint::options()
-        .threads(_thr);
+        .threads(static_cast<int>(_configuration.getReactorThreads()))
+        .backlog(static_cast<int>(_configuration.getBacklog()))
+        .maxPayload(_configuration.getMaxPayload())
+        .flags(flags);
     _pEndpoint.init(opts);
 }
 
@@ -31,12 +46,23 @@ void shutdown(Http::Endpoint& _pEndpoint) {
 
 int main()
 {
-    uint16_t port = Tucuxi::Server::Configuration::getInstance()->getPort();
+    Tucuxi::Server::Configuration* pConfiguration = Tucuxi::Server::Configuration::getInstance();
+    uint16_t port = pConfiguration->getPort();
     Address addr(Ipv4::any(), Port(port));
 
     shared_ptr<Rest::Router> pRouter = make_shared<Rest::Router>();
     shared_ptr<Http::Endpoint> pEndpoint = make_shared<Http::Endpoint>(addr);
-    init(*pEndpoint, 2);
+    init(*pEndpoint, *pConfiguration);
+
+    // Starting the compute threads before accepting any connection.
+    Tucuxi::Server::WorkerPool* pWorkerPool = Tucuxi::Server::WorkerPool::getInstance();
+
+    // Loading the drug models once, the requests only look them up.
+    Tucuxi::Server::DrugModelStore::getInstance();
+
+    // The lazy singletons are not synchronized, the ones used by the workers are created before any request.
+    Tucuxi::Server::ResponseCache::getInstance();
+    Tucuxi::Server::JobStore::getInstance();
 
     Tucuxi::Server::API::HelloApiImpl helloServer(pEndpoint, pRouter);
     helloServer.setupRoutes();
@@ -44,10 +70,15 @@ int main()
     drugsServer.setupRoutes();
     Tucuxi::Server::API::ComputationApiImpl computationServer(pEndpoint, pRouter);
     computationServer.setupRoutes();
+    Tucuxi::Server::API::JobsApiImpl jobsServer(pEndpoint, pRouter);
+    jobsServer.setupRoutes();
+    Tucuxi::Server::API::MetricsApiImpl metricsServer(pEndpoint, pRouter);
+    metricsServer.setupRoutes();
 
     start(*pEndpoint, *pRouter);
 
     shutdown(*pEndpoint);
+    pWorkerPool->shutdown();
 
     return 0;
 }
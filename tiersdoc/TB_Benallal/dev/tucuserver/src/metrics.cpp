@@ -0,0 +1,195 @@
+#include "metrics.h"
+
+using namespace std;
+
+namespace Tucuxi {
+namespace Server {
+
+const array<double, 12> LatencyHistogram::m_sBounds = {{0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1.0, 2.5, 5.0}};
+
+LatencyHistogram::LatencyHistogram()
+    : m_sumNanoseconds(0), m_count(0)
+{
+    for (atomic<uint64_t>& bucket : m_buckets) {
+        bucket.store(0, memory_order_relaxed);
+    }
+}
+
+void LatencyHistogram::observe(chrono::steady_clock::duration _duration)
+{
+    double seconds = chrono::duration<double>(_duration).count();
+
+    size_t bucket = 0;
+    while (bucket < m_sBounds.size() && seconds > m_sBounds[bucket]) {
+        bucket++;
+    }
+
+    // The counters are independent, a scrape may see them slightly out of step.
+    m_buckets[bucket].fetch_add(1, memory_order_relaxed);
+    m_sumNanoseconds.fetch_add(chrono::duration_cast<chrono::nanoseconds>(_duration).count(), memory_order_relaxed);
+    m_count.fetch_add(1, memory_order_relaxed);
+}
+
+void LatencyHistogram::write(ostream& _output, const string& _name, const string& _labels) const
+{
+    string separator = _labels.empty() ? "" : ",";
+
+    uint64_t cumulativeCount = 0;
+    for (size_t bucket = 0; bucket < m_buckets.size(); bucket++) {
+        cumulativeCount += m_buckets[bucket].load(memory_order_relaxed);
+        _output << _name << "_bucket{" << _labels << separator << "le=\"";
+        if (bucket < m_sBounds.size()) {
+            _output << m_sBounds[bucket];
+        } else {
+            _output << "+Inf";
+        }
+        _output << "\"} " << cumulativeCount << "\n";
+    }
+
+    string labels = _labels.empty() ? "" : "{" + _labels + "}";
+    _output << _name << "_sum" << labels << " " << m_sumNanoseconds.load(memory_order_relaxed) / 1e9 << "\n";
+    _output << _name << "_count" << labels << " " << m_count.load(memory_order_relaxed) << "\n";
+}
+
+uint64_t LatencyHistogram::getCount() const
+{
+    return m_count.load(memory_order_relaxed);
+}
+
+RouteMetrics::RouteMetrics(const string& _method, const string& _route)
+    : m_method(_method), m_route(_route), m_nbRequests(0), m_nbInFlight(0)
+{}
+
+void RouteMetrics::start()
+{
+    m_nbRequests.fetch_add(1, memory_order_relaxed);
+    m_nbInFlight.fetch_add(1, memory_order_relaxed);
+}
+
+void RouteMetrics::finish(chrono::steady_clock::duration _duration)
+{
+    m_nbInFlight.fetch_sub(1, memory_order_relaxed);
+    m_latency.observe(_duration);
+}
+
+const string& RouteMetrics::getMethod() const
+{
+    return m_method;
+}
+
+const string& RouteMetrics::getRoute() const
+{
+    return m_route;
+}
+
+uint64_t RouteMetrics::getNbRequests() const
+{
+    return m_nbRequests.load(memory_order_relaxed);
+}
+
+int64_t RouteMetrics::getNbInFlight() const
+{
+    return m_nbInFlight.load(memory_order_relaxed);
+}
+
+const LatencyHistogram& RouteMetrics::getLatency() const
+{
+    return m_latency;
+}
+
+void RouteMetrics::observePhase(Phase _phase, chrono::steady_clock::duration _duration)
+{
+    m_phaseLatencies[static_cast<size_t>(_phase)].observe(_duration);
+}
+
+const LatencyHistogram& RouteMetrics::getPhaseLatency(Phase _phase) const
+{
+    return m_phaseLatencies[static_cast<size_t>(_phase)];
+}
+
+RequestScope::RequestScope(RouteMetrics& _routeMetrics)
+    : m_routeMetrics(_routeMetrics), m_start(chrono::steady_clock::now())
+{
+    m_routeMetrics.start();
+}
+
+RequestScope::~RequestScope()
+{
+    m_routeMetrics.finish(chrono::steady_clock::now() - m_start);
+}
+
+RouteMetrics& RequestScope::getRouteMetrics() const
+{
+    return m_routeMetrics;
+}
+
+Metrics* Metrics::m_sMetrics = nullptr;
+
+Metrics* Metrics::getInstance()
+{
+    if (m_sMetrics == nullptr) {
+        m_sMetrics = new Metrics();
+    }
+
+    return m_sMetrics;
+}
+
+Metrics::Metrics()
+{}
+
+RouteMetrics& Metrics::registerRoute(const string& _method, const string& _route)
+{
+    unique_ptr<RouteMetrics>& routeMetrics = m_routes[_method + " " + _route];
+    if (routeMetrics == nullptr) {
+        routeMetrics = make_unique<RouteMetrics>(_method, _route);
+    }
+
+    return *routeMetrics;
+}
+
+RouteMetrics& Metrics::getRoute(const string& _method, const string& _route)
+{
+    return *m_routes.at(_method + " " + _route);
+}
+
+void Metrics::write(ostream& _output) const
+{
+    _output << "# HELP tucuserver_http_requests_total Number of HTTP requests received by route.\n";
+    _output << "# TYPE tucuserver_http_requests_total counter\n";
+    for (const auto& route : m_routes) {
+        _output << "tucuserver_http_requests_total{method=\"" << route.second->getMethod()
+                << "\",route=\"" << route.second->getRoute() << "\"} " << route.second->getNbRequests() << "\n";
+    }
+
+    _output << "# HELP tucuserver_http_requests_in_flight Number of HTTP requests being processed by route.\n";
+    _output << "# TYPE tucuserver_http_requests_in_flight gauge\n";
+    for (const auto& route : m_routes) {
+        _output << "tucuserver_http_requests_in_flight{method=\"" << route.second->getMethod()
+                << "\",route=\"" << route.second->getRoute() << "\"} " << route.second->getNbInFlight() << "\n";
+    }
+
+    _output << "# HELP tucuserver_http_request_duration_seconds Time from the reception of a request to its response.\n";
+    _output << "# TYPE tucuserver_http_request_duration_seconds histogram\n";
+    for (const auto& route : m_routes) {
+        string labels = "method=\"" + route.second->getMethod() + "\",route=\"" + route.second->getRoute() + "\"";
+        route.second->getLatency().write(_output, "tucuserver_http_request_duration_seconds", labels);
+    }
+
+    _output << "# HELP tucuserver_computation_phase_seconds Time spent in each phase of a computation query.\n";
+    _output << "# TYPE tucuserver_computation_phase_seconds histogram\n";
+    const array<pair<Phase, string>, 3> phases = {{{Phase::Parse, "parse"}, {Phase::Compute, "compute"}, {Phase::Serialize, "serialize"}}};
+    for (const auto& route : m_routes) {
+        // Only the routes that compute queries have phases.
+        for (const pair<Phase, string>& phase : phases) {
+            const LatencyHistogram& latency = route.second->getPhaseLatency(phase.first);
+            if (latency.getCount() > 0) {
+                string labels = "method=\"" + route.second->getMethod() + "\",route=\"" + route.second->getRoute()
+                        + "\",phase=\"" + phase.second + "\"";
+                latency.write(_output, "tucuserver_computation_phase_seconds", labels);
+            }
+        }
+    }
+}
+
+} // namespace Server
+} // namespace Tucuxi
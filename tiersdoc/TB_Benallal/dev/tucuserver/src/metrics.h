@@ -0,0 +1,119 @@
+#ifndef TUCUXI_SERVER_METRICS_H
+#define TUCUXI_SERVER_METRICS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+
+namespace Tucuxi {
+namespace Server {
+
+// Latency histogram with fixed buckets. Observing a value only increments atomic
+// counters, the cumulative counts expected by Prometheus are computed when exporting.
+class LatencyHistogram
+{
+public:
+    LatencyHistogram();
+
+    void observe(std::chrono::steady_clock::duration _duration);
+
+    // Writes the _bucket, _sum and _count series of the histogram.
+    // _labels is either empty or a list of labels, such as: route="/computation"
+    void write(std::ostream& _output, const std::string& _name, const std::string& _labels) const;
+
+    uint64_t getCount() const;
+
+protected:
+    // Upper bounds of the buckets in seconds, the last bucket (+Inf) is implicit.
+    static const std::array<double, 12> m_sBounds;
+
+    std::array<std::atomic<uint64_t>, 13> m_buckets;
+    std::atomic<uint64_t> m_sumNanoseconds;
+    std::atomic<uint64_t> m_count;
+};
+
+// Phases of a computation query, measured by route.
+enum class Phase {
+    Parse,
+    Compute,
+    Serialize
+};
+
+class RouteMetrics
+{
+public:
+    RouteMetrics(const std::string& _method, const std::string& _route);
+
+    void start();
+    void finish(std::chrono::steady_clock::duration _duration);
+
+    const std::string& getMethod() const;
+    const std::string& getRoute() const;
+    uint64_t getNbRequests() const;
+    int64_t getNbInFlight() const;
+    const LatencyHistogram& getLatency() const;
+
+    void observePhase(Phase _phase, std::chrono::steady_clock::duration _duration);
+    const LatencyHistogram& getPhaseLatency(Phase _phase) const;
+
+protected:
+    const std::string m_method;
+    const std::string m_route;
+
+    std::atomic<uint64_t> m_nbRequests;
+    std::atomic<int64_t> m_nbInFlight;
+    LatencyHistogram m_latency;
+
+    // Indexed by Phase.
+    std::array<LatencyHistogram, 3> m_phaseLatencies;
+};
+
+// Measures a request from its construction to its destruction. The scope of an
+// offloaded request is shared with the worker task, so that it ends with the task.
+class RequestScope
+{
+public:
+    RequestScope(RouteMetrics& _routeMetrics);
+    RequestScope(RequestScope& other) = delete;
+    ~RequestScope();
+
+    RouteMetrics& getRouteMetrics() const;
+
+protected:
+    RouteMetrics& m_routeMetrics;
+    const std::chrono::steady_clock::time_point m_start;
+};
+
+// Counters of the server, exported in the Prometheus text format by the /metrics route.
+// The routes are registered while the routes of the router are set up, before serving:
+// afterwards the registry is only read and every counter update is a lock-free atomic operation.
+class Metrics
+{
+public:
+    static Metrics* getInstance();
+
+    Metrics();
+    Metrics(Metrics& other) = delete;
+
+    RouteMetrics& registerRoute(const std::string& _method, const std::string& _route);
+
+    // Throws std::out_of_range if the route has not been registered.
+    RouteMetrics& getRoute(const std::string& _method, const std::string& _route);
+
+    void write(std::ostream& _output) const;
+
+protected:
+    static Metrics* m_sMetrics;
+
+    std::map<std::string, std::unique_ptr<RouteMetrics> > m_routes;
+};
+
+} // namespace Server
+} // namespace Tucuxi
+
+#endif // TUCUXI_SERVER_METRICS_H
@@ -3,17 +3,16 @@
 namespace Tucuxi {
 namespace Server {
 
-PredictionComputer::PredictionComputer(const Query& _query)
-    : Computer(_query)
+PredictionComputer::PredictionComputer(const Query& _query, size_t _requestPosition, std::shared_ptr<const DrugModelSnapshot> _drugModels)
+    : Computer(_query, _requestPosition, std::move(_drugModels))
 {}
 
 void PredictionComputer::compute()
 {
-    std::string requestType = m_query.getRequests()
-                                    .at(0)
-                                    ->getRequestType();
+    std::string requestType = getRequest().getRequestType();
 
     std::string errorContent = "Request type is: " + requestType + ". (PredictionComputer)";
+    m_result = std::make_unique<ApiResponseAdjustment>(m_query.getQueryID(), getRequest().getRequestID());
     m_result->addError("DefaultError", m_query.getLanguage(), errorContent);
 }
 
@@ -9,7 +9,7 @@ namespace Server {
 class PredictionComputer : public Computer
 {
 public:
-    PredictionComputer(const Query& _query);
+    PredictionComputer(const Query& _query, size_t _requestPosition, std::shared_ptr<const DrugModelSnapshot> _drugModels);
 
     void compute();
 };
@@ -0,0 +1,155 @@
+#include "responsecache.h"
+
+using namespace std;
+
+namespace Tucuxi {
+namespace Server {
+
+ResponseCache* ResponseCache::m_sResponseCache = nullptr;
+
+ResponseCache* ResponseCache::getInstance()
+{
+    if (m_sResponseCache == nullptr) {
+        Configuration* configuration = Configuration::getInstance();
+        m_sResponseCache = new ResponseCache(configuration->getCacheMaxEntries(),
+                                             configuration->getCacheMaxMemory(),
+                                             chrono::seconds(configuration->getCacheTimeToLive()));
+    }
+
+    return m_sResponseCache;
+}
+
+ResponseCache::ResponseCache(size_t _maxEntries, size_t _maxMemory, chrono::seconds _timeToLive)
+    : m_maxEntries(_maxEntries), m_maxMemory(_maxMemory), m_timeToLive(_timeToLive), m_memory(0),
+      m_nbHits(0), m_nbMisses(0), m_nbEvictions(0), m_nbExpirations(0)
+{}
+
+string ResponseCache::canonicalizeXmlQuery(Common::XmlDocument& _xmlQuery)
+{
+    string canonicalQuery;
+    if (!_xmlQuery.toString(canonicalQuery, false)) {
+        return "";
+    }
+
+    return canonicalQuery;
+}
+
+string ResponseCache::makeKey(const string& _canonicalQuery, unsigned int _drugModelsVersion,
+                              const string& _responseFormat)
+{
+    // A new set of drug models gives new keys, the responses computed with the old ones are never served again.
+    return to_string(_drugModelsVersion) + ":" + _responseFormat + ":" + _canonicalQuery;
+}
+
+bool ResponseCache::isEnabled() const
+{
+    return m_maxEntries > 0 && m_maxMemory > 0;
+}
+
+shared_ptr<const string> ResponseCache::get(const string& _key)
+{
+    lock_guard<mutex> lock(m_mutex);
+
+    unordered_map<string, Entries::iterator>::iterator it = m_index.find(_key);
+    if (it == m_index.end()) {
+        ++m_nbMisses;
+        return nullptr;
+    }
+
+    if (it->second->m_expiration <= chrono::steady_clock::now()) {
+        erase(it->second);
+        ++m_nbExpirations;
+        ++m_nbMisses;
+        return nullptr;
+    }
+
+    // Moving the entry in front of the list makes it the most recently used one.
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    ++m_nbHits;
+
+    return m_entries.front().m_response;
+}
+
+void ResponseCache::put(const string& _key, const string& _response)
+{
+    Entry entry{_key, make_shared<const string>(_response), chrono::steady_clock::now() + m_timeToLive};
+    size_t size = getSize(entry);
+    if (!isEnabled() || size > m_maxMemory) {
+        return;
+    }
+
+    lock_guard<mutex> lock(m_mutex);
+
+    // Another worker may have computed the same query meanwhile.
+    unordered_map<string, Entries::iterator>::iterator it = m_index.find(_key);
+    if (it != m_index.end()) {
+        erase(it->second);
+    }
+
+    while (!m_entries.empty() && (m_entries.size() >= m_maxEntries || m_memory + size > m_maxMemory)) {
+        erase(prev(m_entries.end()));
+        ++m_nbEvictions;
+    }
+
+    m_entries.push_front(move(entry));
+    m_index[_key] = m_entries.begin();
+    m_memory += size;
+}
+
+size_t ResponseCache::getNbEntries() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+size_t ResponseCache::getMemory() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_memory;
+}
+
+size_t ResponseCache::getMaxEntries() const
+{
+    return m_maxEntries;
+}
+
+size_t ResponseCache::getMaxMemory() const
+{
+    return m_maxMemory;
+}
+
+uint64_t ResponseCache::getNbHits() const
+{
+    return m_nbHits.load();
+}
+
+uint64_t ResponseCache::getNbMisses() const
+{
+    return m_nbMisses.load();
+}
+
+uint64_t ResponseCache::getNbEvictions() const
+{
+    return m_nbEvictions.load();
+}
+
+uint64_t ResponseCache::getNbExpirations() const
+{
+    return m_nbExpirations.load();
+}
+
+size_t ResponseCache::getSize(const Entry& _entry)
+{
+    // The key is stored twice, in the entry and in the index.
+    return 2 * _entry.m_key.size() + _entry.m_response->size();
+}
+
+void ResponseCache::erase(Entries::iterator _entry)
+{
+    m_memory -= getSize(*_entry);
+    m_index.erase(_entry->m_key);
+    m_entries.erase(_entry);
+}
+
+} // namespace Server
+} // namespace Tucuxi
@@ -0,0 +1,96 @@
+#ifndef TUCUXI_SERVER_RESPONSECACHE_H
+#define TUCUXI_SERVER_RESPONSECACHE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "tucucommon/xmldocument.h"
+
+#include "configuration.h"
+
+namespace Tucuxi {
+namespace Server {
+
+// Bounded LRU cache of the serialized responses of the computation endpoint.
+// The entries are looked up by the canonical form of the query plus the version of
+// the drug models, they expire after a time to live and the least recently used ones
+// are evicted when the number of entries or the memory limit is exceeded.
+class ResponseCache
+{
+public:
+    // Not synchronized: the instance is created by main() before the workers start.
+    static ResponseCache* getInstance();
+
+    ResponseCache(size_t _maxEntries, size_t _maxMemory, std::chrono::seconds _timeToLive);
+    ResponseCache(ResponseCache& other) = delete;
+
+    // Canonical form of an XML query: the parsed document is written back without
+    // formatting, so that two queries differing only by indentation share their entry.
+    // Returns an empty string if the document cannot be written.
+    static std::string canonicalizeXmlQuery(Common::XmlDocument& _xmlQuery);
+
+    // The same query gets a distinct entry for each format of response.
+    static std::string makeKey(const std::string& _canonicalQuery, unsigned int _drugModelsVersion,
+                               const std::string& _responseFormat);
+
+    // False if the limits leave no room for any entry. Nothing is then looked up nor stored.
+    bool isEnabled() const;
+
+    // Returns nullptr if there is no valid entry for the key.
+    std::shared_ptr<const std::string> get(const std::string& _key);
+    void put(const std::string& _key, const std::string& _response);
+
+    size_t getNbEntries() const;
+    size_t getMemory() const;
+    size_t getMaxEntries() const;
+    size_t getMaxMemory() const;
+    uint64_t getNbHits() const;
+    uint64_t getNbMisses() const;
+    uint64_t getNbEvictions() const;
+    uint64_t getNbExpirations() const;
+
+protected:
+    struct Entry
+    {
+        std::string m_key;
+        std::shared_ptr<const std::string> m_response;
+        std::chrono::steady_clock::time_point m_expiration;
+    };
+
+    typedef std::list<Entry> Entries;
+
+    static size_t getSize(const Entry& _entry);
+
+    // The caller holds m_mutex.
+    void erase(Entries::iterator _entry);
+
+protected:
+    static ResponseCache* m_sResponseCache;
+
+    const size_t m_maxEntries;
+    const size_t m_maxMemory;
+    const std::chrono::seconds m_timeToLive;
+
+    mutable std::mutex m_mutex;
+
+    // Most recently used first.
+    Entries m_entries;
+    std::unordered_map<std::string, Entries::iterator> m_index;
+    size_t m_memory;
+
+    std::atomic<uint64_t> m_nbHits;
+    std::atomic<uint64_t> m_nbMisses;
+    std::atomic<uint64_t> m_nbEvictions;
+    std::atomic<uint64_t> m_nbExpirations;
+};
+
+} // namespace Server
+} // namespace Tucuxi
+
+#endif // TUCUXI_SERVER_RESPONSECACHE_H
@@ -0,0 +1,110 @@
+#include "sha256.h"
+
+#include <cstdint>
+#include <iomanip>
+#include <sstream>
+
+using namespace std;
+
+namespace Tucuxi {
+namespace Server {
+
+namespace {
+
+const uint32_t ROUND_CONSTANTS[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+uint32_t rotateRight(uint32_t _value, unsigned int _bits)
+{
+    return (_value >> _bits) | (_value << (32 - _bits));
+}
+
+// Processes one 64 bytes block.
+void compress(uint32_t _state[8], const unsigned char* _block)
+{
+    uint32_t w[64];
+    for (int i = 0; i < 16; i++) {
+        w[i] = (uint32_t(_block[4 * i]) << 24) | (uint32_t(_block[4 * i + 1]) << 16) |
+               (uint32_t(_block[4 * i + 2]) << 8) | uint32_t(_block[4 * i + 3]);
+    }
+    for (int i = 16; i < 64; i++) {
+        uint32_t s0 = rotateRight(w[i - 15], 7) ^ rotateRight(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t s1 = rotateRight(w[i - 2], 17) ^ rotateRight(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    uint32_t a = _state[0], b = _state[1], c = _state[2], d = _state[3];
+    uint32_t e = _state[4], f = _state[5], g = _state[6], h = _state[7];
+
+    for (int i = 0; i < 64; i++) {
+        uint32_t s1 = rotateRight(e, 6) ^ rotateRight(e, 11) ^ rotateRight(e, 25);
+        uint32_t choice = (e & f) ^ (~e & g);
+        uint32_t temp1 = h + s1 + choice + ROUND_CONSTANTS[i] + w[i];
+        uint32_t s0 = rotateRight(a, 2) ^ rotateRight(a, 13) ^ rotateRight(a, 22);
+        uint32_t majority = (a & b) ^ (a & c) ^ (b & c);
+        uint32_t temp2 = s0 + majority;
+
+        h = g;
+        g = f;
+        f = e;
+        e = d + temp1;
+        d = c;
+        c = b;
+        b = a;
+        a = temp1 + temp2;
+    }
+
+    _state[0] += a; _state[1] += b; _state[2] += c; _state[3] += d;
+    _state[4] += e; _state[5] += f; _state[6] += g; _state[7] += h;
+}
+
+} // namespace
+
+string sha256Hex(const string& _content)
+{
+    uint32_t state[8] = {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+    };
+
+    const unsigned char* data = reinterpret_cast<const unsigned char*>(_content.data());
+    size_t size = _content.size();
+
+    size_t offset = 0;
+    for (; offset + 64 <= size; offset += 64) {
+        compress(state, data + offset);
+    }
+
+    // Padding: a 1 bit, zeros, then the length in bits on 64 bits big endian.
+    unsigned char tail[128] = {};
+    size_t tailSize = size - offset;
+    for (size_t i = 0; i < tailSize; i++) {
+        tail[i] = data[offset + i];
+    }
+    tail[tailSize] = 0x80;
+    size_t paddedSize = tailSize + 9 <= 64 ? 64 : 128;
+    uint64_t bitLength = uint64_t(size) * 8;
+    for (int i = 0; i < 8; i++) {
+        tail[paddedSize - 1 - i] = static_cast<unsigned char>(bitLength >> (8 * i));
+    }
+    for (size_t i = 0; i < paddedSize; i += 64) {
+        compress(state, tail + i);
+    }
+
+    ostringstream digest;
+    digest << hex << setfill('0');
+    for (uint32_t word : state) {
+        digest << setw(8) << word;
+    }
+    return digest.str();
+}
+
+} // namespace Server
+} // namespace Tucuxi
@@ -0,0 +1,17 @@
+#ifndef TUCUXI_SERVER_SHA256_H
+#define TUCUXI_SERVER_SHA256_H
+
+#include <string>
+
+namespace Tucuxi {
+namespace Server {
+
+// SHA-256 digest (FIPS 180-4) of the content, as 64 lowercase hexadecimal digits.
+// Unlike std::hash, the value does not depend on the build or the standard library,
+// so it can be used as a validator shared with the clients.
+std::string sha256Hex(const std::string& _content);
+
+} // namespace Server
+} // namespace Tucuxi
+
+#endif // TUCUXI_SERVER_SHA256_H
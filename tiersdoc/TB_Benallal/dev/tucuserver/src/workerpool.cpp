@@ -0,0 +1,192 @@
+#include "workerpool.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace Tucuxi {
+namespace Server {
+
+namespace {
+
+// Tasks of a runAll call. It is shared with the queued copies, which may be
+// dequeued after the call returned: they only find their task already claimed.
+class TaskBatch
+{
+public:
+    TaskBatch(const vector<WorkerPool::Task>& _tasks)
+        : m_tasks(_tasks), m_claimed(new atomic<bool>[_tasks.size()]()), m_nbRemaining(_tasks.size())
+    {}
+
+    void run(size_t _index)
+    {
+        if (m_claimed[_index].exchange(true)) {
+            return;
+        }
+
+        try {
+            m_tasks[_index]();
+        } catch (...) {
+        }
+
+        lock_guard<mutex> lock(m_mutex);
+        if (--m_nbRemaining == 0) {
+            m_done.notify_all();
+        }
+    }
+
+    void wait()
+    {
+        unique_lock<mutex> lock(m_mutex);
+        m_done.wait(lock, [this] { return m_nbRemaining == 0; });
+    }
+
+private:
+    const vector<WorkerPool::Task> m_tasks;
+    unique_ptr<atomic<bool>[]> m_claimed;
+    mutex m_mutex;
+    condition_variable m_done;
+    size_t m_nbRemaining;
+};
+
+} // namespace
+
+WorkerPool* WorkerPool::m_sWorkerPool = nullptr;
+
+WorkerPool* WorkerPool::getInstance()
+{
+    if (m_sWorkerPool == nullptr) {
+        Configuration* configuration = Configuration::getInstance();
+        m_sWorkerPool = new WorkerPool(configuration->getWorkerPoolSize(), configuration->getMaxQueueSize());
+    }
+
+    return m_sWorkerPool;
+}
+
+WorkerPool::WorkerPool(size_t _nbWorkers, size_t _maxQueueSize)
+    : m_maxQueueSize(_maxQueueSize), m_stopped(false)
+{
+    if (_nbWorkers == 0) {
+        _nbWorkers = 1;
+    }
+
+    m_workers.reserve(_nbWorkers);
+    for (size_t i = 0; i < _nbWorkers; i++) {
+        m_workers.emplace_back(&WorkerPool::work, this);
+    }
+}
+
+WorkerPool::~WorkerPool()
+{
+    shutdown();
+}
+
+bool WorkerPool::trySubmit(Task _task)
+{
+    return push(move(_task), nullptr);
+}
+
+bool WorkerPool::push(Task _task, const void* _batch)
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        if (m_stopped || m_tasks.size() >= m_maxQueueSize) {
+            return false;
+        }
+        m_tasks.push_back(QueuedTask{move(_task), _batch});
+    }
+
+    m_taskAvailable.notify_one();
+    return true;
+}
+
+void WorkerPool::removeBatch(const void* _batch)
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_tasks.erase(remove_if(m_tasks.begin(), m_tasks.end(),
+                            [_batch](const QueuedTask& _queuedTask) { return _queuedTask.m_batch == _batch; }),
+                  m_tasks.end());
+}
+
+void WorkerPool::runAll(const vector<Task>& _tasks)
+{
+    shared_ptr<TaskBatch> batch = make_shared<TaskBatch>(_tasks);
+
+    // The first task is kept for the calling thread, a refused task is simply run by it too.
+    for (size_t i = 1; i < _tasks.size(); i++) {
+        push([batch, i]() { batch->run(i); }, batch.get());
+    }
+
+    for (size_t i = 0; i < _tasks.size(); i++) {
+        batch->run(i);
+    }
+
+    // Every task is claimed now, the copies still queued would only take room from other requests.
+    removeBatch(batch.get());
+
+    // Only the tasks started by a worker may still be running.
+    batch->wait();
+}
+
+size_t WorkerPool::getNbWorkers() const
+{
+    return m_workers.size();
+}
+
+size_t WorkerPool::getMaxQueueSize() const
+{
+    return m_maxQueueSize;
+}
+
+size_t WorkerPool::getQueueSize() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_tasks.size();
+}
+
+void WorkerPool::shutdown()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        if (m_stopped) {
+            return;
+        }
+        m_stopped = true;
+    }
+
+    m_taskAvailable.notify_all();
+    for (thread& worker : m_workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+void WorkerPool::work()
+{
+    while (true) {
+        Task task;
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_taskAvailable.wait(lock, [this] { return m_stopped || !m_tasks.empty(); });
+
+            // The remaining tasks are still processed on shutdown, their clients are waiting.
+            if (m_tasks.empty()) {
+                return;
+            }
+
+            task = move(m_tasks.front().m_task);
+            m_tasks.pop_front();
+        }
+
+        // A task is responsible for answering its client, an escaping exception
+        // must not kill the worker.
+        try {
+            task();
+        } catch (...) {
+        }
+    }
+}
+
+} // namespace Server
+} // namespace Tucuxi
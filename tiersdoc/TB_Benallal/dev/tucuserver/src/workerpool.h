@@ -0,0 +1,80 @@
+#ifndef TUCUXI_SERVER_WORKERPOOL_H
+#define TUCUXI_SERVER_WORKERPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "configuration.h"
+
+namespace Tucuxi {
+namespace Server {
+
+// Fixed set of threads running the computations, so that the Pistache reactor
+// threads only parse the HTTP messages and never block on a computation.
+// The queue is bounded: when it is full, the task is refused and the caller
+// is expected to answer with a 503.
+class WorkerPool
+{
+public:
+    typedef std::function<void()> Task;
+
+    static WorkerPool* getInstance();
+
+    WorkerPool(size_t _nbWorkers, size_t _maxQueueSize);
+    WorkerPool(WorkerPool& other) = delete;
+    ~WorkerPool();
+
+    // Returns false without queuing the task if the queue is full or the pool is stopped.
+    bool trySubmit(Task _task);
+
+    // Runs the tasks in parallel and returns when all of them are done.
+    // The calling thread takes part: it runs every task no worker has started yet, so the
+    // call completes even if the queue is full or if it is made from a worker thread.
+    // The tasks must not throw, an escaping exception is ignored.
+    void runAll(const std::vector<Task>& _tasks);
+
+    size_t getNbWorkers() const;
+    size_t getMaxQueueSize() const;
+    size_t getQueueSize() const;
+
+    // Waits for the queued tasks to finish and joins the workers.
+    void shutdown();
+
+protected:
+    // Queued task. The tasks of a runAll call carry their batch, so that the copies left
+    // once the calling thread has run them can be removed without counting against the limit.
+    struct QueuedTask
+    {
+        Task m_task;
+        const void* m_batch;
+    };
+
+    // Returns false without queuing the task if the queue is full or the pool is stopped.
+    bool push(Task _task, const void* _batch);
+
+    // Removes the queued tasks of a batch that no worker has taken.
+    void removeBatch(const void* _batch);
+
+    void work();
+
+protected:
+    static WorkerPool* m_sWorkerPool;
+
+    const size_t m_maxQueueSize;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_taskAvailable;
+    std::deque<QueuedTask> m_tasks;
+    std::vector<std::thread> m_workers;
+    bool m_stopped;
+};
+
+} // namespace Server
+} // namespace Tucuxi
+
+#endif // TUCUXI_SERVER_WORKERPOOL_H
@@ -29,7 +29,22 @@ HEADERS += \
     src/configuration.h \
     src/configurationreader.h \
     src/communication/apiresponse.h \
-    src/communication/apiresponsewriter.h
+    src/communication/apiresponsewriter.h \
+    src/workerpool.h \
+    src/drugmodelstore.h \
+    src/sha256.h \
+    src/api/WorkerDispatch.h \
+    src/responsecache.h \
+    src/metrics.h \
+    src/api/MetricsApi.h \
+    src/impl/MetricsApiImpl.h \
+    src/communication/xmlstreamwriter.h \
+    src/api/ChunkedResponse.h \
+    src/communication/jsonreader.h \
+    src/communication/jsonstreamwriter.h \
+    src/jobstore.h \
+    src/api/JobsApi.h \
+    src/impl/JobsApiImpl.h
 
 SOURCES += $$PWD/src/main.cpp \
     src/communication/query.cpp \
@@ -50,7 +65,22 @@ SOURCES += $$PWD/src/main.cpp \
     src/configuration.cpp \
     src/configurationreader.cpp \
     src/communication/apiresponse.cpp \
-    src/communication/apiresponsewriter.cpp
+    src/communication/apiresponsewriter.cpp \
+    src/workerpool.cpp \
+    src/drugmodelstore.cpp \
+    src/sha256.cpp \
+    src/api/WorkerDispatch.cpp \
+    src/responsecache.cpp \
+    src/metrics.cpp \
+    src/api/MetricsApi.cpp \
+    src/impl/MetricsApiImpl.cpp \
+    src/communication/xmlstreamwriter.cpp \
+    src/api/ChunkedResponse.cpp \
+    src/communication/jsonreader.cpp \
+    src/communication/jsonstreamwriter.cpp \
+    src/jobstore.cpp \
+    src/api/JobsApi.cpp \
+    src/impl/JobsApiImpl.cpp
 
 win32{
 LIBS += Iphlpapi.lib
@@ -61,6 +91,8 @@ unix{
 
 LIBS += -lpthread
 
+LIBS += -lz
+
 LIBS += $${TUCUXIROOTDIR}/bin/tinyjs.a \
         /usr/lib/x86_64-linux-gnu/libdl.so
 }
@@ -76,6 +108,9 @@ else {
     INCLUDEPATH += $$PWD/libs/pistache/build/src
 }
 
+# nlohmann/json, shared with TuberXpert.
+INCLUDEPATH += $$PWD/../../../../dev/tucuxi-tuberxpert/libs
+
 DEPENDPATH += $$PWD/libs/pistache/build/src
 
 win32-g++:CONFIG(release, debug|release): PRE_TARGETDEPS += $$PWD/libs/pistache/build/src/release/libpistache.a
@@ -3,7 +3,7 @@
 #include "tucucore/computingservice/computingtrait.h"
 #include "xpertdata.h"
 #include "ilanguage.h"
-#include <QVector>
+#include "svgplot.h"
 
 namespace Tucuxi {
 namespace Xpert {
@@ -16,14 +16,15 @@ public:
     GraphCreator();
     int createGraphs(XpertData& _xpertData, const ILanguage* _lang);
 
+    // inline SVG graphs, empty if the corresponding data was not found.
+    const std::string& getConcPercGraph() const;
+    const std::vector<std::string>& getAdjustGraphs() const;
 
 private:
-    void makeContiguousXYData (QVector<double>& _x, QVector<double>& _y,
-                            const std::vector<Core::CycleData>& _datas, const double _timeShift = 0);
-    void concatYData (QVector<double>& _y, const std::vector<Core::CycleData>& _datas);
-
     Common::DateTime getNextDay(Common::DateTime _moment);
 
+    std::string m_concPercGraph;
+    std::vector<std::string> m_adjustGraphs;
 };
 
 }
@@ -1,6 +1,5 @@
 #include "htmlexporter.h"
 #include <fstream>
-#include <QFile>
 #include "graphcreator.h"
 #include "tools.h"
 
@@ -25,10 +24,10 @@ body { margin: 5vh 10vw;}
 section {border-top: solid 1px black; padding: 5vh 2vw;}
 table {margin: 3vh auto;}
 td, th {padding: 1vh 2vw;}
-img {max-width: 100%;}
+.graph svg {max-width: 100%; height: auto;}
 .warning {color: red; border: solid 2px red; font-size: 1.2em; padding: 3vh 5vw; margin: 3vh 5vw;}
 .dosage {margin: 1vh 10vw; border-top: solid 1px black; padding: 2vh 5vw;}
-.zoom {max-width: none;}
+.zoom svg {max-width: none;}
 .redBg {background-color: red;}
 
 </style></head>
@@ -109,15 +108,8 @@ img {max-width: 100%;}
 
     if (concPredData) {
         // displaying current dosage prediction if any
-        QFile concPercFile("concPerc.png");
-        concPercFile.open(QIODevice::ReadOnly);
-        QByteArray concPercEncoded = concPercFile.readAll();
-        concPercEncoded = concPercEncoded.toBase64();
-        concPercFile.close();
-
         out += "<section>\n<h2>" + lang->CURRENT_DOSAGE_PREDICTION +
-                ":</h2>\n<img src=\"data:image/png;base64, "+ concPercEncoded.toStdString()+"\" "
-                "onclick=\"toggleZoom(this)\" />\n";
+                ":</h2>\n<div class=\"graph\" onclick=\"toggleZoom(this)\">" + graphCreator.getConcPercGraph() + "</div>\n";
 
         const Core::TargetDefinition& target = *_xpertData.getDrugModelResult().drugModel->getActiveMoieties()[0]->getTargetDefinitions()[0];
         // current treatment check
@@ -165,13 +157,7 @@ endLoop:
         out += "<section>\n<h2>" + (nbAdjust > 1 ? lang->SUGGESTED_ADJUSTMENTS : lang->SUGGESTED_ADJUSTMENT) + ":</h2>\n" ;
         for (size_t i = 0; i < nbAdjust; i++) {
             const Core::DosageAdjustment currentAdjust = adjustData->getAdjustments()[i];
-            QFile adjustFile (QString::fromStdString("adjust"+std::to_string(i+1)+".png"));
-            adjustFile.open(QIODevice::ReadOnly);
-            QByteArray adjustEncoded = adjustFile.readAll();
-            adjustEncoded = adjustEncoded.toBase64();
-            adjustFile.close();
-            out += "<img src=\"data:image/png;base64, " + adjustEncoded.toStdString() + "\" "
-                   "onclick=\"toggleZoom(this)\" />\n"
+            out += "<div class=\"graph\" onclick=\"toggleZoom(this)\">" + graphCreator.getAdjustGraphs()[i] + "</div>\n"
                    "<h3>" + lang->DATA_FOR_THIS_ADJUSTMENT + ":</h3>\n<b>" +
                     lang->TARGET_EVALUATION + ":</b><br />\n" + lang->GLOBAL_SCORE + ": " +
                     std::to_string(currentAdjust.getGlobalScore()) + "<br />\n<table><tr><th>" +
@@ -211,9 +197,9 @@ endLoop:
         out += "<section><div class=\"warning\">Error: no adjustment result found.</div></section>\n";
     }
 
-    out += "</body>\n<script>\nfunction toggleZoom (img) {\n"
-           "if (img.classList.contains(\"zoom\")) {img.classList.remove(\"zoom\")}\n"
-           "else { img.classList.add(\"zoom\") }\n}</script>\n</html>";
+    out += "</body>\n<script>\nfunction toggleZoom (graph) {\n"
+           "if (graph.classList.contains(\"zoom\")) {graph.classList.remove(\"zoom\")}\n"
+           "else { graph.classList.add(\"zoom\") }\n}</script>\n</html>";
 
     std::ofstream file;
     file.open(_outputPath);
@@ -0,0 +1,305 @@
+#include "svgplot.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+
+
+namespace Tucuxi {
+namespace Xpert {
+
+const double MARGIN_LEFT = 80.;
+const double MARGIN_RIGHT = 30.;
+const double MARGIN_TOP = 20.;
+const double MARGIN_BOTTOM = 100.;
+
+
+// calls _f(x, y) for each point of the series, reading the cycles in place.
+template <typename F>
+static void forEachPoint (const std::vector<Core::CycleData>& _cycles, double _timeShift, F _f)
+{
+    double lastX = _timeShift;
+    for (const Core::CycleData& cycle : _cycles) {
+        const std::vector<double>& times = cycle.m_times[0];
+        const Core::Concentrations& values = cycle.m_concentrations[0];
+        for (size_t i = 0; i < times.size() && i < values.size(); i++) {
+            _f(lastX + times[i], values[i]);
+        }
+        if (!times.empty()) {
+            lastX += times.back();
+        }
+    }
+}
+
+SvgPlot::SvgPlot()
+{ }
+
+void SvgPlot::setXLabel (const std::string& _label)
+{
+    m_xLabel = _label;
+}
+
+void SvgPlot::setYLabel (const std::string& _label)
+{
+    m_yLabel = _label;
+}
+
+void SvgPlot::addXTick (double _x, const std::string& _label)
+{
+    m_xTicks.emplace_back(_x, _label);
+}
+
+void SvgPlot::addCurve (const std::vector<Core::CycleData>& _cycles, double _timeShift, const std::string& _color,
+                        double _width, const std::string& _name, bool _above)
+{
+    m_layers.push_back({LayerType::Curve, &_cycles, nullptr, _timeShift, {}, {}, _color, "", _width, _name, _above});
+}
+
+void SvgPlot::addBand (const std::vector<Core::CycleData>& _lower, const std::vector<Core::CycleData>& _upper,
+                       double _timeShift, const std::string& _fillColor, const std::string& _lineColor)
+{
+    m_layers.push_back({LayerType::Band, &_lower, &_upper, _timeShift, {}, {}, _lineColor, _fillColor, 1., "", false});
+}
+
+void SvgPlot::addScatter (const std::vector<double>& _x, const std::vector<double>& _y,
+                          const std::string& _color, const std::string& _name)
+{
+    m_layers.push_back({LayerType::Scatter, nullptr, nullptr, 0., _x, _y, _color, "", 1., _name, false});
+}
+
+std::vector<double> SvgPlot::getCycleOffsets (const std::vector<Core::CycleData>& _cycles, double _timeShift)
+{
+    std::vector<double> offsets;
+    offsets.reserve(_cycles.size() + 1);
+    double lastX = _timeShift;
+    for (const Core::CycleData& cycle : _cycles) {
+        offsets.push_back(lastX);
+        if (!cycle.m_times[0].empty()) {
+            lastX += cycle.m_times[0].back();
+        }
+    }
+    offsets.push_back(lastX);
+    return offsets;
+}
+
+std::string SvgPlot::render (int _width, int _height) const
+{
+    // axes ranges fitting all the layers
+    double xMin = std::numeric_limits<double>::max();
+    double xMax = std::numeric_limits<double>::lowest();
+    double yMin = 0.;
+    double yMax = std::numeric_limits<double>::lowest();
+    auto extend = [&](double _x, double _y) {
+        xMin = std::min(xMin, _x);
+        xMax = std::max(xMax, _x);
+        yMin = std::min(yMin, _y);
+        yMax = std::max(yMax, _y);
+    };
+    for (const Layer& layer : m_layers) {
+        if (layer.m_type == LayerType::Scatter) {
+            for (size_t i = 0; i < layer.m_x.size() && i < layer.m_y.size(); i++) {
+                extend(layer.m_x[i], layer.m_y[i]);
+            }
+        } else {
+            forEachPoint(*layer.m_cycles, layer.m_timeShift, extend);
+            if (layer.m_upperCycles) {
+                forEachPoint(*layer.m_upperCycles, layer.m_timeShift, extend);
+            }
+        }
+    }
+    if (xMin >= xMax) {
+        xMin = 0.;
+        xMax = 1.;
+    }
+    if (yMax <= yMin) {
+        yMax = yMin + 1.;
+    }
+    yMax += (yMax - yMin) * 0.05;
+
+    const double plotWidth = std::max(_width - MARGIN_LEFT - MARGIN_RIGHT, 1.);
+    const double plotHeight = std::max(_height - MARGIN_TOP - MARGIN_BOTTOM, 1.);
+    auto toX = [&](double _x) { return MARGIN_LEFT + (_x - xMin) / (xMax - xMin) * plotWidth; };
+    auto toY = [&](double _y) { return MARGIN_TOP + plotHeight - (_y - yMin) / (yMax - yMin) * plotHeight; };
+
+    std::string svg = "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"" + std::to_string(_width) + "\" height=\"" +
+            std::to_string(_height) + "\" viewBox=\"0 0 " + std::to_string(_width) + " " + std::to_string(_height) +
+            "\" font-family=\"sans-serif\" font-size=\"12\">\n"
+            "<rect width=\"100%\" height=\"100%\" fill=\"white\" />\n";
+
+    // grid and ticks
+    double yStep = niceStep(yMax - yMin, 6);
+    for (double y = std::ceil(yMin / yStep) * yStep; y <= yMax; y += yStep) {
+        std::string py = format(toY(y));
+        svg += "<line x1=\"" + format(MARGIN_LEFT) + "\" y1=\"" + py + "\" x2=\"" + format(MARGIN_LEFT + plotWidth) +
+               "\" y2=\"" + py + "\" stroke=\"#DCDCDC\" />\n<text x=\"" + format(MARGIN_LEFT - 6.) + "\" y=\"" + py +
+               "\" dy=\"4\" text-anchor=\"end\">" + format(y) + "</text>\n";
+    }
+    for (const std::pair<double, std::string>& tick : m_xTicks) {
+        if (tick.first < xMin || tick.first > xMax) {
+            continue;
+        }
+        std::string px = format(toX(tick.first));
+        std::string py = format(MARGIN_TOP + plotHeight + 8.);
+        svg += "<line x1=\"" + px + "\" y1=\"" + format(MARGIN_TOP) + "\" x2=\"" + px + "\" y2=\"" +
+               format(MARGIN_TOP + plotHeight) + "\" stroke=\"#DCDCDC\" />\n<text x=\"" + px + "\" y=\"" + py +
+               "\" transform=\"rotate(45 " + px + " " + py + ")\">" + escape(tick.second) + "</text>\n";
+    }
+    svg += "<rect x=\"" + format(MARGIN_LEFT) + "\" y=\"" + format(MARGIN_TOP) + "\" width=\"" + format(plotWidth) +
+           "\" height=\"" + format(plotHeight) + "\" fill=\"none\" stroke=\"black\" />\n";
+
+    // axes labels
+    svg += "<text x=\"" + format(MARGIN_LEFT + plotWidth / 2.) + "\" y=\"" + format(_height - 8.) +
+           "\" text-anchor=\"middle\">" + escape(m_xLabel) + "</text>\n";
+    std::string labelY = format(MARGIN_TOP + plotHeight / 2.);
+    svg += "<text x=\"20\" y=\"" + labelY + "\" text-anchor=\"middle\" transform=\"rotate(-90 20 " + labelY + ")\">" +
+           escape(m_yLabel) + "</text>\n";
+
+    // layers, the "above" ones last. The nested svg clips them to the plot area.
+    std::string area = format(MARGIN_LEFT) + "\" y=\"" + format(MARGIN_TOP) + "\" width=\"" + format(plotWidth) +
+            "\" height=\"" + format(plotHeight);
+    svg += "<svg x=\"" + area + "\" viewBox=\"" + format(MARGIN_LEFT) + " " + format(MARGIN_TOP) + " " +
+           format(plotWidth) + " " + format(plotHeight) + "\">\n";
+    for (bool above : {false, true}) {
+        for (const Layer& layer : m_layers) {
+            if (layer.m_above == above) {
+                svg += renderLayer(layer, xMin, xMax, yMin, yMax, MARGIN_LEFT, MARGIN_TOP, plotWidth, plotHeight);
+            }
+        }
+    }
+    svg += "</svg>\n";
+
+    // legend, in insertion order
+    std::vector<const Layer*> legend;
+    for (const Layer& layer : m_layers) {
+        if (!layer.m_name.empty()) {
+            legend.push_back(&layer);
+        }
+    }
+    if (!legend.empty()) {
+        size_t maxNameLength = 0;
+        for (const Layer* layer : legend) {
+            maxNameLength = std::max(maxNameLength, layer->m_name.size());
+        }
+        double legendWidth = 50. + 7. * maxNameLength;
+        double legendX = MARGIN_LEFT + plotWidth - legendWidth - 8.;
+        double legendY = MARGIN_TOP + 8.;
+        svg += "<rect x=\"" + format(legendX) + "\" y=\"" + format(legendY) + "\" width=\"" + format(legendWidth) +
+               "\" height=\"" + format(20. * legend.size() + 8.) + "\" fill=\"white\" fill-opacity=\"0.78\" stroke=\"black\" />\n";
+        for (size_t i = 0; i < legend.size(); i++) {
+            std::string y = format(legendY + 18. + 20. * i);
+            if (legend[i]->m_type == LayerType::Scatter) {
+                svg += "<circle cx=\"" + format(legendX + 20.) + "\" cy=\"" + format(legendY + 14. + 20. * i) +
+                       "\" r=\"3.5\" fill=\"none\" stroke=\"" + legend[i]->m_color + "\" />\n";
+            } else {
+                std::string lineY = format(legendY + 14. + 20. * i);
+                svg += "<line x1=\"" + format(legendX + 8.) + "\" y1=\"" + lineY + "\" x2=\"" + format(legendX + 32.) +
+                       "\" y2=\"" + lineY + "\" stroke=\"" + legend[i]->m_color + "\" stroke-width=\"" +
+                       format(legend[i]->m_width) + "\" />\n";
+            }
+            svg += "<text x=\"" + format(legendX + 40.) + "\" y=\"" + y + "\">" + escape(legend[i]->m_name) + "</text>\n";
+        }
+    }
+
+    svg += "</svg>";
+    return svg;
+}
+
+std::string SvgPlot::renderLayer (const Layer& _layer, double _xMin, double _xMax, double _yMin, double _yMax,
+                                  double _plotX, double _plotY, double _plotWidth, double _plotHeight) const
+{
+    auto toX = [&](double _x) { return _plotX + (_x - _xMin) / (_xMax - _xMin) * _plotWidth; };
+    auto toY = [&](double _y) { return _plotY + _plotHeight - (_y - _yMin) / (_yMax - _yMin) * _plotHeight; };
+
+    // points falling on the pixel of the previous one are skipped, dense curves stay light.
+    auto makePoints = [&](const std::vector<Core::CycleData>& _cycles) {
+        std::string points;
+        double lastPx = std::numeric_limits<double>::lowest();
+        double lastPy = std::numeric_limits<double>::lowest();
+        forEachPoint(_cycles, _layer.m_timeShift, [&](double _x, double _y) {
+            double px = toX(_x);
+            double py = toY(_y);
+            if (std::abs(px - lastPx) >= 0.5 || std::abs(py - lastPy) >= 0.5) {
+                points += format(px) + "," + format(py) + " ";
+                lastPx = px;
+                lastPy = py;
+            }
+        });
+        return points;
+    };
+
+    std::string svg;
+    switch (_layer.m_type) {
+    case LayerType::Curve:
+        svg += "<polyline fill=\"none\" stroke=\"" + _layer.m_color + "\" stroke-width=\"" + format(_layer.m_width) +
+               "\" points=\"" + makePoints(*_layer.m_cycles) + "\" />\n";
+        break;
+
+    case LayerType::Band: {
+        // the polygon goes along the upper series, then back along the lower one.
+        std::string lowerBackward;
+        std::vector<double> offsets = getCycleOffsets(*_layer.m_cycles, _layer.m_timeShift);
+        for (size_t c = _layer.m_cycles->size(); c-- > 0;) {
+            const Core::CycleData& cycle = (*_layer.m_cycles)[c];
+            const std::vector<double>& times = cycle.m_times[0];
+            const Core::Concentrations& values = cycle.m_concentrations[0];
+            for (size_t i = std::min(times.size(), values.size()); i-- > 0;) {
+                lowerBackward += format(toX(offsets[c] + times[i])) + "," + format(toY(values[i])) + " ";
+            }
+        }
+        std::string upper = makePoints(*_layer.m_upperCycles);
+        svg += "<polygon fill=\"" + _layer.m_fillColor + "\" stroke=\"none\" points=\"" + upper + lowerBackward + "\" />\n"
+               "<polyline fill=\"none\" stroke=\"" + _layer.m_color + "\" points=\"" + upper + "\" />\n"
+               "<polyline fill=\"none\" stroke=\"" + _layer.m_color + "\" points=\"" + makePoints(*_layer.m_cycles) + "\" />\n";
+        break;
+    }
+
+    case LayerType::Scatter:
+        for (size_t i = 0; i < _layer.m_x.size() && i < _layer.m_y.size(); i++) {
+            svg += "<circle cx=\"" + format(toX(_layer.m_x[i])) + "\" cy=\"" + format(toY(_layer.m_y[i])) +
+                   "\" r=\"3.5\" fill=\"none\" stroke=\"" + _layer.m_color + "\" />\n";
+        }
+        break;
+    }
+    return svg;
+}
+
+std::string SvgPlot::escape (const std::string& _text)
+{
+    std::string escaped;
+    for (char c : _text) {
+        switch (c) {
+        case '&': escaped += "&amp;"; break;
+        case '<': escaped += "&lt;"; break;
+        case '>': escaped += "&gt;"; break;
+        case '"': escaped += "&quot;"; break;
+        default: escaped += c;
+        }
+    }
+    return escaped;
+}
+
+std::string SvgPlot::format (double _value)
+{
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%.6g", std::abs(_value) < 1e-9 ? 0. : _value);
+    return buffer;
+}
+
+double SvgPlot::niceStep (double _range, int _nbTicks)
+{
+    double rawStep = _range / _nbTicks;
+    double magnitude = std::pow(10., std::floor(std::log10(rawStep)));
+    double normalized = rawStep / magnitude;
+    if (normalized <= 1.) {
+        return magnitude;
+    } else if (normalized <= 2.) {
+        return 2. * magnitude;
+    } else if (normalized <= 5.) {
+        return 5. * magnitude;
+    }
+    return 10. * magnitude;
+}
+
+
+}
+}
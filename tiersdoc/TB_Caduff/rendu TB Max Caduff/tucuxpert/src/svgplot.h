@@ -0,0 +1,75 @@
+#ifndef SVGPLOT_H
+#define SVGPLOT_H
+#include <string>
+#include <vector>
+#include "tucucore/computingservice/computingtrait.h"
+
+
+namespace Tucuxi {
+namespace Xpert {
+
+// Headless plot rendered as an inline SVG string. It needs no display server and
+// reads the cycle data of the computing responses in place, without copying them.
+// The cycles of a series are made contiguous on the x axis: the times of a cycle
+// are shifted by the last x of the previous cycle, the first one by _timeShift.
+class SvgPlot
+{
+public:
+
+    SvgPlot();
+
+    void setXLabel (const std::string& _label);
+    void setYLabel (const std::string& _label);
+    void addXTick (double _x, const std::string& _label);
+
+    // curves in the "above" layer are drawn after all the others, whatever the insertion order.
+    void addCurve (const std::vector<Core::CycleData>& _cycles, double _timeShift, const std::string& _color,
+                   double _width, const std::string& _name = "", bool _above = false);
+
+    // channel between two series of the same length, filled and bordered by both curves.
+    void addBand (const std::vector<Core::CycleData>& _lower, const std::vector<Core::CycleData>& _upper,
+                  double _timeShift, const std::string& _fillColor, const std::string& _lineColor);
+
+    void addScatter (const std::vector<double>& _x, const std::vector<double>& _y,
+                     const std::string& _color, const std::string& _name);
+
+    std::string render (int _width, int _height) const;
+
+    // x offset of each cycle, followed by the last x of the series.
+    static std::vector<double> getCycleOffsets (const std::vector<Core::CycleData>& _cycles, double _timeShift);
+
+private:
+
+    enum class LayerType { Curve, Band, Scatter };
+
+    struct Layer {
+        LayerType m_type;
+        const std::vector<Core::CycleData>* m_cycles;
+        const std::vector<Core::CycleData>* m_upperCycles;
+        double m_timeShift;
+        std::vector<double> m_x;
+        std::vector<double> m_y;
+        std::string m_color;
+        std::string m_fillColor;
+        double m_width;
+        std::string m_name;
+        bool m_above;
+    };
+
+    std::string renderLayer (const Layer& _layer, double _xMin, double _xMax, double _yMin, double _yMax,
+                             double _plotX, double _plotY, double _plotWidth, double _plotHeight) const;
+
+    static std::string escape (const std::string& _text);
+    static std::string format (double _value);
+    static double niceStep (double _range, int _nbTicks);
+
+    std::string m_xLabel;
+    std::string m_yLabel;
+    std::vector<std::pair<double, std::string>> m_xTicks;
+    std::vector<Layer> m_layers;
+};
+
+
+}
+}
+#endif // SVGPLOT_H
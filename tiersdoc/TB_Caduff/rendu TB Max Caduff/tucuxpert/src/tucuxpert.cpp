@@ -12,7 +12,6 @@
 #include "tucucore/drugmodelrepository.h"
 
 #include "tucuxperthandler.h"
-#include <QApplication>
 
 #include "cxxopts/include/cxxopts.hpp"
 
@@ -104,7 +103,6 @@ parse(int _argc, char* _argv[])
 
 int main(int _argc, char** _argv)
 {
-    QApplication app(_argc, _argv);
     // Get application folder
     std::string appFolder = Tucuxi::Common::Utils::getAppFolder(_argv);
 
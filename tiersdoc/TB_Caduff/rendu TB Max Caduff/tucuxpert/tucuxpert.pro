@@ -1,9 +1,7 @@
 TEMPLATE = app
-CONFIG += QT
 CONFIG += console
 CONFIG -= app_bundle
-QT += core gui
-greaterThan(QT_MAJOR_VERSION, 4): QT += widgets printsupport
+CONFIG -= qt
 
 TARGET = tucuxpert
 
@@ -26,11 +24,11 @@ SOURCES += \
     src/requestcreator.cpp \
     src/drugmodelselector.cpp \
     src/xpertdata.cpp \
-    libs/qcustomplot.cpp \
     src/htmlexporter.cpp \
     src/enlanguage.cpp \
     src/ilanguage.cpp \
     src/graphcreator.cpp \
+    src/svgplot.cpp \
     src/tools.cpp
 
 # Because of Eigen:
@@ -42,9 +40,9 @@ HEADERS += \
     src/requestcreator.h \
     src/drugmodelselector.h \
     src/xpertdata.h \
-    libs/qcustomplot.h \
     src/ilanguage.h \
     src/htmlexporter.h \
     src/enlanguage.h \
     src/graphcreator.h \
+    src/svgplot.h \
     src/tools.h